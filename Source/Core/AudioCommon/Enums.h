@@ -12,4 +12,15 @@ enum class DPL2Quality : int
   High = 2,
   Highest = 3
 };
+
+// How the mixer converts every audio source to the output sample rate
+enum class ResamplingQuality : int
+{
+  // 6-point Hermite interpolation
+  Low = 0,
+  // 16-tap windowed sinc filter
+  Medium = 1,
+  // 32-tap windowed sinc filter
+  High = 2
+};
 }  // namespace AudioCommon
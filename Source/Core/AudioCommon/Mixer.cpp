@@ -98,66 +98,68 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
 
   m_granule_queue_size.store(buffer_size_granules, std::memory_order_relaxed);
 
-  while (num_samples-- > 0)
+  m_resampler.Configure(m_mixer->m_config_resampling_quality, out_sample_rate / in_sample_rate);
+  const float* granule_sum = reinterpret_cast<const float*>(&m_granule_sum[PADDING]);
+
+  std::array<StereoPair, MIX_BLOCK_SIZE> block;
+  while (num_samples > 0)
   {
     // The indexes for the front and back buffers are offset by 50% of the granule size.
-    // We use the modular nature of 32-bit integers to wrap around the granule size.
-    m_current_index += index_jump;
-    const u32 front_index = m_current_index;
-    const u32 back_index = m_current_index + INDEX_HALF;
-
-    // If either index is less than the index jump, that means we reached
-    // the end of the of the buffer and need to load the next granule.
-    if (front_index < index_jump)
-      fade_audio = Dequeue(&m_front);
-    else if (back_index < index_jump)
-      fade_audio = Dequeue(&m_back);
-
-    // The Granules are pre-windowed, so we can just add them together
-    const std::size_t ft = front_index >> GRANULE_FRAC_BITS;
-    const std::size_t bt = back_index >> GRANULE_FRAC_BITS;
-    const StereoPair s0 = m_front[(ft - 2) & GRANULE_MASK] + m_back[(bt - 2) & GRANULE_MASK];
-    const StereoPair s1 = m_front[(ft - 1) & GRANULE_MASK] + m_back[(bt - 1) & GRANULE_MASK];
-    const StereoPair s2 = m_front[(ft + 0) & GRANULE_MASK] + m_back[(bt + 0) & GRANULE_MASK];
-    const StereoPair s3 = m_front[(ft + 1) & GRANULE_MASK] + m_back[(bt + 1) & GRANULE_MASK];
-    const StereoPair s4 = m_front[(ft + 2) & GRANULE_MASK] + m_back[(bt + 2) & GRANULE_MASK];
-    const StereoPair s5 = m_front[(ft + 3) & GRANULE_MASK] + m_back[(bt + 3) & GRANULE_MASK];
-
-    // Polynomial Interpolators for High-Quality Resampling of
-    // Over Sampled Audio by Olli Niemitalo, October 2001.
-    // Page 43 -- 6-point, 3rd-order Hermite:
-    // https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
-    const u32 t_frac = m_current_index & ((1 << GRANULE_FRAC_BITS) - 1);
-    const float t1 = t_frac / static_cast<float>(1 << GRANULE_FRAC_BITS);
-    const float t2 = t1 * t1;
-    const float t3 = t2 * t1;
-
-    StereoPair sample = (s0 * StereoPair{(+0.0f + 1.0f * t1 - 2.0f * t2 + 1.0f * t3) / 12.0f} +
-                         s1 * StereoPair{(+0.0f - 8.0f * t1 + 15.0f * t2 - 7.0f * t3) / 12.0f} +
-                         s2 * StereoPair{(+3.0f + 0.0f * t1 - 7.0f * t2 + 4.0f * t3) / 3.0f} +
-                         s3 * StereoPair{(+0.0f + 2.0f * t1 + 5.0f * t2 - 4.0f * t3) / 3.0f} +
-                         s4 * StereoPair{(+0.0f - 1.0f * t1 - 6.0f * t2 + 7.0f * t3) / 12.0f} +
-                         s5 * StereoPair{(+0.0f + 0.0f * t1 + 1.0f * t2 - 1.0f * t3) / 12.0f});
-
-    // Apply Fade In / Fade Out depending on if we are looping
-    if (fade_audio)
-      m_fade_volume += fade_out_mul * (0.0f - m_fade_volume);
+    // We use the modular nature of 32-bit integers to wrap around the granule size, which means
+    // that one of them wraps around whenever the lower 31 bits of the index do.
+    const u32 half_index = m_current_index & (INDEX_HALF - 1);
+    std::size_t count;
+    if (half_index + u64{index_jump} >= INDEX_HALF)
+    {
+      m_current_index += index_jump;
+      const u32 front_index = m_current_index;
+      const u32 back_index = m_current_index + INDEX_HALF;
+
+      // If either index is less than the index jump, that means we reached
+      // the end of the of the buffer and need to load the next granule.
+      if (front_index < index_jump)
+        fade_audio = Dequeue(&m_front);
+      else if (back_index < index_jump)
+        fade_audio = Dequeue(&m_back);
+      UpdateGranuleSum();
+
+      count = 1;
+      m_resampler.Resample(granule_sum, m_current_index, index_jump, count, &block[0].l);
+    }
     else
-      m_fade_volume += fade_in_mul * (1.0f - m_fade_volume);
+    {
+      // All the samples up to the next granule can be resampled in one go.
+      const std::size_t until_granule =
+          index_jump == 0 ? num_samples : (INDEX_HALF - 1 - half_index) / index_jump;
+      count = std::min({num_samples, until_granule, MIX_BLOCK_SIZE});
+      m_resampler.Resample(granule_sum, m_current_index + index_jump, index_jump, count,
+                           &block[0].l);
+      m_current_index += index_jump * static_cast<u32>(count);
+    }
+    num_samples -= count;
 
-    // Apply the fade volume and the regular volume to the sample
-    sample = sample * volume * StereoPair{m_fade_volume};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      // Apply Fade In / Fade Out depending on if we are looping
+      if (fade_audio)
+        m_fade_volume += fade_out_mul * (0.0f - m_fade_volume);
+      else
+        m_fade_volume += fade_in_mul * (1.0f - m_fade_volume);
 
-    // This quantization method prevents accumulated error but does not do noise shaping.
-    sample.l += samples[0] - m_quantization_error.l;
-    samples[0] = MathUtil::SaturatingCast<s16>(std::lround(sample.l));
-    m_quantization_error.l = std::clamp(samples[0] - sample.l, -1.0f, 1.0f);
+      // Apply the fade volume and the regular volume to the sample
+      StereoPair sample = block[i] * volume * StereoPair{m_fade_volume};
 
-    sample.r += samples[1] - m_quantization_error.r;
-    samples[1] = MathUtil::SaturatingCast<s16>(std::lround(sample.r));
-    m_quantization_error.r = std::clamp(samples[1] - sample.r, -1.0f, 1.0f);
+      // This quantization method prevents accumulated error but does not do noise shaping.
+      sample.l += samples[0] - m_quantization_error.l;
+      samples[0] = MathUtil::SaturatingCast<s16>(std::lround(sample.l));
+      m_quantization_error.l = std::clamp(samples[0] - sample.l, -1.0f, 1.0f);
 
-    samples += 2;
+      sample.r += samples[1] - m_quantization_error.r;
+      samples[1] = MathUtil::SaturatingCast<s16>(std::lround(sample.r));
+      m_quantization_error.r = std::clamp(samples[1] - sample.r, -1.0f, 1.0f);
+
+      samples += 2;
+    }
   }
 }
 
@@ -428,6 +430,7 @@ void Mixer::RefreshConfig()
 {
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_audio_preserve_pitch = Config::Get(Config::MAIN_AUDIO_PRESERVE_PITCH);
+  m_config_resampling_quality = Config::Get(Config::MAIN_AUDIO_RESAMPLING_QUALITY);
   m_config_fill_audio_gaps = Config::Get(Config::MAIN_AUDIO_FILL_GAPS);
   m_config_audio_buffer_ms = Config::Get(Config::MAIN_AUDIO_BUFFER_SIZE);
   m_config_wiimote_routing_enabled = Config::Get(Config::MAIN_WIIMOTE_AUDIO_ROUTING_ENABLED);
@@ -550,6 +553,17 @@ void Mixer::MixerFifo::Enqueue()
   m_queue_looping.store(false, std::memory_order_relaxed);
 }
 
+// The Granules are pre-windowed, so we can just add them together
+void Mixer::MixerFifo::UpdateGranuleSum()
+{
+  for (std::size_t i = 0; i < m_granule_sum.size(); ++i)
+  {
+    const std::size_t index = i - PADDING;
+    m_granule_sum[i] =
+        m_front[index & GRANULE_MASK] + m_back[(index + GRANULE_OVERLAP) & GRANULE_MASK];
+  }
+}
+
 bool Mixer::MixerFifo::Dequeue(Granule* granule)
 {
   const std::size_t granule_queue_size = m_granule_queue_size.load(std::memory_order_relaxed);
@@ -7,6 +7,8 @@
 #include <atomic>
 #include <bit>
 
+#include "AudioCommon/Enums.h"
+#include "AudioCommon/Resampler.h"
 #include "AudioCommon/SurroundDecoder.h"
 #include "AudioCommon/WaveFile.h"
 #include "Common/CommonTypes.h"
@@ -98,9 +100,13 @@ private:
     static constexpr std::size_t GRANULE_MASK = GRANULE_SIZE - 1;
     static constexpr std::size_t GRANULE_BITS = std::countr_one(GRANULE_MASK);
     static constexpr std::size_t GRANULE_FRAC_BITS = 32 - GRANULE_BITS;
+    static_assert(GRANULE_FRAC_BITS == AudioCommon::Resampler::FRAC_BITS);
 
     using Granule = std::array<StereoPair, GRANULE_SIZE>;
 
+    // Samples are resampled this many at a time, at most, before they are mixed.
+    static constexpr std::size_t MIX_BLOCK_SIZE = 256;
+
   public:
     MixerFifo(Mixer* mixer, u32 sample_rate_divisor,
               u32 sample_rate_dividend = FIXED_SAMPLE_RATE_DIVIDEND)
@@ -145,6 +151,12 @@ private:
     u32 m_current_index = 0;
     Granule m_front, m_back;
 
+    // The front and back granules added together, in the order of the front granule, with
+    // Resampler::PADDING samples from the other end on either side.
+    static constexpr std::size_t PADDING = AudioCommon::Resampler::PADDING;
+    std::array<StereoPair, GRANULE_SIZE + 2 * PADDING> m_granule_sum{};
+    AudioCommon::Resampler m_resampler;
+
     std::atomic<std::size_t> m_granule_queue_size{20};
     std::array<Granule, MAX_GRANULE_QUEUE_SIZE> m_queue;
     std::atomic<std::size_t> m_queue_head{0};
@@ -155,6 +167,7 @@ private:
 
     void Enqueue();
     bool Dequeue(Granule* granule);
+    void UpdateGranuleSum();
 
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
@@ -196,6 +209,7 @@ private:
 
   float m_config_emulation_speed;
   bool m_config_audio_preserve_pitch;
+  AudioCommon::ResamplingQuality m_config_resampling_quality;
   bool m_config_fill_audio_gaps;
   int m_config_audio_buffer_ms;
   bool m_config_wiimote_routing_enabled = false;
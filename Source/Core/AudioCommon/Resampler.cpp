@@ -0,0 +1,258 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/Resampler.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numbers>
+
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
+
+namespace AudioCommon
+{
+constexpr u32 FRAC_MASK = (1 << Resampler::FRAC_BITS) - 1;
+constexpr u32 PHASE_SHIFT = Resampler::FRAC_BITS - std::countr_zero(Resampler::NUM_PHASES);
+constexpr u32 PHASE_FRAC_MASK = (1 << PHASE_SHIFT) - 1;
+
+// The first input frame a filter with <num_taps> taps reads for <position>
+static const float* FirstFrame(const float* input, u32 position, u32 num_taps)
+{
+  const std::ptrdiff_t frame = static_cast<std::ptrdiff_t>(position >> Resampler::FRAC_BITS);
+  return input + 2 * (frame + 1 - static_cast<std::ptrdiff_t>(num_taps / 2));
+}
+
+// Polynomial Interpolators for High-Quality Resampling of
+// Over Sampled Audio by Olli Niemitalo, October 2001.
+// Page 43 -- 6-point, 3rd-order Hermite:
+// https://yehar.com/blog/wp-content/uploads/2009/08/deip.pdf
+static void ResampleHermite(const float* input, u32 position, u32 step, std::size_t count,
+                            float* output)
+{
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const float* x = FirstFrame(input, position, 6);
+    const float t1 = (position & FRAC_MASK) / static_cast<float>(1 << Resampler::FRAC_BITS);
+    const float t2 = t1 * t1;
+    const float t3 = t2 * t1;
+
+    const float c0 = (+0.0f + 1.0f * t1 - 2.0f * t2 + 1.0f * t3) / 12.0f;
+    const float c1 = (+0.0f - 8.0f * t1 + 15.0f * t2 - 7.0f * t3) / 12.0f;
+    const float c2 = (+3.0f + 0.0f * t1 - 7.0f * t2 + 4.0f * t3) / 3.0f;
+    const float c3 = (+0.0f + 2.0f * t1 + 5.0f * t2 - 4.0f * t3) / 3.0f;
+    const float c4 = (+0.0f - 1.0f * t1 - 6.0f * t2 + 7.0f * t3) / 12.0f;
+    const float c5 = (+0.0f + 0.0f * t1 + 1.0f * t2 - 1.0f * t3) / 12.0f;
+
+    for (int channel = 0; channel < 2; ++channel)
+    {
+      output[channel] = x[channel] * c0 + x[channel + 2] * c1 + x[channel + 4] * c2 +
+                        x[channel + 6] * c3 + x[channel + 8] * c4 + x[channel + 10] * c5;
+    }
+
+    output += 2;
+    position += step;
+  }
+}
+
+static void ResampleSinc_Generic(const float* input, u32 position, u32 step, std::size_t count,
+                                 float* output, const float* coefficients, u32 num_taps)
+{
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const float* x = FirstFrame(input, position, num_taps);
+    const float* c0 = coefficients + ((position & FRAC_MASK) >> PHASE_SHIFT) * num_taps;
+    const float* c1 = c0 + num_taps;
+    const float t = (position & PHASE_FRAC_MASK) / static_cast<float>(1 << PHASE_SHIFT);
+
+    float left = 0.0f;
+    float right = 0.0f;
+    for (u32 tap = 0; tap < num_taps; ++tap)
+    {
+      const float c = c0[tap] + t * (c1[tap] - c0[tap]);
+      left += x[2 * tap] * c;
+      right += x[2 * tap + 1] * c;
+    }
+    output[0] = left;
+    output[1] = right;
+
+    output += 2;
+    position += step;
+  }
+}
+
+#ifdef _M_X86_64
+
+// Two frames are processed per vector, so every coefficient is used for a left and a right sample.
+static void ResampleSinc_SSE2(const float* input, u32 position, u32 step, std::size_t count,
+                              float* output, const float* coefficients, u32 num_taps)
+{
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const float* x = FirstFrame(input, position, num_taps);
+    const float* c0 = coefficients + ((position & FRAC_MASK) >> PHASE_SHIFT) * num_taps;
+    const float* c1 = c0 + num_taps;
+    const __m128 t =
+        _mm_set1_ps((position & PHASE_FRAC_MASK) / static_cast<float>(1 << PHASE_SHIFT));
+
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    for (u32 tap = 0; tap < num_taps; tap += 4)
+    {
+      const __m128 a = _mm_loadu_ps(c0 + tap);
+      const __m128 b = _mm_loadu_ps(c1 + tap);
+      const __m128 c = _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+      sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(x + 2 * tap), _mm_unpacklo_ps(c, c)));
+      sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(x + 2 * tap + 4), _mm_unpackhi_ps(c, c)));
+    }
+
+    __m128 sum = _mm_add_ps(sum0, sum1);
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    _mm_storel_pi(reinterpret_cast<__m64*>(output), sum);
+
+    output += 2;
+    position += step;
+  }
+}
+
+// Same as the SSE2 version, for eight taps at a time
+FUNCTION_TARGET_AVX2
+static void ResampleSinc_AVX2(const float* input, u32 position, u32 step, std::size_t count,
+                              float* output, const float* coefficients, u32 num_taps)
+{
+  const __m256i expand_low = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+  const __m256i expand_high = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const float* x = FirstFrame(input, position, num_taps);
+    const float* c0 = coefficients + ((position & FRAC_MASK) >> PHASE_SHIFT) * num_taps;
+    const float* c1 = c0 + num_taps;
+    const __m256 t =
+        _mm256_set1_ps((position & PHASE_FRAC_MASK) / static_cast<float>(1 << PHASE_SHIFT));
+
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    for (u32 tap = 0; tap < num_taps; tap += 8)
+    {
+      const __m256 a = _mm256_loadu_ps(c0 + tap);
+      const __m256 b = _mm256_loadu_ps(c1 + tap);
+      const __m256 c = _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+      sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(x + 2 * tap),
+                                               _mm256_permutevar8x32_ps(c, expand_low)));
+      sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(x + 2 * tap + 8),
+                                               _mm256_permutevar8x32_ps(c, expand_high)));
+    }
+
+    const __m256 sum256 = _mm256_add_ps(sum0, sum1);
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(sum256), _mm256_extractf128_ps(sum256, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    _mm_storel_pi(reinterpret_cast<__m64*>(output), sum);
+
+    output += 2;
+    position += step;
+  }
+}
+
+#endif
+
+// Modified Bessel function of the first kind, for the Kaiser window
+static double BesselI0(double x)
+{
+  double sum = 1.0;
+  double term = 1.0;
+  for (int k = 1; term > sum * 1e-12; ++k)
+  {
+    term *= (x / (2 * k)) * (x / (2 * k));
+    sum += term;
+  }
+  return sum;
+}
+
+void Resampler::BuildSincFilter(u32 num_taps, float cutoff, float beta)
+{
+  const double radius = num_taps / 2;
+  m_coefficients.resize((NUM_PHASES + 1) * num_taps);
+
+  for (u32 phase = 0; phase <= NUM_PHASES; ++phase)
+  {
+    float* row = &m_coefficients[phase * num_taps];
+    double sum = 0.0;
+    for (u32 tap = 0; tap < num_taps; ++tap)
+    {
+      // Distance from the position to the frame this tap is for
+      const double distance = tap + 1.0 - radius - static_cast<double>(phase) / NUM_PHASES;
+      const double x = std::numbers::pi * cutoff * distance;
+      const double sinc = x == 0.0 ? 1.0 : std::sin(x) / x;
+      const double window_pos = std::clamp(distance / radius, -1.0, 1.0);
+      const double window = BesselI0(beta * std::sqrt(1.0 - window_pos * window_pos)) /
+                            BesselI0(beta);
+      row[tap] = static_cast<float>(sinc * window);
+      sum += row[tap];
+    }
+
+    // Keep the volume the same for every phase
+    for (u32 tap = 0; tap < num_taps; ++tap)
+      row[tap] = static_cast<float>(row[tap] / sum);
+  }
+}
+
+void Resampler::Configure(ResamplingQuality quality, double ratio)
+{
+  u32 num_taps;
+  float cutoff;
+  float beta;
+  switch (quality)
+  {
+  case ResamplingQuality::Medium:
+    num_taps = 16;
+    cutoff = 0.9f;
+    beta = 8.0f;
+    break;
+  case ResamplingQuality::High:
+    num_taps = 32;
+    cutoff = 0.95f;
+    beta = 10.0f;
+    break;
+  default:
+    m_quality = ResamplingQuality::Low;
+    m_num_taps = 6;
+    return;
+  }
+
+  cutoff *= static_cast<float>(std::min(ratio, 1.0));
+  if (quality == m_quality && cutoff == m_cutoff)
+    return;
+
+  m_quality = quality;
+  m_num_taps = num_taps;
+  m_cutoff = cutoff;
+  BuildSincFilter(num_taps, cutoff, beta);
+}
+
+void Resampler::Resample(const float* input, u32 position, u32 step, std::size_t count,
+                         float* output) const
+{
+  if (m_quality == ResamplingQuality::Low)
+  {
+    ResampleHermite(input, position, step, count, output);
+    return;
+  }
+
+  const float* coefficients = m_coefficients.data();
+#ifdef _M_X86_64
+  if (cpu_info.bAVX2 && m_num_taps % 8 == 0)
+  {
+    ResampleSinc_AVX2(input, position, step, count, output, coefficients, m_num_taps);
+    return;
+  }
+  if (m_num_taps % 4 == 0)
+  {
+    ResampleSinc_SSE2(input, position, step, count, output, coefficients, m_num_taps);
+    return;
+  }
+#endif
+  ResampleSinc_Generic(input, position, step, count, output, coefficients, m_num_taps);
+}
+}  // namespace AudioCommon
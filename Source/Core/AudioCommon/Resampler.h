@@ -0,0 +1,53 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "AudioCommon/Enums.h"
+#include "Common/CommonTypes.h"
+
+namespace AudioCommon
+{
+// Interpolates stereo audio at arbitrary positions, which is how the mixer converts every audio
+// source to the output sample rate. The sinc filters are polyphase filters, vectorized with the
+// best instruction set the CPU supports.
+class Resampler final
+{
+public:
+  // Positions are fixed point numbers of input frames with this many fractional bits.
+  static constexpr u32 FRAC_BITS = 24;
+  // The sinc filters have this many phases between two input frames. Coefficients in between are
+  // interpolated linearly.
+  static constexpr u32 NUM_PHASES = 64;
+  static constexpr u32 MAX_TAPS = 32;
+  // The input has to hold this many frames before and after every frame a position points into.
+  static constexpr u32 PADDING = MAX_TAPS / 2;
+
+  // Picks the filter for a quality and the ratio of the output sample rate to the input one. When
+  // downsampling, the sinc filters cut off below the output Nyquist frequency instead of the input
+  // one. The filter is only built again if it changed.
+  void Configure(ResamplingQuality quality, double ratio);
+
+  ResamplingQuality GetQuality() const { return m_quality; }
+  u32 GetNumTaps() const { return m_num_taps; }
+
+  // Writes <count> frames of interleaved left and right samples to <output>. Frame i is taken at
+  // <position> + i * <step> in <input>, which is interleaved as well.
+  void Resample(const float* input, u32 position, u32 step, std::size_t count,
+                float* output) const;
+
+private:
+  void BuildSincFilter(u32 num_taps, float cutoff, float beta);
+
+  ResamplingQuality m_quality = ResamplingQuality::Low;
+  u32 m_num_taps = 6;
+  float m_cutoff = 0.0f;
+
+  // NUM_PHASES + 1 rows of m_num_taps coefficients. The last row is the first one shifted by a
+  // frame, so that every phase can be interpolated with the one after it.
+  std::vector<float> m_coefficients;
+};
+}  // namespace AudioCommon
@@ -88,6 +88,7 @@
 #define RESOURCEPACK_DIR "ResourcePacks"
 #define DYNAMICINPUT_DIR "DynamicInputTextures"
 #define GRAPHICSMOD_DIR "GraphicMods"
+#define PIPELINE_UIDS_DIR "PipelineUIDs"
 #define FIRMWARE_DIR "Firmware"
 #define WIISDSYNC_DIR "WiiSDSync"
 #define ASSEMBLY_DIR "SavedAssembly"
@@ -0,0 +1,82 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/FileMapping.h"
+
+#include <limits>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "Common/Assert.h"
+#include "Common/CommonFuncs.h"
+#include "Common/Logging/Log.h"
+
+namespace File
+{
+ReadOnlyFileMapping::ReadOnlyFileMapping() = default;
+
+ReadOnlyFileMapping::~ReadOnlyFileMapping()
+{
+  Unmap();
+}
+
+bool ReadOnlyFileMapping::Map(const DirectIOFile& file, u64 size)
+{
+  ASSERT(!IsMapped());
+
+  // Neither OS can map an empty range.
+  if (!file.IsOpen() || size == 0 || size > std::numeric_limits<size_t>::max())
+    return false;
+
+#if defined(_WIN32)
+  const HANDLE mapping =
+      CreateFileMapping(file.GetHandle(), nullptr, PAGE_READONLY, static_cast<DWORD>(size >> 32),
+                        static_cast<DWORD>(size), nullptr);
+  if (!mapping)
+  {
+    WARN_LOG_FMT(COMMON, "CreateFileMapping: {}", Common::GetLastErrorString());
+    return false;
+  }
+
+  // The view keeps the mapping object alive.
+  void* const data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, static_cast<SIZE_T>(size));
+  CloseHandle(mapping);
+  if (!data)
+  {
+    WARN_LOG_FMT(COMMON, "MapViewOfFile: {}", Common::GetLastErrorString());
+    return false;
+  }
+#else
+  void* const data =
+      mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_SHARED, file.GetHandle(), 0);
+  if (data == MAP_FAILED)
+  {
+    WARN_LOG_FMT(COMMON, "mmap: {}", Common::LastStrerrorString());
+    return false;
+  }
+#endif
+
+  m_data = static_cast<const u8*>(data);
+  m_size = static_cast<size_t>(size);
+  return true;
+}
+
+void ReadOnlyFileMapping::Unmap()
+{
+  if (!IsMapped())
+    return;
+
+#if defined(_WIN32)
+  UnmapViewOfFile(m_data);
+#else
+  munmap(const_cast<u8*>(m_data), m_size);
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+}
+}  // namespace File
@@ -0,0 +1,39 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "Common/CommonTypes.h"
+#include "Common/DirectIOFile.h"
+
+namespace File
+{
+// A read-only view of the beginning of a file, mapped into memory. The pages are only read from
+// the file when they are first accessed.
+//
+// The file may grow while it is mapped, but must not shrink.
+class ReadOnlyFileMapping final
+{
+public:
+  ReadOnlyFileMapping();
+  ~ReadOnlyFileMapping();
+
+  ReadOnlyFileMapping(const ReadOnlyFileMapping&) = delete;
+  ReadOnlyFileMapping& operator=(const ReadOnlyFileMapping&) = delete;
+  ReadOnlyFileMapping(ReadOnlyFileMapping&&) = delete;
+  ReadOnlyFileMapping& operator=(ReadOnlyFileMapping&&) = delete;
+
+  // Maps the first size bytes of an open file. The file can be closed afterwards.
+  bool Map(const DirectIOFile& file, u64 size);
+  void Unmap();
+
+  bool IsMapped() const { return m_data != nullptr; }
+  std::span<const u8> GetData() const { return {m_data, m_size}; }
+
+private:
+  const u8* m_data = nullptr;
+  size_t m_size = 0;
+};
+}  // namespace File
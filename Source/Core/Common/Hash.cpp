@@ -7,6 +7,7 @@
 #include <bit>
 #include <cstring>
 
+#include <xxhash.h>
 #include <zlib.h>
 
 #include "Common/CPUDetect.h"
@@ -412,6 +413,250 @@ static u64 GetHash64_ARMv8_CRC32(const u8* src, u32 len, u32 samples)
 
 #endif
 
+#if defined(_M_X86_64)
+
+// XXH3 switches to its stripe based algorithm for inputs longer than 240 bytes, which is what
+// whole textures almost always are. The reference implementation picks its vector width at compile
+// time, which means SSE2 for generic x86-64 builds, so the wider variants of that algorithm are
+// implemented here and selected at runtime. They produce the same hashes as XXH3_64bits.
+namespace XXH3
+{
+constexpr size_t MIDSIZE_MAX = 240;
+constexpr size_t STRIPE_LEN = 64;
+constexpr size_t SECRET_CONSUME_RATE = 8;
+constexpr size_t SECRET_LASTACC_START = 7;
+constexpr size_t SECRET_MERGEACCS_START = 11;
+
+constexpr u64 PRIME32_1 = 0x9E3779B1U;
+constexpr u64 PRIME32_2 = 0x85EBCA77U;
+constexpr u64 PRIME32_3 = 0xC2B2AE3DU;
+constexpr u64 PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr u64 PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr u64 PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr u64 PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr u64 PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+alignas(64) constexpr u64 INIT_ACC[8] = {PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3,
+                                         PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1};
+
+// The default secret of XXH3
+alignas(64) constexpr u8 SECRET[192] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+constexpr size_t STRIPES_PER_BLOCK = (sizeof(SECRET) - STRIPE_LEN) / SECRET_CONSUME_RATE;
+constexpr size_t BLOCK_LEN = STRIPE_LEN * STRIPES_PER_BLOCK;
+
+static u64 Mul128Fold64(u64 lhs, u64 rhs)
+{
+#ifdef _MSC_VER
+  u64 high;
+  const u64 low = _umul128(lhs, rhs, &high);
+  return low ^ high;
+#else
+  const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+  return static_cast<u64>(product) ^ static_cast<u64>(product >> 64);
+#endif
+}
+
+static u64 Read64(const u8* p)
+{
+  u64 value;
+  std::memcpy(&value, p, sizeof(u64));
+  return value;
+}
+
+static u64 MergeAccs(const u64* acc, size_t len)
+{
+  const u8* secret = SECRET + SECRET_MERGEACCS_START;
+  u64 result = len * PRIME64_1;
+  for (size_t i = 0; i < 4; ++i)
+  {
+    result += Mul128Fold64(acc[2 * i] ^ Read64(secret + 16 * i),
+                           acc[2 * i + 1] ^ Read64(secret + 16 * i + 8));
+  }
+
+  result ^= result >> 37;
+  result *= 0x165667919E3779F9ULL;
+  result ^= result >> 32;
+  return result;
+}
+
+FUNCTION_TARGET_AVX2
+static inline void Accumulate512_AVX2(__m256i* acc, const u8* input, const u8* secret)
+{
+  for (size_t i = 0; i < 2; ++i)
+  {
+    const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input) + i);
+    const __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i);
+    const __m256i data_key = _mm256_xor_si256(data, key);
+    const __m256i data_key_hi = _mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+    const __m256i product = _mm256_mul_epu32(data_key, data_key_hi);
+    // Each lane also accumulates the input of its neighbor
+    const __m256i data_swap = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+    acc[i] = _mm256_add_epi64(acc[i], _mm256_add_epi64(product, data_swap));
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static inline void ScrambleAcc_AVX2(__m256i* acc, const u8* secret)
+{
+  const __m256i prime = _mm256_set1_epi32(static_cast<int>(PRIME32_1));
+  for (size_t i = 0; i < 2; ++i)
+  {
+    const __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i);
+    __m256i value = _mm256_xor_si256(acc[i], _mm256_srli_epi64(acc[i], 47));
+    value = _mm256_xor_si256(value, key);
+    // 64x32 bit multiplication, done as two 32x32 bit ones
+    const __m256i value_hi = _mm256_shuffle_epi32(value, _MM_SHUFFLE(0, 3, 0, 1));
+    const __m256i product_lo = _mm256_mul_epu32(value, prime);
+    const __m256i product_hi = _mm256_mul_epu32(value_hi, prime);
+    acc[i] = _mm256_add_epi64(product_lo, _mm256_slli_epi64(product_hi, 32));
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static u64 HashLong_AVX2(const u8* src, size_t len)
+{
+  __m256i acc[2] = {_mm256_load_si256(reinterpret_cast<const __m256i*>(INIT_ACC)),
+                    _mm256_load_si256(reinterpret_cast<const __m256i*>(INIT_ACC) + 1)};
+
+  const size_t num_blocks = (len - 1) / BLOCK_LEN;
+  for (size_t n = 0; n < num_blocks; ++n)
+  {
+    const u8* block = src + n * BLOCK_LEN;
+    for (size_t s = 0; s < STRIPES_PER_BLOCK; ++s)
+      Accumulate512_AVX2(acc, block + s * STRIPE_LEN, SECRET + s * SECRET_CONSUME_RATE);
+    ScrambleAcc_AVX2(acc, SECRET + sizeof(SECRET) - STRIPE_LEN);
+  }
+
+  const u8* last_block = src + num_blocks * BLOCK_LEN;
+  const size_t num_stripes = (len - 1 - num_blocks * BLOCK_LEN) / STRIPE_LEN;
+  for (size_t s = 0; s < num_stripes; ++s)
+    Accumulate512_AVX2(acc, last_block + s * STRIPE_LEN, SECRET + s * SECRET_CONSUME_RATE);
+  Accumulate512_AVX2(acc, src + len - STRIPE_LEN,
+                     SECRET + sizeof(SECRET) - STRIPE_LEN - SECRET_LASTACC_START);
+
+  alignas(32) u64 result[8];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(result), acc[0]);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(result) + 1, acc[1]);
+  return MergeAccs(result, len);
+}
+
+FUNCTION_TARGET_AVX512F
+static inline __m512i Accumulate512_AVX512(__m512i acc, const u8* input, const u8* secret)
+{
+  const __m512i data = _mm512_loadu_si512(input);
+  const __m512i key = _mm512_loadu_si512(secret);
+  const __m512i data_key = _mm512_xor_si512(data, key);
+  const __m512i data_key_hi =
+      _mm512_shuffle_epi32(data_key, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(0, 3, 0, 1)));
+  const __m512i product = _mm512_mul_epu32(data_key, data_key_hi);
+  // Each lane also accumulates the input of its neighbor
+  const __m512i data_swap =
+      _mm512_shuffle_epi32(data, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(1, 0, 3, 2)));
+  return _mm512_add_epi64(acc, _mm512_add_epi64(product, data_swap));
+}
+
+FUNCTION_TARGET_AVX512F
+static inline __m512i ScrambleAcc_AVX512(__m512i acc, const u8* secret)
+{
+  const __m512i prime = _mm512_set1_epi32(static_cast<int>(PRIME32_1));
+  const __m512i key = _mm512_loadu_si512(secret);
+  __m512i value = _mm512_xor_si512(acc, _mm512_srli_epi64(acc, 47));
+  value = _mm512_xor_si512(value, key);
+  // 64x32 bit multiplication, done as two 32x32 bit ones
+  const __m512i value_hi =
+      _mm512_shuffle_epi32(value, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(0, 3, 0, 1)));
+  const __m512i product_lo = _mm512_mul_epu32(value, prime);
+  const __m512i product_hi = _mm512_mul_epu32(value_hi, prime);
+  return _mm512_add_epi64(product_lo, _mm512_slli_epi64(product_hi, 32));
+}
+
+FUNCTION_TARGET_AVX512F
+static u64 HashLong_AVX512(const u8* src, size_t len)
+{
+  __m512i acc = _mm512_load_si512(INIT_ACC);
+
+  const size_t num_blocks = (len - 1) / BLOCK_LEN;
+  for (size_t n = 0; n < num_blocks; ++n)
+  {
+    const u8* block = src + n * BLOCK_LEN;
+    for (size_t s = 0; s < STRIPES_PER_BLOCK; ++s)
+      acc = Accumulate512_AVX512(acc, block + s * STRIPE_LEN, SECRET + s * SECRET_CONSUME_RATE);
+    acc = ScrambleAcc_AVX512(acc, SECRET + sizeof(SECRET) - STRIPE_LEN);
+  }
+
+  const u8* last_block = src + num_blocks * BLOCK_LEN;
+  const size_t num_stripes = (len - 1 - num_blocks * BLOCK_LEN) / STRIPE_LEN;
+  for (size_t s = 0; s < num_stripes; ++s)
+    acc = Accumulate512_AVX512(acc, last_block + s * STRIPE_LEN, SECRET + s * SECRET_CONSUME_RATE);
+  acc = Accumulate512_AVX512(acc, src + len - STRIPE_LEN,
+                             SECRET + sizeof(SECRET) - STRIPE_LEN - SECRET_LASTACC_START);
+
+  alignas(64) u64 result[8];
+  _mm512_store_si512(result, acc);
+  return MergeAccs(result, len);
+}
+}  // namespace XXH3
+
+static u64 GetXXH3Hash64_AVX2(const u8* src, size_t len)
+{
+  if (len <= XXH3::MIDSIZE_MAX)
+    return XXH3_64bits(src, len);
+  return XXH3::HashLong_AVX2(src, len);
+}
+
+static u64 GetXXH3Hash64_AVX512(const u8* src, size_t len)
+{
+  if (len <= XXH3::MIDSIZE_MAX)
+    return XXH3_64bits(src, len);
+  return XXH3::HashLong_AVX512(src, len);
+}
+
+// Whole textures are hashed with XXH3 when it can use wide vectors. With SSE2 only, it is slower
+// than the CRC32 based hash, so that stays in use there. Sampled hashes only read a few words
+// spread over the texture, so there is nothing to vectorize for them.
+static u64 GetHash64_AVX2(const u8* src, u32 len, u32 samples)
+{
+  if (samples == 0)
+    return GetXXH3Hash64_AVX2(src, len);
+  return GetHash64_SSE42_CRC32(src, len, samples);
+}
+
+static u64 GetHash64_AVX512(const u8* src, u32 len, u32 samples)
+{
+  if (samples == 0)
+    return GetXXH3Hash64_AVX512(src, len);
+  return GetHash64_SSE42_CRC32(src, len, samples);
+}
+
+#endif
+
+// This checks cpu_info on every call instead of caching a function pointer, which costs no more
+// than the indirect call and lets the tests check every variant.
+u64 GetXXH3Hash64(const u8* src, size_t len)
+{
+#if defined(_M_X86_64)
+  if (cpu_info.bAVX512F)
+    return GetXXH3Hash64_AVX512(src, len);
+  if (cpu_info.bAVX2)
+    return GetXXH3Hash64_AVX2(src, len);
+#endif
+  return XXH3_64bits(src, len);
+}
+
 using TextureHashFunction = u64 (*)(const u8* src, u32 len, u32 samples);
 static u64 SetHash64Function(const u8* src, u32 len, u32 samples);
 static TextureHashFunction s_texture_hash_func = SetHash64Function;
@@ -421,7 +666,12 @@ static u64 SetHash64Function(const u8* src, u32 len, u32 samples)
   if (cpu_info.bCRC32)
   {
 #if defined(_M_X86_64)
-    s_texture_hash_func = &GetHash64_SSE42_CRC32;
+    if (cpu_info.bAVX512F)
+      s_texture_hash_func = &GetHash64_AVX512;
+    else if (cpu_info.bAVX2)
+      s_texture_hash_func = &GetHash64_AVX2;
+    else
+      s_texture_hash_func = &GetHash64_SSE42_CRC32;
 #elif defined(_M_ARM_64)
     s_texture_hash_func = &GetHash64_ARMv8_CRC32;
 #endif
@@ -17,6 +17,9 @@ u32 HashEctor(const u8* data, size_t len);
 // Specialized hash function used for the texture cache
 u64 GetHash64(const u8* src, u32 len, u32 samples);
 
+// XXH3_64bits with a seed of 0, using the widest vector instructions the host CPU supports
+u64 GetXXH3Hash64(const u8* src, size_t len);
+
 u32 StartCRC32();
 u32 UpdateCRC32(u32 crc, const u8* data, size_t len);
 u32 ComputeCRC32(const u8* data, size_t len);
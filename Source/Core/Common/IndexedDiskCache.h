@@ -0,0 +1,501 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/DirectIOFile.h"
+#include "Common/FileMapping.h"
+#include "Common/Hash.h"
+#include "Common/Logging/Log.h"
+#include "Common/Version.h"
+
+// On disk format:
+// header{
+// u32 'DCIX';
+// u16 sizeof(key_type);
+// u16 sizeof(value_type);
+// char version[40];  // git revision
+// u64 index_offset;  // of the last index written, 0 if there is none
+//}
+
+// followed by any number of records and indexes:
+// record{
+// u32 'RECD';
+// u32 value_size;
+// key_type   key;
+// value_type[value_size]   value;
+//}
+
+// index{
+// u32 'INDX';
+// u32 num_entries;
+// index_entry{
+//   key_type   key;
+//   u64 value_offset;
+//   u32 value_size;
+// }[num_entries];
+//}
+
+// All fields are written without padding. A record supersedes the earlier records of its key.
+
+namespace Common
+{
+// Key-value store with the same purpose as LinearDiskCache, but with random access.
+//
+// An index of all records is written when the cache is closed, so opening it only has to read the
+// index and the records which were appended after it, e.g. if Dolphin crashed. The file is mapped
+// into memory, and values are only read from it when they are looked up.
+//
+// Append and Lookup can be called from multiple threads at once.
+//
+// Files where most of the space is taken by superseded records or old indexes are compacted when
+// they are opened, or with Compact.
+
+// K and V are some POD type
+// K : the key type, compared bytewise
+// V : value array type
+template <typename K, typename V>
+class IndexedDiskCache
+{
+public:
+  IndexedDiskCache() = default;
+  ~IndexedDiskCache() { Close(); }
+
+  IndexedDiskCache(const IndexedDiskCache&) = delete;
+  IndexedDiskCache& operator=(const IndexedDiskCache&) = delete;
+
+  // Returns the number of entries. A file which isn't a valid cache is recreated.
+  u32 Open(const std::string& filename)
+  {
+    Close();
+
+    bool valid = OpenExisting(filename);
+    if (valid && IsMostlyWasted())
+    {
+      // The file is left unchanged if compacting it fails.
+      Close();
+      Compact(filename);
+      valid = OpenExisting(filename);
+    }
+
+    if (!valid)
+    {
+      // Bad header or no file, recreate it.
+      Reset();
+      if (!CreateEmpty(filename))
+        Reset();
+      return 0;
+    }
+
+    return static_cast<u32>(m_entries.size());
+  }
+
+  // Writes the index if anything was appended.
+  void Close()
+  {
+    if (m_file.IsOpen() && m_index_dirty)
+      WriteIndex();
+    Reset();
+  }
+
+  bool IsOpen() const { return m_file.IsOpen(); }
+
+  void Sync()
+  {
+    std::lock_guard lk(m_mutex);
+    if (m_file.IsOpen())
+      m_file.Flush();
+  }
+
+  u32 GetNumEntries() const
+  {
+    std::lock_guard lk(m_mutex);
+    return static_cast<u32>(m_entries.size());
+  }
+
+  bool Contains(const K& key) const
+  {
+    std::lock_guard lk(m_mutex);
+    return m_entries.contains(key);
+  }
+
+  // The returned values stay valid until the cache is closed.
+  std::optional<std::span<const V>> Lookup(const K& key)
+  {
+    std::lock_guard lk(m_mutex);
+
+    const auto it = m_entries.find(key);
+    if (it == m_entries.end())
+      return std::nullopt;
+
+    Entry& entry = it->second;
+    const u64 size_in_bytes = u64{entry.value_size} * sizeof(V);
+    const std::span<const u8> mapped_data = m_mapping.GetData();
+    if (entry.value_offset + size_in_bytes <= mapped_data.size())
+    {
+      return std::span<const V>(reinterpret_cast<const V*>(mapped_data.data() + entry.value_offset),
+                                entry.value_size);
+    }
+
+    // Appended after the file was mapped.
+    if (!entry.appended_value)
+    {
+      auto value = std::make_unique_for_overwrite<V[]>(entry.value_size);
+      if (!m_file.OffsetRead(entry.value_offset, reinterpret_cast<u8*>(value.get()),
+                             size_in_bytes))
+      {
+        return std::nullopt;
+      }
+      entry.appended_value = std::move(value);
+    }
+    return std::span<const V>(entry.appended_value.get(), entry.value_size);
+  }
+
+  // Appends a key-value pair to the store, replacing any previous value of the key.
+  void Append(const K& key, const V* value, u32 value_size)
+  {
+    std::vector<u8> record(RECORD_HEADER_SIZE + u64{value_size} * sizeof(V));
+    u8* ptr = record.data();
+    ptr = WriteField(ptr, RECORD_TAG);
+    ptr = WriteField(ptr, value_size);
+    ptr = WriteField(ptr, key);
+    if (value_size != 0)
+      std::memcpy(ptr, value, u64{value_size} * sizeof(V));
+
+    std::lock_guard lk(m_mutex);
+    if (!m_file.IsOpen() || !m_file.OffsetWrite(m_end, record.data(), record.size()))
+      return;
+
+    // Values returned by Lookup have to stay valid even if their key gets a new one.
+    const auto it = m_entries.find(key);
+    if (it != m_entries.end() && it->second.appended_value)
+      m_replaced_values.push_back(std::move(it->second.appended_value));
+
+    m_entries.insert_or_assign(key, Entry{m_end + RECORD_HEADER_SIZE, value_size, nullptr});
+    m_end += record.size();
+    m_index_dirty = true;
+  }
+
+  // Rewrites a cache file with only the current value of each key. Returns false if the file
+  // isn't a valid cache or couldn't be rewritten, in which case it is left unchanged.
+  static bool Compact(const std::string& filename)
+  {
+    IndexedDiskCache source;
+    if (!source.OpenExisting(filename))
+      return false;
+
+    const std::string temp_filename = filename + ".compact";
+    IndexedDiskCache compacted;
+    const auto fail = [&] {
+      File::Delete(compacted.m_file, temp_filename);
+      return false;
+    };
+    if (!compacted.CreateEmpty(temp_filename))
+      return fail();
+
+    for (const auto& item : source.m_entries)
+    {
+      const std::optional<std::span<const V>> value = source.Lookup(item.first);
+      if (!value)
+        return fail();
+
+      const u64 previous_end = compacted.m_end;
+      compacted.Append(item.first, value->data(), static_cast<u32>(value->size()));
+      if (compacted.m_end == previous_end)
+        return fail();
+    }
+
+    if (!compacted.WriteIndex() || !compacted.m_file.Flush())
+      return fail();
+    source.m_mapping.Unmap();
+    source.m_file.Close();
+    if (!File::Rename(compacted.m_file, temp_filename, filename))
+      return fail();
+    return true;
+  }
+
+private:
+  static_assert(std::is_trivially_copyable_v<K>, "K must be a trivially copyable type");
+  static_assert(std::is_trivially_copyable_v<V>, "V must be a trivially copyable type");
+  static_assert(alignof(V) == 1, "Values are used in place in the mapped file");
+
+  static constexpr u32 HEADER_ID = 0x58494344;  // DCIX
+  static constexpr u32 RECORD_TAG = 0x44434552;  // RECD
+  static constexpr u32 INDEX_TAG = 0x58444E49;   // INDX
+  static constexpr size_t VERSION_SIZE = 40;
+  static constexpr u64 INDEX_OFFSET_POSITION = sizeof(u32) + 2 * sizeof(u16) + VERSION_SIZE;
+  static constexpr u64 HEADER_SIZE = INDEX_OFFSET_POSITION + sizeof(u64);
+  // The tag and the value size or number of entries
+  static constexpr u64 BLOCK_HEADER_SIZE = 2 * sizeof(u32);
+  static constexpr u64 RECORD_HEADER_SIZE = BLOCK_HEADER_SIZE + sizeof(K);
+  static constexpr u64 INDEX_ENTRY_SIZE = sizeof(K) + sizeof(u64) + sizeof(u32);
+
+  struct Entry
+  {
+    u64 value_offset;
+    u32 value_size;
+    // Values which aren't in the mapped part of the file are read into memory.
+    std::unique_ptr<V[]> appended_value;
+  };
+
+  struct KeyHash
+  {
+    size_t operator()(const K& key) const
+    {
+      return static_cast<size_t>(GetXXH3Hash64(reinterpret_cast<const u8*>(&key), sizeof(K)));
+    }
+  };
+  struct KeyEqual
+  {
+    bool operator()(const K& a, const K& b) const { return std::memcmp(&a, &b, sizeof(K)) == 0; }
+  };
+
+  template <typename T>
+  static u8* WriteField(u8* ptr, const T& value)
+  {
+    std::memcpy(ptr, &value, sizeof(T));
+    return ptr + sizeof(T);
+  }
+
+  template <typename T>
+  static const u8* ReadField(const u8* ptr, T* value)
+  {
+    std::memcpy(value, ptr, sizeof(T));
+    return ptr + sizeof(T);
+  }
+
+  static std::array<u8, HEADER_SIZE> MakeHeader(u64 index_offset)
+  {
+    std::array<u8, HEADER_SIZE> header{};
+    u8* ptr = header.data();
+    ptr = WriteField(ptr, HEADER_ID);
+    ptr = WriteField(ptr, static_cast<u16>(sizeof(K)));
+    ptr = WriteField(ptr, static_cast<u16>(sizeof(V)));
+    // Null-terminator is intentionally not copied.
+    const std::string& version = GetScmRevGitStr();
+    std::memcpy(ptr, version.data(), std::min(version.size(), VERSION_SIZE));
+    ptr += VERSION_SIZE;
+    WriteField(ptr, index_offset);
+    return header;
+  }
+
+  // Reads from the mapping if possible, as that doesn't copy more than what is asked for.
+  bool ReadAt(u64 offset, u8* out_ptr, u64 size)
+  {
+    const std::span<const u8> mapped_data = m_mapping.GetData();
+    if (offset + size <= mapped_data.size())
+    {
+      std::memcpy(out_ptr, mapped_data.data() + offset, size);
+      return true;
+    }
+    return m_file.OffsetRead(offset, out_ptr, size);
+  }
+
+  void Reset()
+  {
+    m_mapping.Unmap();
+    m_file.Close();
+    m_entries.clear();
+    m_replaced_values.clear();
+    m_end = 0;
+    m_index_dirty = false;
+  }
+
+  bool CreateEmpty(const std::string& filename)
+  {
+    const std::array<u8, HEADER_SIZE> header = MakeHeader(0);
+    if (!m_file.Open(filename, File::AccessMode::ReadAndWrite, File::OpenMode::Truncate) ||
+        !m_file.OffsetWrite(0, header.data(), header.size()))
+    {
+      return false;
+    }
+
+    m_end = HEADER_SIZE;
+    return true;
+  }
+
+  bool OpenExisting(const std::string& filename)
+  {
+    if (!m_file.Open(filename, File::AccessMode::ReadAndWrite, File::OpenMode::Existing))
+      return false;
+
+    const u64 file_size = m_file.GetSize();
+    std::array<u8, HEADER_SIZE> header;
+    if (file_size < HEADER_SIZE || !m_file.OffsetRead(0, header.data(), header.size()))
+      return false;
+
+    // Everything but the index offset has to match.
+    u64 index_offset;
+    ReadField(&header[INDEX_OFFSET_POSITION], &index_offset);
+    if (header != MakeHeader(index_offset))
+      return false;
+
+    // Without a mapping, values are read from the file when they are looked up.
+    m_mapping.Map(m_file, file_size);
+
+    u64 position = HEADER_SIZE;
+    if (index_offset != 0)
+    {
+      const std::optional<u64> index_end = ReadIndex(index_offset, file_size);
+      if (index_end)
+      {
+        position = *index_end;
+      }
+      else
+      {
+        WARN_LOG_FMT(COMMON, "Index of {} is invalid, reading all records", filename);
+        m_entries.clear();
+      }
+    }
+
+    const u64 records_start = position;
+    ScanRecords(&position, file_size);
+    m_end = position;
+
+    // Records after the index weren't indexed yet.
+    m_index_dirty = m_end != records_start;
+
+    // Drop what is left of a record or index which wasn't written completely. Windows can't
+    // shrink a file while it is mapped.
+    if (m_end != file_size)
+    {
+      m_mapping.Unmap();
+      if (!File::Resize(m_file, m_end))
+        return false;
+      m_mapping.Map(m_file, m_end);
+    }
+
+    return true;
+  }
+
+  // Returns the end of the index.
+  std::optional<u64> ReadIndex(u64 offset, u64 file_size)
+  {
+    u8 index_header[BLOCK_HEADER_SIZE];
+    if (offset < HEADER_SIZE || offset + BLOCK_HEADER_SIZE > file_size ||
+        !ReadAt(offset, index_header, sizeof(index_header)))
+    {
+      return std::nullopt;
+    }
+
+    u32 tag;
+    u32 num_entries;
+    ReadField(ReadField(index_header, &tag), &num_entries);
+    const u64 index_end = offset + BLOCK_HEADER_SIZE + u64{num_entries} * INDEX_ENTRY_SIZE;
+    if (tag != INDEX_TAG || index_end > file_size)
+      return std::nullopt;
+
+    std::vector<u8> index_data(index_end - offset - BLOCK_HEADER_SIZE);
+    if (!ReadAt(offset + BLOCK_HEADER_SIZE, index_data.data(), index_data.size()))
+      return std::nullopt;
+
+    m_entries.reserve(num_entries);
+    const u8* ptr = index_data.data();
+    for (u32 i = 0; i < num_entries; ++i)
+    {
+      K key;
+      u64 value_offset;
+      u32 value_size;
+      ptr = ReadField(ReadField(ReadField(ptr, &key), &value_offset), &value_size);
+      if (value_offset < HEADER_SIZE || value_offset + u64{value_size} * sizeof(V) > offset)
+        return std::nullopt;
+
+      m_entries.insert_or_assign(key, Entry{value_offset, value_size, nullptr});
+    }
+
+    return index_end;
+  }
+
+  // Stops at the first block which isn't complete.
+  void ScanRecords(u64* position, u64 file_size)
+  {
+    u8 block_header[BLOCK_HEADER_SIZE];
+    while (*position + BLOCK_HEADER_SIZE <= file_size &&
+           ReadAt(*position, block_header, BLOCK_HEADER_SIZE))
+    {
+      u32 tag;
+      u32 size;
+      ReadField(ReadField(block_header, &tag), &size);
+
+      if (tag == RECORD_TAG)
+      {
+        const u64 record_end = *position + RECORD_HEADER_SIZE + u64{size} * sizeof(V);
+        K key;
+        if (record_end > file_size ||
+            !ReadAt(*position + BLOCK_HEADER_SIZE, reinterpret_cast<u8*>(&key), sizeof(K)))
+        {
+          return;
+        }
+
+        m_entries.insert_or_assign(key, Entry{*position + RECORD_HEADER_SIZE, size, nullptr});
+        *position = record_end;
+      }
+      else if (tag == INDEX_TAG)
+      {
+        // An index written by an earlier session, whose records we have already seen.
+        const u64 index_end = *position + BLOCK_HEADER_SIZE + u64{size} * INDEX_ENTRY_SIZE;
+        if (index_end > file_size)
+          return;
+        *position = index_end;
+      }
+      else
+      {
+        return;
+      }
+    }
+  }
+
+  bool WriteIndex()
+  {
+    std::vector<u8> index(BLOCK_HEADER_SIZE + m_entries.size() * INDEX_ENTRY_SIZE);
+    u8* ptr = index.data();
+    ptr = WriteField(ptr, INDEX_TAG);
+    ptr = WriteField(ptr, static_cast<u32>(m_entries.size()));
+    for (const auto& [key, entry] : m_entries)
+      ptr = WriteField(WriteField(WriteField(ptr, key), entry.value_offset), entry.value_size);
+
+    // The header is only updated once the index is complete.
+    const std::array<u8, HEADER_SIZE> header = MakeHeader(m_end);
+    const bool written = m_file.OffsetWrite(m_end, index.data(), index.size()) && m_file.Flush() &&
+                         m_file.OffsetWrite(0, header.data(), header.size());
+
+    m_end += index.size();
+    m_index_dirty = false;
+    return written;
+  }
+
+  // Compacting only pays off when it frees a lot of space.
+  bool IsMostlyWasted() const
+  {
+    constexpr u64 MIN_WASTED_BYTES = 1024 * 1024;
+
+    u64 live_bytes = HEADER_SIZE + BLOCK_HEADER_SIZE;
+    for (const auto& item : m_entries)
+      live_bytes += RECORD_HEADER_SIZE + INDEX_ENTRY_SIZE + u64{item.second.value_size} * sizeof(V);
+
+    const u64 wasted_bytes = m_end - std::min(live_bytes, m_end);
+    return wasted_bytes >= MIN_WASTED_BYTES && wasted_bytes > m_end / 2;
+  }
+
+  File::DirectIOFile m_file;
+  File::ReadOnlyFileMapping m_mapping;
+  std::unordered_map<K, Entry, KeyHash, KeyEqual> m_entries;
+  std::vector<std::unique_ptr<V[]>> m_replaced_values;
+  u64 m_end = 0;
+  bool m_index_dirty = false;
+  mutable std::mutex m_mutex;
+};
+}  // namespace Common
@@ -27,11 +27,17 @@
  */
 
 #include <x86intrin.h>
+#ifndef __AVX512F__
+#define FUNCTION_TARGET_AVX512F [[gnu::target("avx512f")]]
+#endif
+#ifndef __AVX2__
+#define FUNCTION_TARGET_AVX2 [[gnu::target("avx2")]]
+#endif
 #ifndef __SSE4_2__
 #define FUNCTION_TARGET_SSE42 [[gnu::target("sse4.2")]]
 #endif
 #ifndef __SSE4_1__
-#define FUNCTION_TARGET_SSR41 [[gnu::target("sse4.1")]]
+#define FUNCTION_TARGET_SSE41 [[gnu::target("sse4.1")]]
 #endif
 #ifndef __SSSE3__
 #define FUNCTION_TARGET_SSSE3 [[gnu::target("ssse3")]]
@@ -57,11 +63,17 @@
  * version without the macro around a #ifdef guard. Be careful when using intrinsics, as all use
  * should still be placed around a #ifdef _M_X86_64 if the file is compiled on all architectures.
  */
+#ifndef FUNCTION_TARGET_AVX512F
+#define FUNCTION_TARGET_AVX512F
+#endif
+#ifndef FUNCTION_TARGET_AVX2
+#define FUNCTION_TARGET_AVX2
+#endif
 #ifndef FUNCTION_TARGET_SSE42
 #define FUNCTION_TARGET_SSE42
 #endif
-#ifndef FUNCTION_TARGET_SSR41
-#define FUNCTION_TARGET_SSR41
+#ifndef FUNCTION_TARGET_SSE41
+#define FUNCTION_TARGET_SSE41
 #endif
 #ifndef FUNCTION_TARGET_SSSE3
 #define FUNCTION_TARGET_SSSE3
@@ -22,6 +22,7 @@
 #include "Core/AchievementManager.h"
 #include "Core/Config/DefaultLocale.h"
 #include "Core/Core.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
 #include "Core/HW/EXI/EXI.h"
 #include "Core/HW/EXI/EXI_Device.h"
 #include "Core/HW/GCMemcard/GCMemcard.h"
@@ -30,6 +31,7 @@
 #include "Core/HW/SI/SI_Device.h"
 #include "Core/IOS/Network/Socket.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/State.h"
 #include "Core/System.h"
 #include "Core/USBUtils.h"
 #include "DiscIO/Enums.h"
@@ -43,6 +45,8 @@ const Info<bool> MAIN_SKIP_IPL{{System::Main, "Core", "SkipIPL"}, true};
 const Info<PowerPC::CPUCore> MAIN_CPU_CORE{{System::Main, "Core", "CPUCore"},
                                            PowerPC::DefaultCPUCore()};
 const Info<bool> MAIN_JIT_FOLLOW_BRANCH{{System::Main, "Core", "JITFollowBranch"}, true};
+const Info<bool> MAIN_JIT_WARM_START_CACHE{{System::Main, "Core", "JITWarmStartCache"}, false};
+const Info<bool> MAIN_JIT_TRACE_TIER{{System::Main, "Core", "JITTraceTier"}, false};
 const Info<bool> MAIN_FASTMEM{{System::Main, "Core", "Fastmem"}, true};
 const Info<bool> MAIN_PAGE_TABLE_FASTMEM{{System::Main, "Core", "PageTableFastmem"}, true};
 const Info<bool> MAIN_FASTMEM_ARENA{{System::Main, "Core", "FastmemArena"}, true};
@@ -64,6 +68,8 @@ constexpr bool DEFAULT_CPU_THREAD = false;
 #endif
 const Info<bool> MAIN_CPU_THREAD{{System::Main, "Core", "CPUThread"}, DEFAULT_CPU_THREAD};
 const Info<bool> MAIN_LOAD_GAME_INTO_MEMORY{{System::Main, "Core", "LoadGameIntoMemory"}, false};
+const Info<int> MAIN_DISC_BLOCK_CACHE_SIZE{{System::Main, "Core", "DiscBlockCacheSize"}, 64};
+const Info<int> MAIN_DISC_READ_AHEAD_THREADS{{System::Main, "Core", "DiscReadAheadThreads"}, 2};
 const Info<bool> MAIN_SYNC_ON_SKIP_IDLE{{System::Main, "Core", "SyncOnSkipIdle"}, true};
 const Info<std::string> MAIN_DEFAULT_ISO{{System::Main, "Core", "DefaultISO"}, ""};
 const Info<bool> MAIN_ENABLE_CHEATS{{System::Main, "Core", "EnableCheats"}, false};
@@ -77,6 +83,8 @@ const Info<int> MAIN_AUDIO_LATENCY{{System::Main, "Core", "AudioLatency"}, 20};
 const Info<int> MAIN_AUDIO_BUFFER_SIZE{{System::Main, "Core", "AudioBufferSize"}, 80};
 const Info<bool> MAIN_AUDIO_FILL_GAPS{{System::Main, "Core", "AudioFillGaps"}, true};
 const Info<bool> MAIN_AUDIO_PRESERVE_PITCH{{System::Main, "Core", "AudioPreservePitch"}, false};
+const Info<AudioCommon::ResamplingQuality> MAIN_AUDIO_RESAMPLING_QUALITY{
+    {System::Main, "Core", "AudioResamplingQuality"}, AudioCommon::ResamplingQuality::Low};
 const Info<std::string> MAIN_MEMCARD_A_PATH{{System::Main, "Core", "MemcardAPath"}, ""};
 const Info<std::string> MAIN_MEMCARD_B_PATH{{System::Main, "Core", "MemcardBPath"}, ""};
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot)
@@ -282,6 +290,12 @@ const Info<DiscIO::Region> MAIN_FALLBACK_REGION{{System::Main, "Core", "Fallback
 const Info<bool> MAIN_AUTO_DISC_CHANGE{{System::Main, "Core", "AutoDiscChange"}, false};
 const Info<bool> MAIN_ALLOW_SD_WRITES{{System::Main, "Core", "WiiSDCardAllowWrites"}, true};
 const Info<bool> MAIN_ENABLE_SAVESTATES{{System::Main, "Core", "EnableSaveStates"}, false};
+const Info<State::CompressionType> MAIN_SAVESTATE_COMPRESSION{
+    {System::Main, "Core", "SaveStateCompression"}, State::CompressionType::ChunkedLZ4};
+const Info<int> MAIN_SAVESTATE_ZSTD_LEVEL{{System::Main, "Core", "SaveStateZstdLevel"}, 3};
+const Info<bool> MAIN_REWIND_ENABLED{{System::Main, "Core", "RewindEnabled"}, false};
+const Info<u32> MAIN_REWIND_INTERVAL_FRAMES{{System::Main, "Core", "RewindIntervalFrames"}, 30};
+const Info<u32> MAIN_REWIND_MEMORY_BUDGET_MB{{System::Main, "Core", "RewindMemoryBudgetMB"}, 512};
 const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS{
     {System::Main, "Core", "RealWiiRemoteRepeatReports"}, true};
 const Info<bool> MAIN_WII_WIILINK_ENABLE{{System::Main, "Core", "EnableWiiLink"}, false};
@@ -309,6 +323,7 @@ const Info<bool> MAIN_DISABLE_SCREENSAVER{{System::Main, "Display", "DisableScre
 const Info<bool> MAIN_DSP_THREAD{{System::Main, "DSP", "DSPThread"}, false};
 const Info<bool> MAIN_DSP_CAPTURE_LOG{{System::Main, "DSP", "CaptureLog"}, false};
 const Info<bool> MAIN_DSP_JIT{{System::Main, "DSP", "EnableJIT"}, true};
+const Info<int> MAIN_DSP_HLE_VOICE_THREADS{{System::Main, "DSP", "HLEVoiceThreads"}, 0};
 const Info<bool> MAIN_DUMP_AUDIO{{System::Main, "DSP", "DumpAudio"}, false};
 const Info<bool> MAIN_DUMP_AUDIO_SILENT{{System::Main, "DSP", "DumpAudioSilent"}, false};
 const Info<bool> MAIN_DUMP_UCODE{{System::Main, "DSP", "DumpUCode"}, false};
@@ -508,6 +523,8 @@ const Info<bool> MAIN_GAMELIST_COLUMN_TAGS{{System::Main, "GameList", "ColumnTag
 const Info<bool> MAIN_FIFOPLAYER_LOOP_REPLAY{{System::Main, "FifoPlayer", "LoopReplay"}, true};
 const Info<bool> MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES{
     {System::Main, "FifoPlayer", "EarlyMemoryUpdates"}, false};
+const Info<FifoCompression> MAIN_FIFOPLAYER_COMPRESSION{{System::Main, "FifoPlayer", "Compression"},
+                                                        FifoCompression::None};
 
 // Main.AutoUpdate
 
@@ -31,6 +31,7 @@ enum class CPUCore;
 namespace AudioCommon
 {
 enum class DPL2Quality;
+enum class ResamplingQuality;
 }
 
 namespace ExpansionInterface
@@ -49,6 +50,13 @@ namespace HSP
 enum class HSPDeviceType : int;
 }
 
+namespace State
+{
+enum CompressionType : u16;
+}
+
+enum class FifoCompression : u8;
+
 namespace Config
 {
 // Main.Core
@@ -56,6 +64,8 @@ namespace Config
 extern const Info<bool> MAIN_SKIP_IPL;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
+extern const Info<bool> MAIN_JIT_WARM_START_CACHE;
+extern const Info<bool> MAIN_JIT_TRACE_TIER;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_PAGE_TABLE_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
@@ -70,6 +80,9 @@ extern const Info<bool> MAIN_RUSH_FRAME_PRESENTATION;
 extern const Info<bool> MAIN_SMOOTH_EARLY_PRESENTATION;
 extern const Info<bool> MAIN_CPU_THREAD;
 extern const Info<bool> MAIN_LOAD_GAME_INTO_MEMORY;
+// In MiB
+extern const Info<int> MAIN_DISC_BLOCK_CACHE_SIZE;
+extern const Info<int> MAIN_DISC_READ_AHEAD_THREADS;
 extern const Info<bool> MAIN_SYNC_ON_SKIP_IDLE;
 extern const Info<std::string> MAIN_DEFAULT_ISO;
 extern const Info<bool> MAIN_ENABLE_CHEATS;
@@ -81,6 +94,7 @@ extern const Info<int> MAIN_AUDIO_LATENCY;
 extern const Info<int> MAIN_AUDIO_BUFFER_SIZE;
 extern const Info<bool> MAIN_AUDIO_FILL_GAPS;
 extern const Info<bool> MAIN_AUDIO_PRESERVE_PITCH;
+extern const Info<AudioCommon::ResamplingQuality> MAIN_AUDIO_RESAMPLING_QUALITY;
 extern const Info<std::string> MAIN_MEMCARD_A_PATH;
 extern const Info<std::string> MAIN_MEMCARD_B_PATH;
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot);
@@ -163,6 +177,11 @@ extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+extern const Info<State::CompressionType> MAIN_SAVESTATE_COMPRESSION;
+extern const Info<int> MAIN_SAVESTATE_ZSTD_LEVEL;
+extern const Info<bool> MAIN_REWIND_ENABLED;
+extern const Info<u32> MAIN_REWIND_INTERVAL_FRAMES;
+extern const Info<u32> MAIN_REWIND_MEMORY_BUDGET_MB;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
@@ -174,6 +193,9 @@ extern const Info<bool> MAIN_WII_WIILINK_ENABLE;
 extern const Info<bool> MAIN_DSP_THREAD;
 extern const Info<bool> MAIN_DSP_CAPTURE_LOG;
 extern const Info<bool> MAIN_DSP_JIT;
+// Worker threads rendering the voices of the AX ucodes with DSP HLE. 0 renders them on the
+// emulation thread.
+extern const Info<int> MAIN_DSP_HLE_VOICE_THREADS;
 extern const Info<bool> MAIN_DUMP_AUDIO;
 extern const Info<bool> MAIN_DUMP_AUDIO_SILENT;
 extern const Info<bool> MAIN_DUMP_UCODE;
@@ -319,6 +341,7 @@ extern const Info<bool> MAIN_GAMELIST_COLUMN_TAGS;
 
 extern const Info<bool> MAIN_FIFOPLAYER_LOOP_REPLAY;
 extern const Info<bool> MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES;
+extern const Info<FifoCompression> MAIN_FIFOPLAYER_COMPRESSION;
 
 // Main.AutoUpdate
 
@@ -159,6 +159,8 @@ void OnFrameEnd(Core::System& system)
     s_memory_watcher->Step(guard);
   }
 #endif
+
+  State::OnFrameEnd(system);
 }
 
 // Display messages and return values
@@ -390,6 +392,8 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   s_memory_watcher.reset();
 #endif
 
+  // Nothing can handle the faults caused by dirty page tracking once the handler is gone.
+  system.GetMemory().StopDirtyPageTracking();
   if (exception_handler)
     EMM::UninstallExceptionHandler();
 
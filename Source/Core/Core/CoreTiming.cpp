@@ -40,6 +40,206 @@ static void EmptyTimedCallback(Core::System& system, u64 userdata, s64 cyclesLat
 {
 }
 
+Event EventQueue::Pop()
+{
+  const u32 slot = m_heap.front();
+  const Event event = m_slots[slot].event;
+  RemoveAt(0);
+  FreeSlot(slot);
+  return event;
+}
+
+EventHandle EventQueue::Push(const Event& event)
+{
+  const u32 slot = AllocateSlot();
+  Slot& entry = m_slots[slot];
+  entry.event = event;
+
+  // Link the event into the list of its type.
+  entry.prev_of_type = INVALID_EVENT_SLOT;
+  entry.next_of_type = event.type->first_queued_slot;
+  if (entry.next_of_type != INVALID_EVENT_SLOT)
+    m_slots[entry.next_of_type].prev_of_type = slot;
+  event.type->first_queued_slot = slot;
+
+  m_heap.push_back(slot);
+  SetHeapEntry(m_heap.size() - 1, slot);
+  SiftUp(m_heap.size() - 1);
+  return EventHandle{slot, entry.generation};
+}
+
+bool EventQueue::IsQueued(EventHandle handle) const
+{
+  return handle.slot < m_slots.size() && m_slots[handle.slot].generation == handle.generation &&
+         m_slots[handle.slot].heap_index != INVALID_EVENT_SLOT;
+}
+
+bool EventQueue::Remove(EventHandle handle)
+{
+  if (!IsQueued(handle))
+    return false;
+
+  RemoveAt(m_slots[handle.slot].heap_index);
+  FreeSlot(handle.slot);
+  return true;
+}
+
+bool EventQueue::Reschedule(EventHandle handle, s64 time, u64 fifo_order)
+{
+  if (!IsQueued(handle))
+    return false;
+
+  Slot& entry = m_slots[handle.slot];
+  entry.event.time = time;
+  entry.event.fifo_order = fifo_order;
+  // The event can only have moved later in the FIFO order, but its time may go either way.
+  SiftUp(entry.heap_index);
+  SiftDown(entry.heap_index);
+  return true;
+}
+
+std::size_t EventQueue::RemoveAll(EventType* type)
+{
+  std::size_t removed = 0;
+  while (type->first_queued_slot != INVALID_EVENT_SLOT)
+  {
+    const u32 slot = type->first_queued_slot;
+    RemoveAt(m_slots[slot].heap_index);
+    FreeSlot(slot);
+    ++removed;
+  }
+  return removed;
+}
+
+void EventQueue::Clear()
+{
+  while (!m_heap.empty())
+  {
+    const u32 slot = m_heap.back();
+    m_heap.pop_back();
+    FreeSlot(slot);
+  }
+}
+
+std::vector<Event> EventQueue::GetEvents() const
+{
+  std::vector<Event> events;
+  events.reserve(m_heap.size());
+  for (const u32 slot : m_heap)
+    events.push_back(m_slots[slot].event);
+  return events;
+}
+
+void EventQueue::Assign(std::vector<Event> events)
+{
+  Clear();
+  for (const Event& event : events)
+  {
+    // Pushing one by one would be O(n log n), so only link the slots here and build the heap
+    // afterwards.
+    const u32 slot = AllocateSlot();
+    Slot& entry = m_slots[slot];
+    entry.event = event;
+    entry.prev_of_type = INVALID_EVENT_SLOT;
+    entry.next_of_type = event.type->first_queued_slot;
+    if (entry.next_of_type != INVALID_EVENT_SLOT)
+      m_slots[entry.next_of_type].prev_of_type = slot;
+    event.type->first_queued_slot = slot;
+
+    m_heap.push_back(slot);
+    entry.heap_index = static_cast<u32>(m_heap.size() - 1);
+  }
+  Heapify();
+}
+
+u32 EventQueue::AllocateSlot()
+{
+  if (m_free_slots.empty())
+  {
+    m_slots.push_back(Slot{{}, INVALID_EVENT_SLOT, 0, INVALID_EVENT_SLOT, INVALID_EVENT_SLOT});
+    return static_cast<u32>(m_slots.size() - 1);
+  }
+
+  const u32 slot = m_free_slots.back();
+  m_free_slots.pop_back();
+  return slot;
+}
+
+void EventQueue::FreeSlot(u32 slot)
+{
+  Slot& entry = m_slots[slot];
+
+  if (entry.prev_of_type != INVALID_EVENT_SLOT)
+    m_slots[entry.prev_of_type].next_of_type = entry.next_of_type;
+  else
+    entry.event.type->first_queued_slot = entry.next_of_type;
+  if (entry.next_of_type != INVALID_EVENT_SLOT)
+    m_slots[entry.next_of_type].prev_of_type = entry.prev_of_type;
+
+  entry.heap_index = INVALID_EVENT_SLOT;
+  // Invalidates all handles to the event.
+  ++entry.generation;
+  m_free_slots.push_back(slot);
+}
+
+// Takes the event at the given heap position out of the heap, without freeing its slot.
+void EventQueue::RemoveAt(std::size_t heap_index)
+{
+  const u32 last_slot = m_heap.back();
+  m_heap.pop_back();
+  if (heap_index == m_heap.size())
+    return;
+
+  SetHeapEntry(heap_index, last_slot);
+  SiftUp(heap_index);
+  SiftDown(m_slots[last_slot].heap_index);
+}
+
+void EventQueue::SetHeapEntry(std::size_t heap_index, u32 slot)
+{
+  m_heap[heap_index] = slot;
+  m_slots[slot].heap_index = static_cast<u32>(heap_index);
+}
+
+void EventQueue::SiftUp(std::size_t heap_index)
+{
+  const u32 slot = m_heap[heap_index];
+  while (heap_index > 0)
+  {
+    const std::size_t parent = (heap_index - 1) / 2;
+    if (!(m_slots[slot].event < m_slots[m_heap[parent]].event))
+      break;
+    SetHeapEntry(heap_index, m_heap[parent]);
+    heap_index = parent;
+  }
+  SetHeapEntry(heap_index, slot);
+}
+
+void EventQueue::SiftDown(std::size_t heap_index)
+{
+  const u32 slot = m_heap[heap_index];
+  const std::size_t size = m_heap.size();
+  while (true)
+  {
+    std::size_t child = heap_index * 2 + 1;
+    if (child >= size)
+      break;
+    if (child + 1 < size && m_slots[m_heap[child + 1]].event < m_slots[m_heap[child]].event)
+      ++child;
+    if (!(m_slots[m_heap[child]].event < m_slots[slot].event))
+      break;
+    SetHeapEntry(heap_index, m_heap[child]);
+    heap_index = child;
+  }
+  SetHeapEntry(heap_index, slot);
+}
+
+void EventQueue::Heapify()
+{
+  for (std::size_t i = m_heap.size() / 2; i-- > 0;)
+    SiftDown(i);
+}
+
 CoreTimingManager::CoreTimingManager(Core::System& system) : m_system(system)
 {
 }
@@ -129,6 +329,7 @@ void CoreTimingManager::Shutdown()
   std::lock_guard lk(m_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
+  m_after_events_jobs.clear();
   UnregisterAllEvents();
   CPUThreadConfigCallback::RemoveConfigChangedCallback(m_registered_config_callback_id);
   m_frame_hook.reset();
@@ -186,7 +387,10 @@ void CoreTimingManager::DoState(PointerWrap& p)
   p.DoMarker("CoreTimingData");
 
   MoveEvents();
-  p.DoEachElement(m_event_queue, [this](PointerWrap& pw, Event& ev) {
+  std::vector<Event> events;
+  if (!p.IsReadMode())
+    events = m_event_queue.GetEvents();
+  p.DoEachElement(events, [this](PointerWrap& pw, Event& ev) {
     pw.Do(ev.time);
     pw.Do(ev.fifo_order);
 
@@ -224,7 +428,7 @@ void CoreTimingManager::DoState(PointerWrap& p)
     // When loading from a save state, we must assume the Event order is random and meaningless.
     // The exact layout of the heap in memory is implementation defined, therefore it is platform
     // and library version specific.
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
+    m_event_queue.Assign(std::move(events));
 
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
@@ -252,11 +456,11 @@ u64 CoreTimingManager::GetIdleTicks() const
 
 void CoreTimingManager::ClearPendingEvents()
 {
-  m_event_queue.clear();
+  m_event_queue.Clear();
 }
 
-void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
-                                      FromThread from)
+EventHandle CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_type,
+                                             u64 userdata, FromThread from)
 {
   ASSERT_MSG(POWERPC, event_type, "Event type is nullptr, will crash now.");
 
@@ -281,8 +485,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
     if (!m_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    return m_event_queue.Push(Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -296,19 +499,31 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
 
     std::lock_guard lk(m_ts_write_lock);
     m_ts_queue.Push(Event{cycles_into_future, 0, userdata, event_type});
+    return {};
   }
 }
 
 void CoreTimingManager::RemoveEvent(EventType* event_type)
 {
-  const size_t erased =
-      std::erase_if(m_event_queue, [&](const Event& e) { return e.type == event_type; });
+  m_event_queue.RemoveAll(event_type);
+}
 
-  // Removing random items breaks the invariant so we have to re-establish it.
-  if (erased != 0)
-  {
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
-  }
+bool CoreTimingManager::RemoveEvent(EventHandle handle)
+{
+  return m_event_queue.Remove(handle);
+}
+
+bool CoreTimingManager::RescheduleEvent(EventHandle handle, s64 cycles_into_future)
+{
+  const s64 timeout = GetTicks() + cycles_into_future;
+  if (!m_event_queue.Reschedule(handle, timeout, m_event_fifo_id))
+    return false;
+  ++m_event_fifo_id;
+
+  // If this event needs to run before the next advance(), force one early
+  if (!m_is_global_timer_sane)
+    ForceExceptionCheck(cycles_into_future);
+  return true;
 }
 
 void CoreTimingManager::RemoveAllEvents(EventType* event_type)
@@ -334,13 +549,13 @@ void CoreTimingManager::MoveEvents()
 {
   while (!m_ts_queue.Empty())
   {
-    auto& ev = m_event_queue.emplace_back(m_ts_queue.Front());
+    Event ev = m_ts_queue.Front();
     m_ts_queue.Pop();
 
     ev.fifo_order = m_event_fifo_id++;
     ev.time += m_globals.global_timer;
 
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    m_event_queue.Push(ev);
   }
 }
 
@@ -361,11 +576,9 @@ void CoreTimingManager::Advance()
 
   m_is_global_timer_sane = true;
 
-  while (!m_event_queue.empty() && m_event_queue.front().time <= m_globals.global_timer)
+  while (!m_event_queue.empty() && m_event_queue.Top().time <= m_globals.global_timer)
   {
-    Event evt = m_event_queue.front();
-    std::ranges::pop_heap(m_event_queue, std::ranges::greater{});
-    m_event_queue.pop_back();
+    const Event evt = m_event_queue.Pop();
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
 
@@ -375,7 +588,7 @@ void CoreTimingManager::Advance()
   if (!m_event_queue.empty())
   {
     m_globals.slice_length = static_cast<int>(
-        std::min<s64>(m_event_queue.front().time - m_globals.global_timer, MAX_SLICE_LENGTH));
+        std::min<s64>(m_event_queue.Top().time - m_globals.global_timer, MAX_SLICE_LENGTH));
   }
 
   ppc_state.downcount = CyclesToDowncount(m_globals.slice_length);
@@ -385,6 +598,20 @@ void CoreTimingManager::Advance()
   // until the next slice:
   //        Pokemon Box refuses to boot if the first exception from the audio DMA is received late
   power_pc.CheckExternalExceptions();
+
+  if (!m_after_events_jobs.empty())
+  {
+    // Jobs queued from these run at the next Advance().
+    std::vector<Common::MoveOnlyFunction<void()>> jobs;
+    std::swap(jobs, m_after_events_jobs);
+    for (auto& job : jobs)
+      job();
+  }
+}
+
+void CoreTimingManager::RunAfterEvents(Common::MoveOnlyFunction<void()> function)
+{
+  m_after_events_jobs.push_back(std::move(function));
 }
 
 TimePoint CoreTimingManager::CalculateTargetHostTimeInternal(s64 target_cycle)
@@ -546,7 +773,7 @@ bool CoreTimingManager::UseSyncOnSkipIdle() const
 
 void CoreTimingManager::LogPendingEvents() const
 {
-  auto clone = m_event_queue;
+  auto clone = m_event_queue.GetEvents();
   std::ranges::sort(clone);
   for (const Event& ev : clone)
   {
@@ -564,11 +791,12 @@ void CoreTimingManager::AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clo
 
   m_system.GetPerfMetrics().AdjustClockSpeed(ticks, new_ppc_clock, old_ppc_clock);
 
-  for (Event& ev : m_event_queue)
-  {
-    const s64 ev_ticks = (ev.time - ticks) * new_ppc_clock / old_ppc_clock;
-    ev.time = ticks + ev_ticks;
-  }
+  // Scaling can make events with different times equal, after which the FIFO order decides, so
+  // the queue has to restore its order afterwards.
+  m_event_queue.AdjustTimes([&](s64& time) {
+    const s64 ev_ticks = (time - ticks) * new_ppc_clock / old_ppc_clock;
+    time = ticks + ev_ticks;
+  });
 }
 
 void CoreTimingManager::Idle()
@@ -592,7 +820,7 @@ std::string CoreTimingManager::GetScheduledEventsSummary() const
   std::string text = "Scheduled events\n";
   text.reserve(1000);
 
-  auto clone = m_event_queue;
+  auto clone = m_event_queue.GetEvents();
   std::ranges::sort(clone);
   for (const Event& ev : clone)
   {
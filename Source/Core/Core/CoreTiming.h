@@ -16,6 +16,7 @@
 // inside callback:
 //   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
 
+#include <cstddef>
 #include <mutex>
 #include <string>
 #include <tuple>
@@ -51,10 +52,15 @@ struct Globals
 using TimedCallback =
     Common::MoveOnlyFunction<void(Core::System& system, u64 userdata, s64 cyclesLate)>;
 
+// Marks the end of the intrusive lists kept by EventQueue.
+constexpr u32 INVALID_EVENT_SLOT = 0xFFFFFFFF;
+
 struct EventType
 {
   TimedCallback callback;
   const std::string* name;
+  // First of the queued events of this type. Maintained by EventQueue.
+  u32 first_queued_slot = INVALID_EVENT_SLOT;
 };
 
 struct Event
@@ -75,6 +81,77 @@ struct Event
   }
 };
 
+// Identifies one scheduled event, so that it can be removed or rescheduled without searching the
+// queue. Handles are invalidated once the event runs or is removed, as well as by loading a
+// savestate, so they must not be stored in savestates.
+struct EventHandle
+{
+  u32 slot = INVALID_EVENT_SLOT;
+  u32 generation = 0;
+
+  bool IsValid() const { return slot != INVALID_EVENT_SLOT; }
+};
+
+// A binary min-heap of events which knows where each event is within the heap. Besides taking
+// the earliest event, this allows removing or rescheduling any event in O(log n), given either
+// its handle or its type.
+class EventQueue
+{
+public:
+  bool empty() const { return m_heap.empty(); }
+  std::size_t size() const { return m_heap.size(); }
+
+  const Event& Top() const { return m_slots[m_heap.front()].event; }
+  Event Pop();
+
+  EventHandle Push(const Event& event);
+  // Returns false if the handle's event is no longer queued.
+  bool Remove(EventHandle handle);
+  bool Reschedule(EventHandle handle, s64 time, u64 fifo_order);
+  // Returns the number of events removed.
+  std::size_t RemoveAll(EventType* type);
+  void Clear();
+
+  // Returns all events in heap order.
+  std::vector<Event> GetEvents() const;
+  // Replaces all events. This invalidates all handles.
+  void Assign(std::vector<Event> events);
+
+  // Lets func modify the time of every event, then restores the heap order.
+  template <typename Func>
+  void AdjustTimes(Func func)
+  {
+    for (const u32 slot : m_heap)
+      func(m_slots[slot].event.time);
+    Heapify();
+  }
+
+private:
+  struct Slot
+  {
+    Event event;
+    u32 heap_index;
+    u32 generation;
+    // Intrusive list of the queued events with the same type
+    u32 prev_of_type;
+    u32 next_of_type;
+  };
+
+  bool IsQueued(EventHandle handle) const;
+  u32 AllocateSlot();
+  void FreeSlot(u32 slot);
+  void RemoveAt(std::size_t heap_index);
+
+  void SetHeapEntry(std::size_t heap_index, u32 slot);
+  void SiftUp(std::size_t heap_index);
+  void SiftDown(std::size_t heap_index);
+  void Heapify();
+
+  std::vector<Slot> m_slots;
+  std::vector<u32> m_free_slots;
+  std::vector<u32> m_heap;
+};
+
 enum class FromThread
 {
   CPU,
@@ -117,13 +194,20 @@ public:
   // After the first Advance, the slice lengths and the downcount will be reduced whenever an event
   // is scheduled earlier than the current values (when scheduled from the CPU Thread only).
   // Scheduling from a callback will not update the downcount until the Advance() completes.
-  void ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata = 0,
-                     FromThread from = FromThread::CPU);
+  // Events scheduled from other threads only get queued on the next Advance(), so they return an
+  // invalid handle.
+  EventHandle ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata = 0,
+                            FromThread from = FromThread::CPU);
 
   // We only permit one event of each type in the queue at a time.
   void RemoveEvent(EventType* event_type);
   void RemoveAllEvents(EventType* event_type);
 
+  // These may only be called from the CPU thread. They return false if the event already ran or
+  // was removed. Rescheduling orders the event as if it had been removed and scheduled again.
+  bool RemoveEvent(EventHandle handle);
+  bool RescheduleEvent(EventHandle handle, s64 cycles_into_future);
+
   // Advance must be called at the beginning of dispatcher loops, not the end. Advance() ends
   // the previous timing slice and begins the next one, you must Advance from the previous
   // slice to the current one before executing any cycles. CoreTiming starts in slice -1 so an
@@ -133,6 +217,11 @@ public:
   void Advance();
   void MoveEvents();
 
+  // Queues a function to run on the CPU thread at the end of the current (or, outside of event
+  // callbacks, the next) Advance(). Unlike the event callbacks, it runs once every due event was
+  // processed and rescheduled itself, so the state of the emulated hardware may be saved from it.
+  void RunAfterEvents(Common::MoveOnlyFunction<void()> function);
+
   // Pretend that the main CPU has executed enough cycles to reach the next event.
   void Idle();
 
@@ -182,11 +271,10 @@ private:
   std::unordered_map<std::string, EventType> m_event_types;
 
   // STATE_TO_SAVE
-  // The queue is a min-heap using std::ranges::make_heap/push_heap/pop_heap.
   // We don't use std::priority_queue because we need to be able to serialize, unserialize and
   // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accommodated
   // by the standard adaptor class.
-  std::vector<Event> m_event_queue;
+  EventQueue m_event_queue;
   u64 m_event_fifo_id = 0;
   std::mutex m_ts_write_lock;
 
@@ -205,6 +293,8 @@ private:
 
   EventType* m_ev_lost = nullptr;
 
+  std::vector<Common::MoveOnlyFunction<void()>> m_after_events_jobs;
+
   CPUThreadConfigCallback::ConfigChangedCallbackID m_registered_config_callback_id;
   float m_config_oc_factor = 1.0f;
   float m_config_oc_inv_factor = 1.0f;
@@ -4,13 +4,18 @@
 #include "Core/Debugger/CodeTrace.h"
 
 #include <algorithm>
-#include <chrono>
 #include <regex>
 
 #include "Common/Contains.h"
+#include "Common/GekkoDisassembler.h"
+#include "Common/StringUtil.h"
 #include "Core/Core.h"
 #include "Core/Debugger/PPCDebugInterface.h"
 #include "Core/HW/CPU.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PPCTables.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
@@ -67,6 +72,67 @@ bool CompareMemoryTargetToTracked(const std::string& instr, const u32 mem_target
 void CodeTrace::SetRegTracked(const std::string& reg)
 {
   m_reg_autotrack.push_back(reg);
+  UpdateTrackedRegisterFields();
+}
+
+void CodeTrace::SetMemTracked(u32 address)
+{
+  m_mem_autotrack.insert(address);
+}
+
+// Computing the address directly avoids having to disassemble every instruction.
+std::optional<u32> CodeTrace::GetMemoryTarget(const PowerPC::PowerPCState& ppc_state,
+                                              UGeckoInstruction inst)
+{
+  const GekkoOPInfo* opinfo = PPCTables::GetOpInfo(inst, ppc_state.pc);
+  if (!(opinfo->flags & FL_LOADSTORE))
+    return std::nullopt;
+
+  const u32 base = (opinfo->flags & FL_IN_A0) && inst.RA == 0 ? 0 : ppc_state.gpr[inst.RA];
+  if (opinfo->flags & FL_IN_B)
+    return base + ppc_state.gpr[inst.RB];
+  if (opinfo->type == OpType::LoadPS || opinfo->type == OpType::StorePS)
+    return base + inst.SIMM_12;
+  // lswi and stswi
+  if (inst.OPCD == 31)
+    return base;
+  return base + inst.SIMM_16;
+}
+
+void CodeTrace::UpdateTrackedRegisterFields()
+{
+  m_tracked_register_fields = 0;
+  for (const std::string& reg : m_reg_autotrack)
+  {
+    u32 number;
+    if (reg.size() < 2 || !TryParse(reg.substr(1), &number, 10) || number >= 32)
+    {
+      // Not a register name that can be matched up with an instruction field, so every
+      // instruction has to be checked.
+      m_tracked_register_fields = ~0u;
+      return;
+    }
+    m_tracked_register_fields |= 1u << number;
+  }
+}
+
+bool CodeTrace::MayHitTracked(UGeckoInstruction instruction,
+                              std::optional<u32> memory_target) const
+{
+  // Every register a disassembled instruction names comes from one of these fields, so if none of
+  // them are tracked, TraceLogic would skip the instruction. This is a lot faster than
+  // disassembling it to find out.
+  const u32 fields = (1u << instruction.RD) | (1u << instruction.RA) | (1u << instruction.RB) |
+                     (1u << instruction.RC);
+  if (fields & m_tracked_register_fields)
+    return true;
+
+  if (!memory_target || m_mem_autotrack.empty())
+    return false;
+
+  // Same as CompareMemoryTargetToTracked, for the largest access size
+  const auto it_lower = m_mem_autotrack.lower_bound(*memory_target);
+  return it_lower != m_mem_autotrack.end() && *it_lower - *memory_target < 8;
 }
 
 InstructionAttributes CodeTrace::GetInstructionAttributes(const TraceOutput& instruction) const
@@ -146,7 +212,7 @@ AutoStepResults CodeTrace::AutoStepping(const Core::CPUThreadGuard& guard, bool
   if (m_recording)
     return results;
 
-  TraceOutput pc_instr = SaveCurrentInstruction(guard);
+  const TraceOutput pc_instr = SaveCurrentInstruction(guard);
   const InstructionAttributes instr = GetInstructionAttributes(pc_instr);
 
   // Not an instruction we should start autostepping from (ie branches).
@@ -173,9 +239,6 @@ AutoStepResults CodeTrace::AutoStepping(const Core::CPUThreadGuard& guard, bool
     }
   }
 
-  // Count is important for feedback on how much work was done.
-
-  HitType hit = HitType::SKIP;
   HitType stop_condition = HitType::SAVELOAD;
 
   // Could use bit flags, but I organized it to have decreasing levels of verbosity, so the
@@ -187,30 +250,58 @@ AutoStepResults CodeTrace::AutoStepping(const Core::CPUThreadGuard& guard, bool
   else if (stop_on == AutoStop::Changed)
     stop_condition = HitType::ACTIVE;
 
-  auto& power_pc = guard.GetSystem().GetPowerPC();
-  using clock = std::chrono::steady_clock;
-  clock::time_point timeout = clock::now() + std::chrono::seconds(4);
+  auto& system = guard.GetSystem();
+  auto& power_pc = system.GetPowerPC();
+  auto& jit_interface = system.GetJitInterface();
 
-  PowerPC::CoreMode old_mode = power_pc.GetMode();
-  power_pc.SetMode(PowerPC::CoreMode::Interpreter);
+  UpdateTrackedRegisterFields();
+  m_stop_condition = stop_condition;
+  m_timeout = std::chrono::steady_clock::now() + std::chrono::seconds(4);
+  m_count = 0;
+  m_timed_out = false;
+  m_stopped = false;
 
-  do
+  const PowerPC::CoreMode old_mode = power_pc.GetMode();
+  if (old_mode == PowerPC::CoreMode::JIT && jit_interface.SetCodeTrace(guard, this))
   {
-    power_pc.SingleStep();
+    // The JIT calls TraceInstructionFromJIT before every instruction, starting with the current
+    // one, which was already traced. Each step runs at least a block, until the trace stops.
+    m_skip_next_instruction = true;
+    while (!m_stopped && !m_timed_out)
+    {
+      power_pc.SingleStep();
+      m_timed_out = std::chrono::steady_clock::now() >= m_timeout;
+    }
+    jit_interface.SetCodeTrace(guard, nullptr);
+  }
+  else
+  {
+    power_pc.SetMode(PowerPC::CoreMode::Interpreter);
 
-    pc_instr = SaveCurrentInstruction(guard);
-    hit = TraceLogic(pc_instr);
-    results.count += 1;
-  } while (clock::now() < timeout && hit < stop_condition &&
-           !(m_reg_autotrack.empty() && m_mem_autotrack.empty()));
+    auto& ppc_state = power_pc.GetPPCState();
+    do
+    {
+      power_pc.SingleStep();
+      m_timed_out = std::chrono::steady_clock::now() >= m_timeout;
 
-  // Report the timeout to the caller.
-  if (clock::now() >= timeout)
-    results.timed_out = true;
+      // There is nothing to disassemble outside of RAM, so the instruction can't be a hit.
+      if (!PowerPC::MMU::HostIsRAMAddress(guard, ppc_state.pc))
+      {
+        m_count += 1;
+        continue;
+      }
+      m_stopped = TraceInstruction(
+          ppc_state, UGeckoInstruction{PowerPC::MMU::HostRead_Instruction(guard, ppc_state.pc)});
+    } while (!m_stopped && !m_timed_out);
+
+    power_pc.SetMode(old_mode);
+  }
 
-  power_pc.SetMode(old_mode);
   m_recording = false;
 
+  // Count is important for feedback on how much work was done.
+  results.count = m_count;
+  results.timed_out = m_timed_out;
   results.reg_tracked = m_reg_autotrack;
   results.mem_tracked = m_mem_autotrack;
 
@@ -221,6 +312,43 @@ AutoStepResults CodeTrace::AutoStepping(const Core::CPUThreadGuard& guard, bool
   return results;
 }
 
+bool CodeTrace::TraceInstructionFromJIT(CodeTrace& code_trace,
+                                        const PowerPC::PowerPCState& ppc_state, u32 instruction)
+{
+  if (code_trace.m_skip_next_instruction)
+  {
+    code_trace.m_skip_next_instruction = false;
+    return false;
+  }
+
+  code_trace.m_stopped = code_trace.TraceInstruction(ppc_state, UGeckoInstruction{instruction});
+  return code_trace.m_stopped || code_trace.m_timed_out;
+}
+
+bool CodeTrace::TraceInstruction(const PowerPC::PowerPCState& ppc_state,
+                                 UGeckoInstruction instruction)
+{
+  m_count += 1;
+
+  // Reading the clock takes longer than the rest of this for most instructions.
+  if (m_count % 1024 == 0 && std::chrono::steady_clock::now() >= m_timeout)
+    m_timed_out = true;
+
+  const std::optional<u32> memory_target = GetMemoryTarget(ppc_state, instruction);
+  if (!MayHitTracked(instruction, memory_target))
+    return false;
+
+  TraceOutput output;
+  output.address = ppc_state.pc;
+  output.instruction = Common::GekkoDisassembler::Disassemble(instruction.hex, ppc_state.pc);
+  if (IsInstructionLoadStore(output.instruction))
+    output.memory_target = memory_target;
+
+  const HitType hit = TraceLogic(output);
+  UpdateTrackedRegisterFields();
+  return hit >= m_stop_condition || (m_reg_autotrack.empty() && m_mem_autotrack.empty());
+}
+
 HitType CodeTrace::TraceLogic(const TraceOutput& current_instr, bool first_hit)
 {
   // Tracks the original value that is in the targeted register or memory through loads, stores,
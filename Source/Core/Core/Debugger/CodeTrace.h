@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <set>
 #include <string>
@@ -10,10 +11,16 @@
 
 #include "Common/CommonTypes.h"
 
+union UGeckoInstruction;
+
 namespace Core
 {
 class CPUThreadGuard;
 }
+namespace PowerPC
+{
+struct PowerPCState;
+}
 
 struct InstructionAttributes
 {
@@ -68,15 +75,41 @@ public:
   };
 
   void SetRegTracked(const std::string& reg);
+  void SetMemTracked(u32 address);
   AutoStepResults AutoStepping(const Core::CPUThreadGuard& guard, bool continue_previous = false,
                                AutoStop stop_on = AutoStop::Always);
 
+  // Called by the JIT before every instruction while AutoStepping. Returns true if stepping stops
+  // before the instruction.
+  static bool TraceInstructionFromJIT(CodeTrace& code_trace, const PowerPC::PowerPCState& ppc_state,
+                                      u32 instruction);
+
+  // The address a load or store accesses, computed from the registers before it runs.
+  static std::optional<u32> GetMemoryTarget(const PowerPC::PowerPCState& ppc_state,
+                                            UGeckoInstruction instruction);
+  // False if TraceLogic would skip the instruction, which is checked without disassembling it.
+  // Public for the unit tests, which compare it with TraceLogic.
+  bool MayHitTracked(UGeckoInstruction instruction, std::optional<u32> memory_target) const;
+  HitType TraceLogic(const TraceOutput& current_instr, bool first_hit = false);
+
 private:
   InstructionAttributes GetInstructionAttributes(const TraceOutput& line) const;
   TraceOutput SaveCurrentInstruction(const Core::CPUThreadGuard& guard) const;
-  HitType TraceLogic(const TraceOutput& current_instr, bool first_hit = false);
+  bool TraceInstruction(const PowerPC::PowerPCState& ppc_state, UGeckoInstruction instruction);
+  void UpdateTrackedRegisterFields();
 
   bool m_recording = false;
   std::vector<std::string> m_reg_autotrack;
   std::set<u32> m_mem_autotrack;
+
+  // Bit n is set if a tracked register is numbered n, see MayHitTracked.
+  u32 m_tracked_register_fields = 0;
+
+  // State of the current AutoStepping run
+  HitType m_stop_condition = HitType::SAVELOAD;
+  std::chrono::steady_clock::time_point m_timeout;
+  u32 m_count = 0;
+  bool m_timed_out = false;
+  bool m_stopped = false;
+  bool m_skip_next_instruction = false;
 };
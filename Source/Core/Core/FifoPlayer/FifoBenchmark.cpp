@@ -0,0 +1,152 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/FifoPlayer/FifoBenchmark.h"
+
+#include <utility>
+
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "Core/System.h"
+#include "VideoCommon/VideoEvents.h"
+
+namespace
+{
+Statistics::StageTimes operator+(const Statistics::StageTimes& a, const Statistics::StageTimes& b)
+{
+  return {
+      .fifo_ns = a.fifo_ns + b.fifo_ns,
+      .vertex_loader_ns = a.vertex_loader_ns + b.vertex_loader_ns,
+      .index_generator_ns = a.index_generator_ns + b.index_generator_ns,
+      .pipeline_uid_ns = a.pipeline_uid_ns + b.pipeline_uid_ns,
+      .texture_decode_ns = a.texture_decode_ns + b.texture_decode_ns,
+  };
+}
+
+Statistics::StageTimes operator-(const Statistics::StageTimes& a, const Statistics::StageTimes& b)
+{
+  return {
+      .fifo_ns = a.fifo_ns - b.fifo_ns,
+      .vertex_loader_ns = a.vertex_loader_ns - b.vertex_loader_ns,
+      .index_generator_ns = a.index_generator_ns - b.index_generator_ns,
+      .pipeline_uid_ns = a.pipeline_uid_ns - b.pipeline_uid_ns,
+      .texture_decode_ns = a.texture_decode_ns - b.texture_decode_ns,
+  };
+}
+
+picojson::object ToJson(s64 time_ns, const Statistics::StageTimes& stage_times)
+{
+  picojson::object json;
+  json["time_ns"] = picojson::value(static_cast<double>(time_ns));
+  json["fifo_ns"] = picojson::value(static_cast<double>(stage_times.fifo_ns));
+  json["vertex_loader_ns"] = picojson::value(static_cast<double>(stage_times.vertex_loader_ns));
+  json["index_generator_ns"] =
+      picojson::value(static_cast<double>(stage_times.index_generator_ns));
+  json["pipeline_uid_ns"] = picojson::value(static_cast<double>(stage_times.pipeline_uid_ns));
+  json["texture_decode_ns"] = picojson::value(static_cast<double>(stage_times.texture_decode_ns));
+  return json;
+}
+}  // namespace
+
+FifoBenchmark::FifoBenchmark(Core::System& system, u32 num_loops,
+                             std::function<void()> finished_callback)
+    : m_system(system), m_num_loops(num_loops), m_finished_callback(std::move(finished_callback))
+{
+  g_stats.measure_stage_times = true;
+
+  auto& video_events = system.GetVideoEvents();
+  m_before_frame_hook = video_events.before_frame_event.Register([this] { OnFrameStart(); });
+  m_after_frame_hook =
+      video_events.after_frame_event.Register([this](Core::System&) { OnFrameEnd(); });
+  system.GetFifoPlayer().SetFrameWrittenCallback([this] { OnFrameWritten(); });
+}
+
+FifoBenchmark::~FifoBenchmark()
+{
+  m_system.GetFifoPlayer().SetFrameWrittenCallback(nullptr);
+  g_stats.measure_stage_times = false;
+}
+
+void FifoBenchmark::OnFrameWritten()
+{
+  if (m_frames_per_loop != 0)
+    return;
+
+  const FifoPlayer& fifo_player = m_system.GetFifoPlayer();
+  m_frames_per_loop = fifo_player.GetFrameRangeEnd() - fifo_player.GetFrameRangeStart() + 1;
+}
+
+// A frame normally starts with its first draw, but this is only used for the first frame. From
+// then on, every frame starts where the previous one ended, so that no time is left out.
+void FifoBenchmark::OnFrameStart()
+{
+  if (m_started)
+    return;
+
+  m_started = true;
+  m_frame_start = Clock::now();
+  m_frame_start_times = g_stats.stage_times;
+}
+
+// FifoRecorder ends its frames on the same event, so there is one of these for every frame of the
+// log.
+void FifoBenchmark::OnFrameEnd()
+{
+  if (m_finished)
+    return;
+
+  if (!m_started)
+  {
+    OnFrameStart();
+    return;
+  }
+
+  const Clock::time_point now = Clock::now();
+  const Statistics::StageTimes stage_times = g_stats.stage_times;
+  m_frames.push_back({std::chrono::nanoseconds(now - m_frame_start).count(),
+                      stage_times - m_frame_start_times});
+  m_frame_start = now;
+  m_frame_start_times = stage_times;
+
+  const u32 frames_per_loop = m_frames_per_loop;
+  if (frames_per_loop != 0 && m_frames.size() >= u64{m_num_loops} * frames_per_loop)
+  {
+    m_finished = true;
+    m_finished_callback();
+  }
+}
+
+picojson::value FifoBenchmark::GetResults() const
+{
+  const u32 frames_per_loop = m_frames_per_loop;
+
+  s64 total_time_ns = 0;
+  Statistics::StageTimes total_stage_times;
+  s64 loop_time_ns = 0;
+  Statistics::StageTimes loop_stage_times;
+
+  picojson::array frames;
+  picojson::array loops;
+  for (const Frame& frame : m_frames)
+  {
+    frames.emplace_back(ToJson(frame.time_ns, frame.stage_times));
+
+    total_time_ns += frame.time_ns;
+    total_stage_times = total_stage_times + frame.stage_times;
+    loop_time_ns += frame.time_ns;
+    loop_stage_times = loop_stage_times + frame.stage_times;
+    if (frames_per_loop != 0 && frames.size() % frames_per_loop == 0)
+    {
+      loops.emplace_back(ToJson(loop_time_ns, loop_stage_times));
+      loop_time_ns = 0;
+      loop_stage_times = {};
+    }
+  }
+
+  picojson::object results;
+  results["finished"] = picojson::value(IsFinished());
+  results["frames_per_loop"] = picojson::value(static_cast<double>(frames_per_loop));
+  results["total"] = picojson::value(ToJson(total_time_ns, total_stage_times));
+  results["loops"] = picojson::value(std::move(loops));
+  results["frames"] = picojson::value(std::move(frames));
+  return picojson::value(std::move(results));
+}
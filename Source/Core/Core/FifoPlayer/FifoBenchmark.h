@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+#include "VideoCommon/Statistics.h"
+
+namespace Core
+{
+class System;
+}
+
+// Measures how long each frame of a FIFO log takes the video frontend, and how that time is spent,
+// while FifoPlayer plays the log a given number of times.
+//
+// For reproducible results, emulation speed should be unlimited and the video backend should be
+// one which doesn't depend on the host GPU, like Null or Software.
+class FifoBenchmark
+{
+public:
+  // Has to be created before the FIFO log is booted. finished_callback is called on the GPU thread
+  // once the log has been played num_loops times.
+  FifoBenchmark(Core::System& system, u32 num_loops, std::function<void()> finished_callback);
+  ~FifoBenchmark();
+
+  FifoBenchmark(const FifoBenchmark&) = delete;
+  FifoBenchmark& operator=(const FifoBenchmark&) = delete;
+
+  bool IsFinished() const { return m_finished; }
+
+  // Only valid once emulation has stopped.
+  picojson::value GetResults() const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Frame
+  {
+    s64 time_ns;
+    Statistics::StageTimes stage_times;
+  };
+
+  void OnFrameWritten();
+  void OnFrameStart();
+  void OnFrameEnd();
+
+  Core::System& m_system;
+  const u32 m_num_loops;
+  std::function<void()> m_finished_callback;
+
+  // Set by the CPU thread once the log has been loaded
+  std::atomic<u32> m_frames_per_loop = 0;
+  std::atomic<bool> m_finished = false;
+
+  // Only accessed by the GPU thread while emulation is running
+  bool m_started = false;
+  Clock::time_point m_frame_start;
+  Statistics::StageTimes m_frame_start_times;
+  std::vector<Frame> m_frames;
+
+  Common::EventHook m_before_frame_hook;
+  Common::EventHook m_after_frame_hook;
+};
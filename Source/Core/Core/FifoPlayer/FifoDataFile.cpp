@@ -5,23 +5,38 @@
 
 #include <algorithm>
 #include <cstring>
+#include <filesystem>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
-#include "Common/IOFile.h"
+#include <fmt/format.h>
+#include <lz4.h>
+#include <zstd.h>
+
+#include "Common/Assert.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
 constexpr u32 FILE_ID = 0x0d01f1f0;
-constexpr u32 VERSION_NUMBER = 6;
+constexpr u32 VERSION_NUMBER = 7;
 constexpr u32 MIN_LOADER_VERSION = 1;
 // This value is only used if the DFF file was created with overridden RAM sizes.
 // If the MIN_LOADER_VERSION ever exceeds this, it's alright to remove it.
 constexpr u32 MIN_LOADER_VERSION_FOR_RAM_OVERRIDE = 5;
+// Only used if any frame is compressed. Uncompressed files can still be read by older versions.
+constexpr u32 MIN_LOADER_VERSION_FOR_COMPRESSION = 7;
+
+constexpr int ZSTD_COMPRESSION_LEVEL = 3;
 
 #pragma pack(push, 1)
 
@@ -61,7 +76,11 @@ struct FileFrameInfo
   u32 fifoEnd;
   u64 memoryUpdatesOffset;
   u32 numMemoryUpdates;
-  u8 reserved[32];
+  // Added in version 7. Older versions left these uninitialized.
+  u32 memoryUpdatesSize;
+  u32 compressedSize;
+  u8 compression;
+  u8 reserved[23];
 };
 static_assert(sizeof(FileFrameInfo) == 64, "FileFrameInfo should be 64 bytes");
 
@@ -78,9 +97,105 @@ static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 byt
 
 #pragma pack(pop)
 
+// File layout, as written by FifoDataFile::Save:
+//   FileHeader
+//   Initial state (BP, CP, XF memory, XF registers, TMEM)
+//   For every frame: its data (see FifoDataFile::FrameLocation), then its FileMemoryUpdates
+//   The frame index: a FileFrameInfo for every frame
+// Frames are written as they are recorded, so that the index is the only part which depends on
+// the number of frames.
+constexpr u64 FIRST_FRAME_OFFSET =
+    sizeof(FileHeader) + (FifoDataFile::BP_MEM_SIZE + FifoDataFile::CP_MEM_SIZE +
+                          FifoDataFile::XF_MEM_SIZE + FifoDataFile::XF_REGS_SIZE) *
+                             sizeof(u32) +
+    FifoDataFile::TEX_MEM_SIZE;
+
+namespace
+{
+// Returns an empty vector if the data can't be made any smaller.
+std::vector<u8> Compress(FifoCompression compression, std::span<const u8> data)
+{
+  std::vector<u8> compressed;
+  switch (compression)
+  {
+  case FifoCompression::None:
+    break;
+  case FifoCompression::LZ4:
+    if (data.size() <= LZ4_MAX_INPUT_SIZE)
+    {
+      compressed.resize(LZ4_compressBound(static_cast<int>(data.size())));
+      const int compressed_size = LZ4_compress_default(
+          reinterpret_cast<const char*>(data.data()), reinterpret_cast<char*>(compressed.data()),
+          static_cast<int>(data.size()), static_cast<int>(compressed.size()));
+      compressed.resize(std::max(compressed_size, 0));
+    }
+    break;
+  case FifoCompression::Zstd:
+  {
+    compressed.resize(ZSTD_compressBound(data.size()));
+    const size_t compressed_size = ZSTD_compress(compressed.data(), compressed.size(), data.data(),
+                                                 data.size(), ZSTD_COMPRESSION_LEVEL);
+    compressed.resize(ZSTD_isError(compressed_size) ? 0 : compressed_size);
+    break;
+  }
+  }
+
+  if (compressed.size() >= data.size())
+    compressed.clear();
+  return compressed;
+}
+
+// Checks that src can decompress to size bytes before a buffer is allocated for them, as a corrupt
+// file could claim any size.
+bool CanDecompressTo(FifoCompression compression, std::span<const u8> src, u64 size)
+{
+  switch (compression)
+  {
+  case FifoCompression::LZ4:
+    // A byte of LZ4 data never decompresses to more than 255 bytes.
+    return size <= u64{src.size()} * 255;
+  case FifoCompression::Zstd:
+    // ZSTD_compress stores the size of the data in the frame header.
+    return ZSTD_getFrameContentSize(src.data(), src.size()) == size;
+  default:
+    return false;
+  }
+}
+
+bool Decompress(FifoCompression compression, std::span<const u8> src, std::span<u8> dst)
+{
+  switch (compression)
+  {
+  case FifoCompression::LZ4:
+  {
+    if (src.size() > LZ4_MAX_INPUT_SIZE || dst.size() > std::numeric_limits<int>::max())
+      return false;
+    const int size =
+        LZ4_decompress_safe(reinterpret_cast<const char*>(src.data()),
+                            reinterpret_cast<char*>(dst.data()), static_cast<int>(src.size()),
+                            static_cast<int>(dst.size()));
+    return size >= 0 && static_cast<size_t>(size) == dst.size();
+  }
+  case FifoCompression::Zstd:
+  {
+    const size_t size = ZSTD_decompress(dst.data(), dst.size(), src.data(), src.size());
+    return !ZSTD_isError(size) && size == dst.size();
+  }
+  default:
+    return false;
+  }
+}
+}  // namespace
+
 FifoDataFile::FifoDataFile() = default;
 
-FifoDataFile::~FifoDataFile() = default;
+FifoDataFile::~FifoDataFile()
+{
+  m_mapping.Unmap();
+  m_file.Close();
+  if (!m_temp_path.empty())
+    File::Delete(m_temp_path, File::IfAbsentBehavior::NoConsoleWarning);
+}
 
 bool FifoDataFile::ShouldGenerateFakeVIUpdates()
 {
@@ -102,49 +217,253 @@ bool FifoDataFile::GetIsWii() const
   return GetFlag(FLAG_IS_WII);
 }
 
+std::unique_ptr<FifoDataFile> FifoDataFile::Create(FifoCompression compression)
+{
+  // Recordings can be gigabytes large, so they aren't kept in the system's temporary directory,
+  // which is often in RAM. Keeping them in the user directory also makes it likely that Save can
+  // move them instead of copying them. Other instances of Dolphin may be recording too.
+  const std::string dump_dir = File::GetUserPath(D_DUMP_IDX);
+  File::CreateFullPath(dump_dir);
+
+  auto dataFile = std::make_unique<FifoDataFile>();
+  for (u32 i = 0; !dataFile->m_file.IsOpen(); ++i)
+  {
+    constexpr u32 MAX_ATTEMPTS = 100;
+    if (i == MAX_ATTEMPTS)
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to create a file for the FIFO recording in {}", dump_dir);
+      return nullptr;
+    }
+
+    dataFile->m_path = fmt::format("{}fiforecording{}.dff.tmp", dump_dir, i);
+    dataFile->m_file.Open(dataFile->m_path, File::AccessMode::ReadAndWrite,
+                          File::OpenMode::Create);
+  }
+  dataFile->m_temp_path = dataFile->m_path;
+
+  dataFile->m_Version = VERSION_NUMBER;
+  dataFile->m_compression = compression;
+  dataFile->m_end = FIRST_FRAME_OFFSET;
+  return dataFile;
+}
+
 void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
 {
-  m_Frames.push_back(frameInfo);
+  ASSERT(!m_temp_path.empty());
+
+  FrameLocation location;
+  location.data_offset = m_end;
+  location.fifo_data_size = static_cast<u32>(frameInfo.fifoData.size());
+  location.num_memory_updates = static_cast<u32>(frameInfo.memoryUpdates.size());
+  location.fifo_start = frameInfo.fifoStart;
+  location.fifo_end = frameInfo.fifoEnd;
+
+  // The FIFO data, followed by the data of the memory updates
+  m_write_buffer.assign(frameInfo.fifoData.begin(), frameInfo.fifoData.end());
+  for (const MemoryUpdate& update : frameInfo.memoryUpdates)
+    m_write_buffer.insert(m_write_buffer.end(), update.data.begin(), update.data.end());
+  location.memory_updates_size =
+      static_cast<u32>(m_write_buffer.size() - frameInfo.fifoData.size());
+
+  std::vector<u8> compressed;
+  if (m_write_buffer.size() <= std::numeric_limits<u32>::max())
+    compressed = Compress(m_compression, m_write_buffer);
+  if (!compressed.empty())
+  {
+    location.compression = m_compression;
+    location.compressed_size = static_cast<u32>(compressed.size());
+    m_write_buffer = std::move(compressed);
+  }
+
+  location.memory_updates_offset = m_end + m_write_buffer.size();
+  u64 update_data_offset = location.compression == FifoCompression::None ? m_end : 0;
+  update_data_offset += location.fifo_data_size;
+  for (const MemoryUpdate& update : frameInfo.memoryUpdates)
+  {
+    FileMemoryUpdate file_update{};
+    file_update.fifoPosition = update.fifoPosition;
+    file_update.address = update.address;
+    file_update.dataOffset = update_data_offset;
+    file_update.dataSize = static_cast<u32>(update.data.size());
+    file_update.type = static_cast<u8>(update.type);
+    update_data_offset += update.data.size();
+
+    const u8* file_update_ptr = reinterpret_cast<const u8*>(&file_update);
+    m_write_buffer.insert(m_write_buffer.end(), file_update_ptr,
+                          file_update_ptr + sizeof(FileMemoryUpdate));
+  }
+
+  if (!m_file.OffsetWrite(m_end, m_write_buffer.data(), m_write_buffer.size()))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to write frame {} to {}", m_Frames.size(), m_path);
+    m_write_failed = true;
+    return;
+  }
+
+  m_end += m_write_buffer.size();
+  m_Frames.push_back(location);
+}
+
+std::optional<FifoFrameInfo> FifoDataFile::GetFrame(u32 frame) const
+{
+  const FrameLocation& location = m_Frames[frame];
+
+  FifoFrameInfo frameInfo;
+  frameInfo.fifoStart = location.fifo_start;
+  frameInfo.fifoEnd = location.fifo_end;
+
+  const auto failed_to_read = [&]() -> std::optional<FifoFrameInfo> {
+    ERROR_LOG_FMT(VIDEO, "Failed to read frame {} of {}", frame, m_path);
+    return std::nullopt;
+  };
+
+  std::vector<u8> buffer;
+  // The FIFO data and the data of the memory updates, if the frame is compressed
+  std::vector<u8> block;
+  if (location.compression == FifoCompression::None)
+  {
+    const std::span<const u8> fifo_data =
+        ReadData(location.data_offset, location.fifo_data_size, &buffer);
+    if (fifo_data.size() != location.fifo_data_size)
+      return failed_to_read();
+    frameInfo.fifoData.assign(fifo_data.begin(), fifo_data.end());
+  }
+  else
+  {
+    const std::span<const u8> compressed =
+        ReadData(location.data_offset, location.compressed_size, &buffer);
+    const u64 block_size = u64{location.fifo_data_size} + location.memory_updates_size;
+    if (compressed.size() != location.compressed_size ||
+        !CanDecompressTo(location.compression, compressed, block_size))
+    {
+      return failed_to_read();
+    }
+    block.resize(block_size);
+    if (!Decompress(location.compression, compressed, block))
+      return failed_to_read();
+    frameInfo.fifoData.assign(block.begin(), block.begin() + location.fifo_data_size);
+  }
+
+  const u64 updates_size = u64{location.num_memory_updates} * sizeof(FileMemoryUpdate);
+  const std::span<const u8> updates =
+      ReadData(location.memory_updates_offset, updates_size, &buffer);
+  if (updates.size() != updates_size)
+    return failed_to_read();
+
+  std::vector<u8> update_buffer;
+  frameInfo.memoryUpdates.resize(location.num_memory_updates);
+  for (u32 i = 0; i < location.num_memory_updates; ++i)
+  {
+    FileMemoryUpdate srcUpdate;
+    std::memcpy(&srcUpdate, updates.data() + i * sizeof(FileMemoryUpdate), sizeof(srcUpdate));
+
+    std::span<const u8> data;
+    if (location.compression == FifoCompression::None)
+    {
+      data = ReadData(srcUpdate.dataOffset, srcUpdate.dataSize, &update_buffer);
+    }
+    else if (srcUpdate.dataOffset <= block.size() &&
+             srcUpdate.dataSize <= block.size() - srcUpdate.dataOffset)
+    {
+      data = std::span(block).subspan(srcUpdate.dataOffset, srcUpdate.dataSize);
+    }
+    if (data.size() != srcUpdate.dataSize)
+      return failed_to_read();
+
+    MemoryUpdate& dstUpdate = frameInfo.memoryUpdates[i];
+    dstUpdate.address = srcUpdate.address;
+    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+    dstUpdate.data.assign(data.begin(), data.end());
+    dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
+  }
+
+  return frameInfo;
 }
 
 bool FifoDataFile::Save(const std::string& filename)
 {
-  File::IOFile file;
-  if (!file.Open(filename, "wb"))
+  // A loaded file is saved as it is, unless it would be copied onto itself.
+  if (m_temp_path.empty())
+  {
+    std::error_code error;
+    if (std::filesystem::equivalent(StringToPath(m_path), StringToPath(filename), error))
+      return true;
+    return File::CopyRegularFile(m_path, filename);
+  }
+
+  if (m_write_failed)
     return false;
 
-  // Add space for header
-  PadFile(sizeof(FileHeader), file);
+  // Write initial state
+  u64 offset = sizeof(FileHeader);
+  const auto write_array = [&](const auto& array) {
+    const u64 size = sizeof(array);
+    const bool result =
+        m_file.OffsetWrite(offset, reinterpret_cast<const u8*>(array.data()), size);
+    offset += size;
+    return result;
+  };
+
+  const u64 bpMemOffset = offset;
+  bool result = write_array(m_BPMem);
 
-  // Add space for frame list
-  u64 frameListOffset = file.Tell();
-  PadFile(m_Frames.size() * sizeof(FileFrameInfo), file);
+  const u64 cpMemOffset = offset;
+  result &= write_array(m_CPMem);
 
-  u64 bpMemOffset = file.Tell();
-  file.WriteArray(m_BPMem);
+  const u64 xfMemOffset = offset;
+  result &= write_array(m_XFMem);
 
-  u64 cpMemOffset = file.Tell();
-  file.WriteArray(m_CPMem);
+  const u64 xfRegsOffset = offset;
+  result &= write_array(m_XFRegs);
 
-  u64 xfMemOffset = file.Tell();
-  file.WriteArray(m_XFMem);
+  const u64 texMemOffset = offset;
+  result &= write_array(m_TexMem);
 
-  u64 xfRegsOffset = file.Tell();
-  file.WriteArray(m_XFRegs);
+  ASSERT(offset == FIRST_FRAME_OFFSET);
 
-  u64 texMemOffset = file.Tell();
-  file.WriteArray(m_TexMem);
+  // Write frame index. It stays after the last frame, so that recording can carry on if the file
+  // has to be copied when saving.
+  const u64 frameListOffset = m_end;
+  std::vector<FileFrameInfo> frameList(m_Frames.size());
+  for (size_t i = 0; i < m_Frames.size(); ++i)
+  {
+    const FrameLocation& srcFrame = m_Frames[i];
+    FileFrameInfo& dstFrame = frameList[i];
+    dstFrame = {};
+    dstFrame.fifoDataOffset = srcFrame.data_offset;
+    dstFrame.fifoDataSize = srcFrame.fifo_data_size;
+    dstFrame.fifoStart = srcFrame.fifo_start;
+    dstFrame.fifoEnd = srcFrame.fifo_end;
+    dstFrame.memoryUpdatesOffset = srcFrame.memory_updates_offset;
+    dstFrame.numMemoryUpdates = srcFrame.num_memory_updates;
+    dstFrame.memoryUpdatesSize = srcFrame.memory_updates_size;
+    dstFrame.compressedSize = srcFrame.compressed_size;
+    dstFrame.compression = static_cast<u8>(srcFrame.compression);
+  }
+  result &= m_file.OffsetWrite(frameListOffset, reinterpret_cast<const u8*>(frameList.data()),
+                               frameList.size() * sizeof(FileFrameInfo));
 
   // Write header
-  FileHeader header;
+  FileHeader header{};
   header.fileId = FILE_ID;
   header.file_version = VERSION_NUMBER;
-  // Maintain backwards compatibility so long as the RAM sizes aren't overridden.
-  if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE) ||
-      SConfig::GetInstance().GetSimulatedMemorySize() > Memory::MEM1_SIZE_RETAIL)
+  // Maintain backwards compatibility so long as the RAM sizes aren't overridden and nothing is
+  // compressed.
+  if (std::ranges::any_of(m_Frames, [](const FrameLocation& frame) {
+        return frame.compression != FifoCompression::None;
+      }))
+  {
+    header.min_loader_version = MIN_LOADER_VERSION_FOR_COMPRESSION;
+  }
+  else if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE) ||
+           SConfig::GetInstance().GetSimulatedMemorySize() > Memory::MEM1_SIZE_RETAIL)
+  {
     header.min_loader_version = MIN_LOADER_VERSION_FOR_RAM_OVERRIDE;
+  }
   else
+  {
     header.min_loader_version = MIN_LOADER_VERSION;
+  }
 
   header.bpMemOffset = bpMemOffset;
   header.bpMemSize = BP_MEM_SIZE;
@@ -182,46 +501,34 @@ bool FifoDataFile::Save(const std::string& filename)
     std::strncpy(header.gameid, gameid.c_str(), DEFAULT_GAME_ID.size());
   }
 
-  file.Seek(0, File::SeekOrigin::Begin);
-  file.WriteBytes(&header, sizeof(FileHeader));
+  // The header goes last, so that it only points to an index which has been written.
+  result &= m_file.Flush();
+  result &= m_file.OffsetWrite(0, reinterpret_cast<const u8*>(&header), sizeof(FileHeader));
+  result &= m_file.Flush();
+
+  if (!result)
+    return false;
 
-  // Write frames list
-  for (unsigned int i = 0; i < m_Frames.size(); ++i)
+  // The recording can be gigabytes large, so move it rather than copying it. This fails across
+  // file systems, in which case it is copied after all and stays open for recording.
+  m_file.Close();
+  if (File::Rename(m_path, filename))
   {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
-
-    // Write FIFO data
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
-
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
-
-    FileFrameInfo dstFrame;
-    dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
-    dstFrame.fifoDataOffset = dataOffset;
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-    dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
-    dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
-
-    // Write frame info
-    u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstFrame, sizeof(FileFrameInfo));
+    m_temp_path.clear();
+    m_path = filename;
+    return m_file.Open(m_path, File::AccessMode::Read);
   }
 
-  if (!file.Close())
-    return false;
-
-  return true;
+  result = File::CopyRegularFile(m_path, filename);
+  if (!m_file.Open(m_path, File::AccessMode::ReadAndWrite))
+    m_write_failed = true;
+  return result;
 }
 
 std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bool flagsOnly)
 {
-  File::IOFile file;
-  file.Open(filename, "rb");
-  if (!file)
+  File::DirectIOFile file(filename, File::AccessMode::Read);
+  if (!file.IsOpen())
     return nullptr;
 
   auto panic_failed_to_read = [] {
@@ -229,14 +536,15 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     return nullptr;
   };
 
-  if (file.GetSize() == 0)
+  const u64 file_size = file.GetSize();
+  if (file_size == 0)
   {
     CriticalAlertFmtT("DFF file size is 0; corrupt/incomplete file?");
     return nullptr;
   }
 
   FileHeader header;
-  if (!file.ReadBytes(&header, sizeof(header)))
+  if (!file.OffsetRead(0, reinterpret_cast<u8*>(&header), sizeof(header)))
     return panic_failed_to_read();
 
   if (header.fileId != FILE_ID)
@@ -310,73 +618,100 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     return nullptr;
   }
 
-  u32 size = std::min<u32>(BP_MEM_SIZE, header.bpMemSize);
-  file.Seek(header.bpMemOffset, File::SeekOrigin::Begin);
-  file.ReadArray(dataFile->m_BPMem.data(), size);
-
-  size = std::min<u32>(CP_MEM_SIZE, header.cpMemSize);
-  file.Seek(header.cpMemOffset, File::SeekOrigin::Begin);
-  file.ReadArray(dataFile->m_CPMem.data(), size);
-
-  size = std::min<u32>(XF_MEM_SIZE, header.xfMemSize);
-  file.Seek(header.xfMemOffset, File::SeekOrigin::Begin);
-  file.ReadArray(dataFile->m_XFMem.data(), size);
+  const auto read_array = [&file](u64 offset, auto& array, u32 size) {
+    return file.OffsetRead(offset, reinterpret_cast<u8*>(array.data()),
+                           std::min<u64>(array.size(), size) * sizeof(array[0]));
+  };
 
-  size = std::min<u32>(XF_REGS_SIZE, header.xfRegsSize);
-  file.Seek(header.xfRegsOffset, File::SeekOrigin::Begin);
-  file.ReadArray(dataFile->m_XFRegs.data(), size);
+  bool result = read_array(header.bpMemOffset, dataFile->m_BPMem, header.bpMemSize);
+  result &= read_array(header.cpMemOffset, dataFile->m_CPMem, header.cpMemSize);
+  result &= read_array(header.xfMemOffset, dataFile->m_XFMem, header.xfMemSize);
+  result &= read_array(header.xfRegsOffset, dataFile->m_XFRegs, header.xfRegsSize);
 
   // Texture memory saving was added in version 4.
   dataFile->m_TexMem.fill(0);
   if (dataFile->m_Version >= 4)
-  {
-    size = std::min<u32>(TEX_MEM_SIZE, header.texMemSize);
-    file.Seek(header.texMemOffset, File::SeekOrigin::Begin);
-    file.ReadArray(&dataFile->m_TexMem);
-  }
+    result &= read_array(header.texMemOffset, dataFile->m_TexMem, header.texMemSize);
 
-  if (!file.IsGood())
+  if (!result)
     return panic_failed_to_read();
 
   // idk what else these could be used for, but it'd be a shame to not make them available.
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
 
-  // Read frames
-  for (u32 i = 0; i < header.frameCount; ++i)
+  // Read frame index. Everything that is allocated based on what the file says has to fit in it.
+  const auto fits_in_file = [file_size](u64 offset, u64 size) {
+    return offset <= file_size && size <= file_size - offset;
+  };
+  if (!fits_in_file(header.frameListOffset, u64{header.frameCount} * sizeof(FileFrameInfo)))
+    return panic_failed_to_read();
+  std::vector<FileFrameInfo> frameList(header.frameCount);
+  if (!file.OffsetRead(header.frameListOffset, reinterpret_cast<u8*>(frameList.data()),
+                       frameList.size() * sizeof(FileFrameInfo)))
   {
-    u64 frameOffset = header.frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, File::SeekOrigin::Begin);
-    FileFrameInfo srcFrame;
-    if (!file.ReadBytes(&srcFrame, sizeof(FileFrameInfo)))
-      return panic_failed_to_read();
-
-    FifoFrameInfo dstFrame;
-    dstFrame.fifoData.resize(srcFrame.fifoDataSize);
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-
-    file.Seek(srcFrame.fifoDataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
+    return panic_failed_to_read();
+  }
 
-    ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
-                      dstFrame.memoryUpdates, file);
+  dataFile->m_path = filename;
+  dataFile->m_file = std::move(file);
+  if (!dataFile->m_mapping.Map(dataFile->m_file, file_size))
+    WARN_LOG_FMT(VIDEO, "Failed to map {}, frames will be read from it instead", filename);
 
-    if (!file.IsGood())
+  dataFile->m_Frames.resize(frameList.size());
+  std::vector<u8> buffer;
+  for (size_t i = 0; i < frameList.size(); ++i)
+  {
+    const FileFrameInfo& srcFrame = frameList[i];
+    FrameLocation& dstFrame = dataFile->m_Frames[i];
+    dstFrame.data_offset = srcFrame.fifoDataOffset;
+    dstFrame.memory_updates_offset = srcFrame.memoryUpdatesOffset;
+    dstFrame.fifo_data_size = srcFrame.fifoDataSize;
+    dstFrame.num_memory_updates = srcFrame.numMemoryUpdates;
+    dstFrame.fifo_start = srcFrame.fifoStart;
+    dstFrame.fifo_end = srcFrame.fifoEnd;
+    if (!fits_in_file(dstFrame.memory_updates_offset,
+                      u64{dstFrame.num_memory_updates} * sizeof(FileMemoryUpdate)))
+    {
       return panic_failed_to_read();
-
-    dataFile->AddFrame(dstFrame);
+    }
+
+    // Compression was added in version 7
+    if (dataFile->m_Version >= 7)
+    {
+      dstFrame.memory_updates_size = srcFrame.memoryUpdatesSize;
+      dstFrame.compressed_size = srcFrame.compressedSize;
+      dstFrame.compression = static_cast<FifoCompression>(srcFrame.compression);
+      if (dstFrame.compression > FifoCompression::Zstd)
+        return panic_failed_to_read();
+    }
+
+    const bool compressed = dstFrame.compression != FifoCompression::None;
+    if (!fits_in_file(dstFrame.data_offset,
+                      compressed ? dstFrame.compressed_size : dstFrame.fifo_data_size))
+    {
+      return panic_failed_to_read();
+    }
+    if (dataFile->m_Version >= 7)
+      continue;
+
+    // Older versions don't store the size of the memory updates, so add it up.
+    const u64 updates_size = u64{dstFrame.num_memory_updates} * sizeof(FileMemoryUpdate);
+    const std::span<const u8> updates =
+        dataFile->ReadData(dstFrame.memory_updates_offset, updates_size, &buffer);
+    if (updates.size() != updates_size)
+      return panic_failed_to_read();
+    for (u32 j = 0; j < dstFrame.num_memory_updates; ++j)
+    {
+      FileMemoryUpdate update;
+      std::memcpy(&update, updates.data() + j * sizeof(FileMemoryUpdate), sizeof(update));
+      dstFrame.memory_updates_size += update.dataSize;
+    }
   }
 
   return dataFile;
 }
 
-void FifoDataFile::PadFile(size_t numBytes, File::IOFile& file)
-{
-  for (size_t i = 0; i < numBytes; ++i)
-    fputc(0, file.GetHandle());
-}
-
 void FifoDataFile::SetFlag(u32 flag, bool set)
 {
   if (set)
@@ -390,55 +725,19 @@ bool FifoDataFile::GetFlag(u32 flag) const
   return !!(m_Flags & flag);
 }
 
-u64 FifoDataFile::WriteMemoryUpdates(std::span<const MemoryUpdate> memUpdates, File::IOFile& file)
+std::span<const u8> FifoDataFile::ReadData(u64 offset, u64 size, std::vector<u8>* buffer) const
 {
-  // Add space for memory update list
-  u64 updateListOffset = file.Tell();
-  PadFile(memUpdates.size() * sizeof(FileMemoryUpdate), file);
-
-  for (unsigned int i = 0; i < memUpdates.size(); ++i)
-  {
-    const MemoryUpdate& srcUpdate = memUpdates[i];
-
-    // Write memory
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
-
-    FileMemoryUpdate dstUpdate;
-    dstUpdate.address = srcUpdate.address;
-    dstUpdate.dataOffset = dataOffset;
-    dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
-    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.type = static_cast<u8>(srcUpdate.type);
-
-    u64 updateOffset = updateListOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstUpdate, sizeof(FileMemoryUpdate));
-  }
-
-  return updateListOffset;
-}
-
-void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                     std::vector<MemoryUpdate>& memUpdates, File::IOFile& file)
-{
-  memUpdates.resize(numUpdates);
-
-  for (u32 i = 0; i < numUpdates; ++i)
-  {
-    u64 updateOffset = fileOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
-    FileMemoryUpdate srcUpdate;
-    file.ReadBytes(&srcUpdate, sizeof(FileMemoryUpdate));
-
-    MemoryUpdate& dstUpdate = memUpdates[i];
-    dstUpdate.address = srcUpdate.address;
-    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.data.resize(srcUpdate.dataSize);
-    dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
-
-    file.Seek(srcUpdate.dataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
-  }
+  const std::span<const u8> mapped = m_mapping.GetData();
+  if (offset <= mapped.size() && size <= mapped.size() - offset)
+    return mapped.subspan(offset, size);
+
+  // The file isn't mapped, which is the case while recording
+  const u64 file_size = m_file.GetSize();
+  if (offset > file_size || size > file_size - offset)
+    return {};
+
+  buffer->resize(size);
+  if (!m_file.OffsetRead(offset, buffer->data(), size))
+    return {};
+  return *buffer;
 }
@@ -5,19 +5,17 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/DirectIOFile.h"
+#include "Common/FileMapping.h"
 #include "Core/ConfigManager.h"
 #include "VideoCommon/XFMemory.h"
 
-namespace File
-{
-class IOFile;
-}
-
 struct MemoryUpdate
 {
   enum class Type : u8
@@ -45,6 +43,14 @@ struct FifoFrameInfo
   std::vector<MemoryUpdate> memoryUpdates;
 };
 
+// How the data of each frame is stored in a DFF file. The numbers are stored in the file.
+enum class FifoCompression : u8
+{
+  None = 0,
+  LZ4 = 1,
+  Zstd = 2,
+};
+
 class FifoDataFile
 {
 public:
@@ -75,11 +81,25 @@ public:
   u32 GetExRamSizeReal() { return m_exram_size_real; }
   const std::string& GetGameId() const { return m_game_id; }
 
+  // Frames are written to the file as soon as they are added, so only files which were created
+  // with Create can be added to.
   void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
+  // Reads the frame from the file, or returns nothing if it can't be read. Can be called from any
+  // thread.
+  std::optional<FifoFrameInfo> GetFrame(u32 frame) const;
   u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  // Sizes and FIFO bounds of a frame, without reading it
+  u32 GetFifoDataSize(u32 frame) const { return m_Frames[frame].fifo_data_size; }
+  u32 GetMemoryUpdatesSize(u32 frame) const { return m_Frames[frame].memory_updates_size; }
+  u32 GetFifoStart(u32 frame) const { return m_Frames[frame].fifo_start; }
+  u32 GetFifoEnd(u32 frame) const { return m_Frames[frame].fifo_end; }
   bool Save(const std::string& filename);
 
+  // Creates an empty file for recording into, in the dump directory, which is deleted along with
+  // this object. Save moves it to where it should be kept, after which it can't be added to.
+  static std::unique_ptr<FifoDataFile> Create(FifoCompression compression);
+  // Only reads the header, the initial state and the frame index. Frames are read when they are
+  // needed, from a memory mapping of the file.
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
 
 private:
@@ -88,14 +108,29 @@ private:
     FLAG_IS_WII = 1
   };
 
-  static void PadFile(size_t numBytes, File::IOFile& file);
+  // Where the data of a frame is in the file
+  struct FrameLocation
+  {
+    // Uncompressed, the FIFO data is at data_offset, and the memory updates have their own offsets.
+    // Compressed, compressed_size bytes at data_offset hold the FIFO data followed by the data of
+    // the memory updates, and their offsets are relative to the start of the decompressed data.
+    u64 data_offset = 0;
+    u64 memory_updates_offset = 0;
+    u32 compressed_size = 0;
+    u32 fifo_data_size = 0;
+    u32 memory_updates_size = 0;
+    u32 num_memory_updates = 0;
+    u32 fifo_start = 0;
+    u32 fifo_end = 0;
+    FifoCompression compression = FifoCompression::None;
+  };
 
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
-  u64 WriteMemoryUpdates(std::span<const MemoryUpdate> memUpdates, File::IOFile& file);
-  static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+  // Returns size bytes at offset in the file, which are either mapped or read into buffer. Returns
+  // an empty span if they can't be read.
+  std::span<const u8> ReadData(u64 offset, u64 size, std::vector<u8>* buffer) const;
 
   std::array<u32, BP_MEM_SIZE> m_BPMem{};
   std::array<u32, CP_MEM_SIZE> m_CPMem{};
@@ -110,5 +145,17 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
-  std::vector<FifoFrameInfo> m_Frames;
+  std::vector<FrameLocation> m_Frames;
+
+  // The file the frames are read from, which is mapped if it was loaded. When recording, frames
+  // are appended at m_end.
+  std::string m_path;
+  mutable File::DirectIOFile m_file;
+  File::ReadOnlyFileMapping m_mapping;
+  // The file being recorded into, until Save moves it
+  std::string m_temp_path;
+  FifoCompression m_compression = FifoCompression::None;
+  u64 m_end = 0;
+  bool m_write_failed = false;
+  std::vector<u8> m_write_buffer;
 };
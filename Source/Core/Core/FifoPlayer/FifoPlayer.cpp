@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <optional>
 #include <type_traits>
 
 #include "Common/Assert.h"
@@ -37,7 +38,8 @@ namespace
 class FifoPlaybackAnalyzer : public OpcodeDecoder::Callback
 {
 public:
-  static void AnalyzeFrames(FifoDataFile* file, std::vector<AnalyzedFrameInfo>& frame_info);
+  // Returns false if a frame can't be read from the file.
+  static bool AnalyzeFrames(FifoDataFile* file, std::vector<AnalyzedFrameInfo>& frame_info);
 
   explicit FifoPlaybackAnalyzer(const u32* cpmem) : m_cpmem(cpmem) {}
 
@@ -67,7 +69,7 @@ public:
   CPState m_cpmem;
 };
 
-void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
+bool FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
                                          std::vector<AnalyzedFrameInfo>& frame_info)
 {
   FifoPlaybackAnalyzer analyzer(file->GetCPMem());
@@ -76,7 +78,10 @@ void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
 
   for (u32 frame_no = 0; frame_no < file->GetFrameCount(); frame_no++)
   {
-    const FifoFrameInfo& frame = file->GetFrame(frame_no);
+    const std::optional<FifoFrameInfo> frame_data = file->GetFrame(frame_no);
+    if (!frame_data)
+      return false;
+    const FifoFrameInfo& frame = *frame_data;
     AnalyzedFrameInfo& analyzed = frame_info[frame_no];
 
     u32 offset = 0;
@@ -121,6 +126,8 @@ void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
     ASSERT(part_start == frame.fifoData.size());
     ASSERT(offset == frame.fifoData.size());
   }
+
+  return true;
 }
 
 void FifoPlaybackAnalyzer::OnBP(u8 command, u32 value)
@@ -183,12 +190,14 @@ bool FifoPlayer::Open(const std::string& filename)
 
   m_File = FifoDataFile::Load(filename, false);
 
-  if (m_File)
+  if (m_File && !FifoPlaybackAnalyzer::AnalyzeFrames(m_File.get(), m_FrameInfo))
   {
-    FifoPlaybackAnalyzer::AnalyzeFrames(m_File.get(), m_FrameInfo);
+    CriticalAlertFmtT("Failed to read DFF file.");
+    m_File.reset();
+  }
 
+  if (m_File)
     m_FrameRangeEnd = m_File->GetFrameCount() - 1;
-  }
 
   if (m_FileLoadedCb)
     m_FileLoadedCb();
@@ -287,10 +296,16 @@ CPU::State FifoPlayer::AdvanceFrame()
   if (m_FrameWrittenCb)
     m_FrameWrittenCb();
 
-  if (m_EarlyMemoryUpdates && m_CurrentFrame == m_FrameRangeStart)
-    WriteAllMemoryUpdates();
+  if (m_EarlyMemoryUpdates && m_CurrentFrame == m_FrameRangeStart && !WriteAllMemoryUpdates())
+    return CPU::State::PowerDown;
 
-  WriteFrame(m_File->GetFrame(m_CurrentFrame), m_FrameInfo[m_CurrentFrame]);
+  const std::optional<FifoFrameInfo> frame = m_File->GetFrame(m_CurrentFrame);
+  if (!frame)
+  {
+    PanicAlertFmtT("Failed to read frame {0} of the FIFO log.", m_CurrentFrame);
+    return CPU::State::PowerDown;
+  }
+  WriteFrame(*frame, m_FrameInfo[m_CurrentFrame]);
 
   ++m_CurrentFrame;
   return CPU::State::Running;
@@ -469,18 +484,24 @@ void FifoPlayer::WriteFramePart(const FramePart& part, u32* next_mem_update,
     WriteFifo(data, data_start, data_end);
 }
 
-void FifoPlayer::WriteAllMemoryUpdates()
+bool FifoPlayer::WriteAllMemoryUpdates()
 {
   ASSERT(m_File);
 
   for (u32 frameNum = 0; frameNum < m_File->GetFrameCount(); ++frameNum)
   {
-    const FifoFrameInfo& frame = m_File->GetFrame(frameNum);
-    for (auto& update : frame.memoryUpdates)
+    const std::optional<FifoFrameInfo> frame = m_File->GetFrame(frameNum);
+    if (!frame)
+    {
+      PanicAlertFmtT("Failed to read frame {0} of the FIFO log.", frameNum);
+      return false;
+    }
+    for (auto& update : frame->memoryUpdates)
     {
       WriteMemory(update);
     }
   }
+  return true;
 }
 
 void FifoPlayer::WriteMemory(const MemoryUpdate& memUpdate)
@@ -540,16 +561,17 @@ void FifoPlayer::SetupFifo()
   WriteCP(CommandProcessor::CTRL_REGISTER, 0);   // disable read, BP, interrupts
   WriteCP(CommandProcessor::CLEAR_REGISTER, 7);  // clear overflow, underflow, metrics
 
-  const FifoFrameInfo& frame = m_File->GetFrame(m_CurrentFrame);
+  const u32 fifo_start = m_File->GetFifoStart(m_CurrentFrame);
+  const u32 fifo_end = m_File->GetFifoEnd(m_CurrentFrame);
 
   // Set fifo bounds
-  WriteCP(CommandProcessor::FIFO_BASE_LO, frame.fifoStart);
-  WriteCP(CommandProcessor::FIFO_BASE_HI, frame.fifoStart >> 16);
-  WriteCP(CommandProcessor::FIFO_END_LO, frame.fifoEnd);
-  WriteCP(CommandProcessor::FIFO_END_HI, frame.fifoEnd >> 16);
+  WriteCP(CommandProcessor::FIFO_BASE_LO, fifo_start);
+  WriteCP(CommandProcessor::FIFO_BASE_HI, fifo_start >> 16);
+  WriteCP(CommandProcessor::FIFO_END_LO, fifo_end);
+  WriteCP(CommandProcessor::FIFO_END_HI, fifo_end >> 16);
 
   // Set watermarks, high at 75%, low at 0%
-  u32 hi_watermark = (frame.fifoEnd - frame.fifoStart) * 3 / 4;
+  u32 hi_watermark = (fifo_end - fifo_start) * 3 / 4;
   WriteCP(CommandProcessor::FIFO_HI_WATERMARK_LO, hi_watermark);
   WriteCP(CommandProcessor::FIFO_HI_WATERMARK_HI, hi_watermark >> 16);
   WriteCP(CommandProcessor::FIFO_LO_WATERMARK_LO, 0);
@@ -558,19 +580,19 @@ void FifoPlayer::SetupFifo()
   // Set R/W pointers to fifo start
   WriteCP(CommandProcessor::FIFO_RW_DISTANCE_LO, 0);
   WriteCP(CommandProcessor::FIFO_RW_DISTANCE_HI, 0);
-  WriteCP(CommandProcessor::FIFO_WRITE_POINTER_LO, frame.fifoStart);
-  WriteCP(CommandProcessor::FIFO_WRITE_POINTER_HI, frame.fifoStart >> 16);
-  WriteCP(CommandProcessor::FIFO_READ_POINTER_LO, frame.fifoStart);
-  WriteCP(CommandProcessor::FIFO_READ_POINTER_HI, frame.fifoStart >> 16);
+  WriteCP(CommandProcessor::FIFO_WRITE_POINTER_LO, fifo_start);
+  WriteCP(CommandProcessor::FIFO_WRITE_POINTER_HI, fifo_start >> 16);
+  WriteCP(CommandProcessor::FIFO_READ_POINTER_LO, fifo_start);
+  WriteCP(CommandProcessor::FIFO_READ_POINTER_HI, fifo_start >> 16);
 
   // Set fifo bounds
-  WritePI(ProcessorInterface::PI_FIFO_BASE, frame.fifoStart);
-  WritePI(ProcessorInterface::PI_FIFO_END, frame.fifoEnd);
+  WritePI(ProcessorInterface::PI_FIFO_BASE, fifo_start);
+  WritePI(ProcessorInterface::PI_FIFO_END, fifo_end);
 
   // Set write pointer
-  WritePI(ProcessorInterface::PI_FIFO_WPTR, frame.fifoStart);
+  WritePI(ProcessorInterface::PI_FIFO_WPTR, fifo_start);
   FlushWGP();
-  WritePI(ProcessorInterface::PI_FIFO_WPTR, frame.fifoStart);
+  WritePI(ProcessorInterface::PI_FIFO_WPTR, fifo_start);
 
   WriteCP(CommandProcessor::CTRL_REGISTER, 17);  // enable read & GP link
 }
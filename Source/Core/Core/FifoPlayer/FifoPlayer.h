@@ -148,7 +148,8 @@ private:
   void WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo& info);
   void WriteFramePart(const FramePart& part, u32* next_mem_update, const FifoFrameInfo& frame);
 
-  void WriteAllMemoryUpdates();
+  // Returns false if a frame can't be read from the file.
+  bool WriteAllMemoryUpdates();
   void WriteMemory(const MemoryUpdate& memUpdate);
 
   // writes a range of data to the fifo
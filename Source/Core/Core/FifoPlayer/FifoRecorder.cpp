@@ -10,6 +10,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
@@ -216,7 +217,16 @@ void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
 {
   std::lock_guard lk(m_mutex);
 
-  m_File = std::make_unique<FifoDataFile>();
+  // Frames are written to the file as they are recorded, so that long recordings don't have to
+  // fit in memory.
+  // Nothing changes if it can't be created, so a previous recording can still be saved.
+  auto file = FifoDataFile::Create(Config::Get(Config::MAIN_FIFOPLAYER_COMPRESSION));
+  if (!file)
+  {
+    PanicAlertFmtT("Failed to create a temporary file for the FIFO log.");
+    return;
+  }
+  m_File = std::move(file);
 
   // TODO: This, ideally, would be deallocated when done recording.
   //       However, care needs to be taken since global state
@@ -331,8 +341,7 @@ void FifoRecorder::WriteGPCommand(const u8* data, u32 size)
     {
       std::lock_guard lk(m_mutex);
 
-      // Copy frame to file
-      // The file will be responsible for freeing the memory allocated for each frame's fifoData
+      // Write frame to file
       m_File->AddFrame(m_CurrentFrame);
 
       if (m_FinishedCb && m_RequestedRecordingEnd)
@@ -3,17 +3,20 @@
 
 #include "Core/HW/DSPHLE/UCodes/AX.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <iterator>
 
 #include "Common/ChunkFile.h"
+#include "Common/Config/Config.h"
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/Hash.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
@@ -49,6 +52,9 @@ void AXUCode::InitializeShared()
 {
   m_mail_handler.PushMail(DSP_INIT, true);
 
+  m_voice_workers.SetNumWorkers(
+      static_cast<u32>(std::clamp(Config::Get(Config::MAIN_DSP_HLE_VOICE_THREADS), 0, 16)));
+
   LoadResamplingCoefficients(false, 0);
 }
 
@@ -463,6 +469,9 @@ void AXUCode::ProcessPBList(u32 pb_addr)
 
   AXPB pb;
 
+  if (m_voice_workers.GetNumWorkers() != 0)
+    pb_addr = ProcessPBListInParallel(pb_addr);
+
   auto& memory = m_dsphle->GetSystem().GetMemory();
   while (pb_addr)
   {
@@ -492,6 +501,49 @@ void AXUCode::ProcessPBList(u32 pb_addr)
   }
 }
 
+u32 AXUCode::ProcessPBListInParallel(u32 pb_addr)
+{
+  constexpr u32 spms = 32;
+
+  auto& memory = m_dsphle->GetSystem().GetMemory();
+  const AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
+                              m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
+                              m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround}};
+
+  const auto read_voice = [&](ParallelVoice& voice) {
+    ReadPB(memory, voice.addr, voice.pb);
+    voice.has_updates = true;
+    voice.updates = LoadPBUpdates(memory, voice.pb);
+
+    // Rendering a voice doesn't change next_pb, but the updates can.
+    AXPB updated_pb = voice.pb;
+    for (int curr_ms = 0; curr_ms < 5; ++curr_ms)
+      ApplyUpdatesForMs(curr_ms, updated_pb, updated_pb.updates.num_updates, voice.updates);
+    return HILO_TO_32(updated_pb.next_pb);
+  };
+
+  const auto render_voice = [&](ParallelVoice& voice, HLEAccelerator* accelerator,
+                                AXBuffers thread_buffers) {
+    for (int curr_ms = 0; curr_ms < 5; ++curr_ms)
+    {
+      ApplyUpdatesForMs(curr_ms, voice.pb, voice.pb.updates.num_updates, voice.updates);
+
+      ProcessVoice(accelerator, voice.pb, thread_buffers, spms,
+                   ConvertMixerControl(voice.pb.mixer_control),
+                   m_coeffs_checksum ? m_coeffs.data() : nullptr, false);
+
+      // Forward the buffers
+      for (auto& ptr : thread_buffers.ptrs)
+        ptr += spms;
+    }
+  };
+
+  return RenderVoicesInParallel(
+      pb_addr, m_voice_workers, m_voice_threads, m_dsphle->GetSystem().GetDSP(), buffers,
+      read_voice, render_voice,
+      [&](const ParallelVoice& voice) { WritePB(memory, voice.addr, voice.pb); });
+}
+
 void AXUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr)
 {
   int* buffers[3] = {nullptr};
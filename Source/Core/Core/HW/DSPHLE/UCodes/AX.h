@@ -14,11 +14,13 @@
 #include <array>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
 #include "Core/HW/DSPHLE/DSPHLE.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceWorkers.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -111,6 +113,10 @@ protected:
 
   std::unique_ptr<Accelerator> m_accelerator;
 
+  // Optionally, the voices of a PB list are rendered on worker threads.
+  AXVoiceWorkers m_voice_workers;
+  std::vector<AXVoiceThread> m_voice_threads;
+
   // Constructs without any GC-specific state, so it can be used by the deriving AXWii.
   AXUCode(DSPHLE* dsphle, u32 crc, bool dummy);
 
@@ -161,6 +167,9 @@ protected:
   void SetupProcessing(u32 init_addr);
   void DownloadAndMixWithVolume(u32 addr, u16 vol_main, u16 vol_auxa, u16 vol_auxb);
   void ProcessPBList(u32 pb_addr);
+  // Renders voices from the start of a PB list on the voice workers, and returns the address of
+  // the first one it left to ProcessPBList (0 if there is none).
+  u32 ProcessPBListInParallel(u32 pb_addr);
   void MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr);
   void UploadLRS(u32 dst_addr);
   void SetMainLR(u32 src_addr);
@@ -13,8 +13,9 @@
 
 #include <algorithm>
 #include <bit>
-#include <functional>
+#include <iterator>
 #include <memory>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/DSP/DSPAccelerator.h"
@@ -22,6 +23,8 @@
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceWorkers.h"
+#include "Core/HW/DSPHLE/UCodes/AXVolume.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
@@ -125,6 +128,57 @@ union AXBuffers
 #endif
 };
 
+// Sizes of the buffers of a thread rendering voices in parallel with others (see AXVoiceWorkers)
+#ifdef AX_GC
+constexpr u32 THREAD_BUFFER_SIZE = 32 * 5;
+#else
+constexpr u32 THREAD_BUFFER_SIZE = 32 * 3;
+constexpr u32 THREAD_WIIMOTE_BUFFER_SIZE = 6 * 3;
+#endif
+
+// Points buffers at <samples>, which is resized to hold all of them and cleared.
+AXBuffers ClearThreadBuffers(std::vector<int>& samples)
+{
+  AXBuffers buffers;
+#ifdef AX_GC
+  samples.assign(std::size(buffers.ptrs) * THREAD_BUFFER_SIZE, 0);
+  for (size_t i = 0; i < std::size(buffers.ptrs); ++i)
+    buffers.ptrs[i] = &samples[i * THREAD_BUFFER_SIZE];
+#else
+  const size_t wiimote_start = std::size(buffers.regular_ptrs) * THREAD_BUFFER_SIZE;
+  samples.assign(wiimote_start + std::size(buffers.wiimote_ptrs) * THREAD_WIIMOTE_BUFFER_SIZE, 0);
+  for (size_t i = 0; i < std::size(buffers.regular_ptrs); ++i)
+    buffers.regular_ptrs[i] = &samples[i * THREAD_BUFFER_SIZE];
+  for (size_t i = 0; i < std::size(buffers.wiimote_ptrs); ++i)
+    buffers.wiimote_ptrs[i] = &samples[wiimote_start + i * THREAD_WIIMOTE_BUFFER_SIZE];
+#endif
+  return buffers;
+}
+
+// Adds buffers set up by ClearThreadBuffers to <out>.
+void AddThreadBuffers(const AXBuffers& out, const std::vector<int>& samples)
+{
+#ifdef AX_GC
+  for (size_t i = 0; i < std::size(out.ptrs); ++i)
+  {
+    for (u32 j = 0; j < THREAD_BUFFER_SIZE; ++j)
+      out.ptrs[i][j] += samples[i * THREAD_BUFFER_SIZE + j];
+  }
+#else
+  for (size_t i = 0; i < std::size(out.regular_ptrs); ++i)
+  {
+    for (u32 j = 0; j < THREAD_BUFFER_SIZE; ++j)
+      out.regular_ptrs[i][j] += samples[i * THREAD_BUFFER_SIZE + j];
+  }
+  const size_t wiimote_start = std::size(out.regular_ptrs) * THREAD_BUFFER_SIZE;
+  for (size_t i = 0; i < std::size(out.wiimote_ptrs); ++i)
+  {
+    for (u32 j = 0; j < THREAD_WIIMOTE_BUFFER_SIZE; ++j)
+      out.wiimote_ptrs[i][j] += samples[wiimote_start + i * THREAD_WIIMOTE_BUFFER_SIZE + j];
+  }
+#endif
+}
+
 // Simulated accelerator state.
 class HLEAccelerator final : public Accelerator
 {
@@ -220,7 +274,8 @@ u16 AcceleratorGetSample(HLEAccelerator* accelerator)
 // We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
 // avoids discontinuities in the audio stream, especially with very low ratios
 // which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
+template <typename InputCallback>
+u32 ResampleAudio(InputCallback input_callback, s16* output, u32 count, s16* last_samples,
                   u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
 {
   int read_samples_count = 0;
@@ -332,18 +387,55 @@ u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count
   return curr_pos;
 }
 
+// Returns how many input samples ResampleAudio reads to produce <count> samples.
+u32 GetInputSampleCount(u32 count, u32 curr_pos, u32 ratio, int srctype)
+{
+  if (srctype != SRCTYPE_LINEAR && srctype != SRCTYPE_POLYPHASE)
+    return count;
+
+  u32 input_count = 0;
+  for (u32 i = 0; i < count; ++i)
+  {
+    curr_pos += ratio;
+    input_count += curr_pos >> 16;
+    curr_pos &= 0xFFFF;
+  }
+  return input_count;
+}
+
 // Read <count> input samples from ARAM, decoding and converting rate
 // if required.
 void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16 count,
                      const s16* coeffs)
 {
+  // Enough for the highest valid ratio (4.0)
+  constexpr u32 MAX_INPUT_SAMPLES = MAX_SAMPLES_PER_FRAME * 4;
+
   AcceleratorSetup(accelerator, &pb);
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
-                               samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
-                               HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  const u32 input_count = GetInputSampleCount(count, pb.src.cur_addr_frac, ratio, pb.src_type);
+  u32 curr_pos;
+  if (input_count <= MAX_INPUT_SAMPLES)
+  {
+    // Decode all the samples needed in one go, so that resampling them doesn't have to stop for
+    // the accelerator after each one. They are read in the same order either way.
+    s16 input[MAX_INPUT_SAMPLES];
+    for (u32 i = 0; i < input_count; ++i)
+      input[i] = AcceleratorGetSample(accelerator);
+
+    curr_pos = ResampleAudio([&input](u32 i) { return input[i]; }, samples, count,
+                             pb.src.last_samples, pb.src.cur_addr_frac, ratio, pb.src_type, coeffs);
+  }
+  else
+  {
+    curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
+                             samples, count, pb.src.last_samples, pb.src.cur_addr_frac, ratio,
+                             pb.src_type, coeffs);
+  }
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -362,27 +454,9 @@ s16 ClampS16(s64 sample)
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
-  u16& volume = vd->volume;
-  u16 volume_delta = vd->volume_delta;
-
-  // If volume ramping is disabled, set volume_delta to 0. That way, the
-  // mixing loop can avoid testing if volume ramping is enabled at each step,
-  // and just add volume_delta.
-  if (!ramp)
-    volume_delta = 0;
-
-  for (u32 i = 0; i < count; ++i)
-  {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    s16 sample16 = ClampS16((s32)sample);
-
-    out[i] += sample16;
-    volume += volume_delta;
-
-    *dpop = sample16;
-  }
+  // If volume ramping is disabled, the volume simply stays the same.
+  const u16 volume_delta = ramp ? vd->volume_delta : 0;
+  vd->volume = MixAddWithVolumeRamp(out, input, count, vd->volume, volume_delta, dpop);
 }
 
 // Execute a low pass filter on the samples using one history value.
@@ -435,19 +509,15 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
   GetInputSamples(accelerator, pb, samples, count, coeffs);
 
   // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
-  {
 #ifdef AX_GC
-    // signed on GameCube
-    const s32 volume = (s16)pb.vol_env.cur_volume;
+  // signed on GameCube
+  constexpr bool signed_volume = true;
 #else
-    // unsigned on Wii
-    const s32 volume = (u16)pb.vol_env.cur_volume;
+  // unsigned on Wii
+  constexpr bool signed_volume = false;
 #endif
-    const s32 sample = ((s32)samples[i] * volume) >> 15;
-    samples[i] = ClampS16(sample);
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  pb.vol_env.cur_volume = static_cast<s16>(ApplyVolumeRamp(
+      samples, count, pb.vol_env.cur_volume, pb.vol_env.cur_volume_delta, signed_volume));
 
   // Optionally, execute a low-pass and/or biquad filter.
   if (pb.lpf.on != 0)
@@ -610,6 +680,67 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 #endif
 }
 
+// A voice of a PB list rendered on the voice workers
+struct ParallelVoice
+{
+  u32 addr;
+  PB_TYPE pb;
+  // Whether the voice is rendered one millisecond at a time, applying these updates
+  bool has_updates;
+  PBUpdateData updates;
+};
+
+// Renders voices from the start of the PB list at pb_addr on <workers>, and adds them to <out>.
+// read_voice reads a voice at voice.addr and returns the address of the next one, render_voice
+// renders it with the accelerator and buffers of a thread, and write_voice writes it back. As that
+// only happens once all voices are done, this stops at a voice overlapping one before it. Returns
+// the address of the first voice it left out (0 if there is none).
+template <typename ReadVoice, typename RenderVoice, typename WriteVoice>
+u32 RenderVoicesInParallel(u32 pb_addr, AXVoiceWorkers& workers,
+                           std::vector<AXVoiceThread>& threads, DSPManager& dsp,
+                           const AXBuffers& out, ReadVoice read_voice, RenderVoice render_voice,
+                           WriteVoice write_voice)
+{
+  // Way more than games use, but there has to be a limit in case a list loops
+  constexpr size_t MAX_VOICES = 1024;
+
+  std::vector<ParallelVoice> voices;
+  while (pb_addr && voices.size() < MAX_VOICES)
+  {
+    if (std::ranges::any_of(voices, [pb_addr](const ParallelVoice& voice) {
+          return pb_addr - voice.addr < sizeof(PB_TYPE) || voice.addr - pb_addr < sizeof(PB_TYPE);
+        }))
+    {
+      break;
+    }
+
+    ParallelVoice& voice = voices.emplace_back();
+    voice.addr = pb_addr;
+    pb_addr = read_voice(voice);
+  }
+
+  const u32 num_threads = workers.GetNumThreads();
+  while (threads.size() < num_threads)
+    threads.push_back({std::make_unique<HLEAccelerator>(dsp), {}});
+  std::vector<AXBuffers> thread_buffers;
+  for (u32 i = 0; i < num_threads; ++i)
+    thread_buffers.push_back(ClearThreadBuffers(threads[i].samples));
+
+  workers.RenderVoices(static_cast<u32>(voices.size()), [&](u32 index, u32 thread) {
+    render_voice(voices[index], static_cast<HLEAccelerator*>(threads[thread].accelerator.get()),
+                 thread_buffers[thread]);
+  });
+
+  // In order of the threads, although the sum would be the same in any order
+  for (u32 i = 0; i < num_threads; ++i)
+    AddThreadBuffers(out, threads[i].samples);
+
+  for (const ParallelVoice& voice : voices)
+    write_voice(voice);
+
+  return pb_addr;
+}
+
 }  // namespace
 }  // inline namespace AXGC/AXWii
 }  // namespace DSP::HLE
@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXVoiceWorkers.h"
+
+#include <fmt/format.h>
+
+#include "Common/Thread.h"
+
+namespace DSP::HLE
+{
+// Lists with fewer voices than this are rendered right away. Waking up the workers takes about
+// as long as rendering a few voices.
+constexpr u32 MIN_VOICES_FOR_WORKERS = 8;
+
+AXVoiceWorkers::AXVoiceWorkers() = default;
+
+AXVoiceWorkers::~AXVoiceWorkers()
+{
+  StopWorkers();
+}
+
+void AXVoiceWorkers::SetNumWorkers(u32 num_workers)
+{
+  if (num_workers == m_workers.size())
+    return;
+
+  StopWorkers();
+  StartWorkers(num_workers);
+}
+
+void AXVoiceWorkers::StartWorkers(u32 num_workers)
+{
+  // The workers may not get to wait before the first voices are handed out, so they are told
+  // which generation to wait past rather than reading it once they run.
+  m_exit = false;
+  for (u32 i = 0; i < num_workers; ++i)
+    m_workers.emplace_back(&AXVoiceWorkers::WorkerThread, this, i, m_generation);
+}
+
+void AXVoiceWorkers::StopWorkers()
+{
+  {
+    std::lock_guard lk(m_mutex);
+    m_exit = true;
+  }
+  m_work_cv.notify_all();
+
+  for (std::thread& worker : m_workers)
+    worker.join();
+  m_workers.clear();
+}
+
+void AXVoiceWorkers::RenderVoices(u32 num_voices, const RenderFunction& render_voice)
+{
+  if (m_workers.empty() || num_voices < MIN_VOICES_FOR_WORKERS)
+  {
+    for (u32 i = 0; i < num_voices; ++i)
+      render_voice(i, 0);
+    return;
+  }
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_render_voice = &render_voice;
+    m_num_voices = num_voices;
+    m_next_voice.store(0, std::memory_order_relaxed);
+    m_busy_workers = static_cast<u32>(m_workers.size());
+    ++m_generation;
+  }
+  m_work_cv.notify_all();
+
+  RenderUntilDone(0);
+
+  std::unique_lock lk(m_mutex);
+  m_done_cv.wait(lk, [this] { return m_busy_workers == 0; });
+  m_render_voice = nullptr;
+}
+
+void AXVoiceWorkers::RenderUntilDone(u32 thread)
+{
+  while (true)
+  {
+    const u32 voice = m_next_voice.fetch_add(1, std::memory_order_relaxed);
+    if (voice >= m_num_voices)
+      return;
+    (*m_render_voice)(voice, thread);
+  }
+}
+
+void AXVoiceWorkers::WorkerThread(u32 index, u64 generation)
+{
+  Common::SetCurrentThreadName(fmt::format("AX Voices {}", index).c_str());
+
+  std::unique_lock lk(m_mutex);
+  while (true)
+  {
+    m_work_cv.wait(lk, [&] { return m_exit || m_generation != generation; });
+    if (m_exit)
+      return;
+    generation = m_generation;
+
+    lk.unlock();
+    RenderUntilDone(index + 1);
+    lk.lock();
+
+    if (--m_busy_workers == 0)
+      m_done_cv.notify_one();
+  }
+}
+}  // namespace DSP::HLE
@@ -0,0 +1,78 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace DSP
+{
+class Accelerator;
+}
+
+namespace DSP::HLE
+{
+// What each thread rendering voices has of its own: an accelerator and mixing buffers
+struct AXVoiceThread
+{
+  std::unique_ptr<Accelerator> accelerator;
+  std::vector<int> samples;
+};
+
+// A pool of worker threads which the AX ucodes render the voices of a PB list on. Voices only
+// depend on each other through the buffers they are mixed into, so every thread mixes into
+// buffers of its own, which are added up once all voices are done. Since that is an integer sum,
+// the result is the same as when mixing the voices one after another.
+//
+// Only to be used from one thread, which renders voices as well while it waits for the workers.
+class AXVoiceWorkers
+{
+public:
+  // Called for each voice, with the index of the voice and the index of the thread rendering it.
+  using RenderFunction = std::function<void(u32 voice, u32 thread)>;
+
+  AXVoiceWorkers();
+  ~AXVoiceWorkers();
+
+  AXVoiceWorkers(const AXVoiceWorkers&) = delete;
+  AXVoiceWorkers& operator=(const AXVoiceWorkers&) = delete;
+
+  // With no workers, every voice is rendered by the calling thread.
+  void SetNumWorkers(u32 num_workers);
+  u32 GetNumWorkers() const { return static_cast<u32>(m_workers.size()); }
+  // Including the calling thread, which is thread 0.
+  u32 GetNumThreads() const { return GetNumWorkers() + 1; }
+
+  // Calls render_voice for every voice from 0 to num_voices - 1, and returns once all of them are
+  // done. The order of the voices is not defined, and neither is which thread renders them.
+  void RenderVoices(u32 num_voices, const RenderFunction& render_voice);
+
+private:
+  void StartWorkers(u32 num_workers);
+  void StopWorkers();
+  void WorkerThread(u32 index, u64 generation);
+  void RenderUntilDone(u32 thread);
+
+  std::vector<std::thread> m_workers;
+  std::mutex m_mutex;
+  std::condition_variable m_work_cv;
+  std::condition_variable m_done_cv;
+  bool m_exit = false;
+
+  // Changed while the workers are waiting for m_generation to change
+  const RenderFunction* m_render_voice = nullptr;
+  u32 m_num_voices = 0;
+  u64 m_generation = 0;
+  u32 m_busy_workers = 0;
+
+  std::atomic<u32> m_next_voice = 0;
+};
+}  // namespace DSP::HLE
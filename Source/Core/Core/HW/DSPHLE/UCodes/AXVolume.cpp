@@ -0,0 +1,211 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXVolume.h"
+
+#include <algorithm>
+
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
+
+namespace DSP::HLE
+{
+static s16 ScaleSample(s16 sample, u16 volume, bool signed_volume)
+{
+  const s32 factor = signed_volume ? s32(s16(volume)) : s32(volume);
+  return static_cast<s16>(std::clamp((s32(sample) * factor) >> 15, -0x8000, 0x7FFF));
+}
+
+static u16 ApplyVolumeRamp_Generic(s16* samples, u32 count, u16 volume, u16 volume_delta,
+                                   bool signed_volume)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    samples[i] = ScaleSample(samples[i], volume, signed_volume);
+    volume += volume_delta;
+  }
+  return volume;
+}
+
+static u16 MixAddWithVolumeRamp_Generic(int* out, const s16* samples, u32 count, u16 volume,
+                                        u16 volume_delta)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    out[i] += ScaleSample(samples[i], volume, false);
+    volume += volume_delta;
+  }
+  return volume;
+}
+
+#ifdef _M_X86_64
+
+// The 32-bit products of the samples and the volumes, shifted right by 15 and saturated to 16 bits,
+// which is exactly what ScaleSample does. An unsigned volume is treated as signed by the multiply,
+// which is corrected for in the high half: v = v_signed + 0x10000 if the top bit is set.
+static __m128i ScaleSamples_SSE2(__m128i samples, __m128i volumes, bool signed_volume)
+{
+  const __m128i low = _mm_mullo_epi16(samples, volumes);
+  __m128i high = _mm_mulhi_epi16(samples, volumes);
+  if (!signed_volume)
+    high = _mm_add_epi16(high, _mm_and_si128(samples, _mm_srai_epi16(volumes, 15)));
+
+  const __m128i products0 = _mm_srai_epi32(_mm_unpacklo_epi16(low, high), 15);
+  const __m128i products1 = _mm_srai_epi32(_mm_unpackhi_epi16(low, high), 15);
+  return _mm_packs_epi32(products0, products1);
+}
+
+// volume, volume + delta, ..., volume + 7 * delta
+static __m128i VolumeRamp_SSE2(u16 volume, u16 volume_delta)
+{
+  const __m128i steps = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm_add_epi16(_mm_set1_epi16(volume),
+                       _mm_mullo_epi16(_mm_set1_epi16(volume_delta), steps));
+}
+
+static u16 ApplyVolumeRamp_SSE2(s16* samples, u32 count, u16 volume, u16 volume_delta,
+                                bool signed_volume)
+{
+  __m128i volumes = VolumeRamp_SSE2(volume, volume_delta);
+  const __m128i step = _mm_set1_epi16(static_cast<u16>(volume_delta * 8));
+
+  u32 i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+    _mm_storeu_si128(ptr, ScaleSamples_SSE2(_mm_loadu_si128(ptr), volumes, signed_volume));
+    volumes = _mm_add_epi16(volumes, step);
+  }
+
+  volume += static_cast<u16>(volume_delta * i);
+  return ApplyVolumeRamp_Generic(samples + i, count - i, volume, volume_delta, signed_volume);
+}
+
+static u16 MixAddWithVolumeRamp_SSE2(int* out, const s16* samples, u32 count, u16 volume,
+                                     u16 volume_delta)
+{
+  __m128i volumes = VolumeRamp_SSE2(volume, volume_delta);
+  const __m128i step = _mm_set1_epi16(static_cast<u16>(volume_delta * 8));
+
+  u32 i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+    const __m128i scaled = ScaleSamples_SSE2(input, volumes, false);
+    volumes = _mm_add_epi16(volumes, step);
+
+    __m128i* dst = reinterpret_cast<__m128i*>(out + i);
+    const __m128i scaled0 = _mm_srai_epi32(_mm_unpacklo_epi16(scaled, scaled), 16);
+    const __m128i scaled1 = _mm_srai_epi32(_mm_unpackhi_epi16(scaled, scaled), 16);
+    _mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), scaled0));
+    _mm_storeu_si128(dst + 1, _mm_add_epi32(_mm_loadu_si128(dst + 1), scaled1));
+  }
+
+  volume += static_cast<u16>(volume_delta * i);
+  return MixAddWithVolumeRamp_Generic(out + i, samples + i, count - i, volume, volume_delta);
+}
+
+// Same as the SSE2 versions, for 16 samples at a time. unpack and pack both work within 128-bit
+// lanes, so the samples end up in the right order.
+FUNCTION_TARGET_AVX2
+static __m256i ScaleSamples_AVX2(__m256i samples, __m256i volumes, bool signed_volume)
+{
+  const __m256i low = _mm256_mullo_epi16(samples, volumes);
+  __m256i high = _mm256_mulhi_epi16(samples, volumes);
+  if (!signed_volume)
+    high = _mm256_add_epi16(high, _mm256_and_si256(samples, _mm256_srai_epi16(volumes, 15)));
+
+  const __m256i products0 = _mm256_srai_epi32(_mm256_unpacklo_epi16(low, high), 15);
+  const __m256i products1 = _mm256_srai_epi32(_mm256_unpackhi_epi16(low, high), 15);
+  return _mm256_packs_epi32(products0, products1);
+}
+
+FUNCTION_TARGET_AVX2
+static __m256i VolumeRamp_AVX2(u16 volume, u16 volume_delta)
+{
+  const __m256i steps =
+      _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  return _mm256_add_epi16(_mm256_set1_epi16(volume),
+                          _mm256_mullo_epi16(_mm256_set1_epi16(volume_delta), steps));
+}
+
+FUNCTION_TARGET_AVX2
+static u16 ApplyVolumeRamp_AVX2(s16* samples, u32 count, u16 volume, u16 volume_delta,
+                                bool signed_volume)
+{
+  __m256i volumes = VolumeRamp_AVX2(volume, volume_delta);
+  const __m256i step = _mm256_set1_epi16(static_cast<u16>(volume_delta * 16));
+
+  u32 i = 0;
+  for (; i + 16 <= count; i += 16)
+  {
+    __m256i* ptr = reinterpret_cast<__m256i*>(samples + i);
+    _mm256_storeu_si256(ptr,
+                        ScaleSamples_AVX2(_mm256_loadu_si256(ptr), volumes, signed_volume));
+    volumes = _mm256_add_epi16(volumes, step);
+  }
+
+  // The rest is done by the SSE2 version, which must not run with the upper halves of the
+  // registers in use.
+  _mm256_zeroupper();
+  volume += static_cast<u16>(volume_delta * i);
+  return ApplyVolumeRamp_SSE2(samples + i, count - i, volume, volume_delta, signed_volume);
+}
+
+FUNCTION_TARGET_AVX2
+static u16 MixAddWithVolumeRamp_AVX2(int* out, const s16* samples, u32 count, u16 volume,
+                                     u16 volume_delta)
+{
+  __m256i volumes = VolumeRamp_AVX2(volume, volume_delta);
+  const __m256i step = _mm256_set1_epi16(static_cast<u16>(volume_delta * 16));
+
+  u32 i = 0;
+  for (; i + 16 <= count; i += 16)
+  {
+    const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(samples + i));
+    const __m256i scaled = ScaleSamples_AVX2(input, volumes, false);
+    volumes = _mm256_add_epi16(volumes, step);
+
+    __m256i* dst = reinterpret_cast<__m256i*>(out + i);
+    const __m256i scaled0 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(scaled));
+    const __m256i scaled1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(scaled, 1));
+    _mm256_storeu_si256(dst, _mm256_add_epi32(_mm256_loadu_si256(dst), scaled0));
+    _mm256_storeu_si256(dst + 1, _mm256_add_epi32(_mm256_loadu_si256(dst + 1), scaled1));
+  }
+
+  _mm256_zeroupper();
+  volume += static_cast<u16>(volume_delta * i);
+  return MixAddWithVolumeRamp_SSE2(out + i, samples + i, count - i, volume, volume_delta);
+}
+
+#endif
+
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume)
+{
+#ifdef _M_X86_64
+  if (cpu_info.bAVX2)
+    return ApplyVolumeRamp_AVX2(samples, count, volume, volume_delta, signed_volume);
+  return ApplyVolumeRamp_SSE2(samples, count, volume, volume_delta, signed_volume);
+#else
+  return ApplyVolumeRamp_Generic(samples, count, volume, volume_delta, signed_volume);
+#endif
+}
+
+u16 MixAddWithVolumeRamp(int* out, const s16* samples, u32 count, u16 volume, u16 volume_delta,
+                         s16* last_sample)
+{
+  if (count != 0)
+  {
+    const u16 last_volume = volume + static_cast<u16>(volume_delta * (count - 1));
+    *last_sample = ScaleSample(samples[count - 1], last_volume, false);
+  }
+
+#ifdef _M_X86_64
+  if (cpu_info.bAVX2)
+    return MixAddWithVolumeRamp_AVX2(out, samples, count, volume, volume_delta);
+  return MixAddWithVolumeRamp_SSE2(out, samples, count, volume, volume_delta);
+#else
+  return MixAddWithVolumeRamp_Generic(out, samples, count, volume, volume_delta);
+#endif
+}
+}  // namespace DSP::HLE
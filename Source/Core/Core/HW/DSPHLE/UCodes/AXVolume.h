@@ -0,0 +1,21 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Volume kernels of the AX voice processing in AXVoice.h, which run once per voice and per output
+// channel. They are vectorized where possible and give the same results everywhere.
+namespace DSP::HLE
+{
+// Multiplies <count> samples in place by a volume (1.15 fixed point), which is increased by
+// volume_delta after each sample and wraps around at 16 bits. The volume is signed on GameCube
+// and unsigned on Wii. Returns the volume after the last sample.
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume);
+
+// Same as ApplyVolumeRamp with an unsigned volume, except that the samples are added to <out>
+// instead. The last of them is written to <last_sample> if there is one.
+u16 MixAddWithVolumeRamp(int* out, const s16* samples, u32 count, u16 volume, u16 volume_delta,
+                         s16* last_sample);
+}  // namespace DSP::HLE
@@ -5,7 +5,9 @@
 
 #include "Core/HW/DSPHLE/UCodes/AXWii.h"
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -439,6 +441,9 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
 
   AXPBWii pb;
 
+  if (m_voice_workers.GetNumWorkers() != 0)
+    pb_addr = ProcessPBListInParallel(pb_addr);
+
   auto& memory = m_dsphle->GetSystem().GetMemory();
   while (pb_addr)
   {
@@ -482,6 +487,66 @@ void AXWiiUCode::ProcessPBList(u32 pb_addr)
   }
 }
 
+u32 AXWiiUCode::ProcessPBListInParallel(u32 pb_addr)
+{
+  constexpr u32 spms = 32;
+
+  auto& memory = m_dsphle->GetSystem().GetMemory();
+  const AXBuffers buffers = {{m_samples_main_left, m_samples_main_right, m_samples_main_surround,
+                              m_samples_auxA_left, m_samples_auxA_right, m_samples_auxA_surround,
+                              m_samples_auxB_left, m_samples_auxB_right, m_samples_auxB_surround,
+                              m_samples_auxC_left, m_samples_auxC_right, m_samples_auxC_surround,
+                              m_samples_wm0,       m_samples_aux0,       m_samples_wm1,
+                              m_samples_aux1,      m_samples_wm2,        m_samples_aux2,
+                              m_samples_wm3,       m_samples_aux3}};
+
+  const auto read_voice = [&](ParallelVoice& voice) {
+    ReadPB(memory, voice.addr, voice.pb);
+    voice.has_updates = m_old_axwii && (voice.pb.updates.num_updates[0] |
+                                        voice.pb.updates.num_updates[1] |
+                                        voice.pb.updates.num_updates[2]);
+    if (!voice.has_updates)
+      return HILO_TO_32(voice.pb.next_pb);
+
+    // Rendering a voice doesn't change next_pb, but the updates can.
+    voice.updates = LoadPBUpdates(memory, voice.pb);
+    AXPBWii updated_pb = voice.pb;
+    for (int curr_ms = 0; curr_ms < 3; ++curr_ms)
+      ApplyUpdatesForMs(curr_ms, updated_pb, updated_pb.updates.num_updates, voice.updates);
+    return HILO_TO_32(updated_pb.next_pb);
+  };
+
+  const auto render_voice = [&](ParallelVoice& voice, HLEAccelerator* accelerator,
+                                AXBuffers thread_buffers) {
+    if (!voice.has_updates)
+    {
+      ProcessVoice(accelerator, voice.pb, thread_buffers, 96,
+                   ConvertMixerControl(HILO_TO_32(voice.pb.mixer_control)),
+                   m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter);
+      return;
+    }
+
+    for (int curr_ms = 0; curr_ms < 3; ++curr_ms)
+    {
+      ApplyUpdatesForMs(curr_ms, voice.pb, voice.pb.updates.num_updates, voice.updates);
+      ProcessVoice(accelerator, voice.pb, thread_buffers, spms,
+                   ConvertMixerControl(HILO_TO_32(voice.pb.mixer_control)),
+                   m_coeffs_checksum ? m_coeffs.data() : nullptr, m_new_filter);
+
+      // Forward the buffers
+      for (auto& ptr : thread_buffers.regular_ptrs)
+        ptr += spms;
+      for (auto& ptr : thread_buffers.wiimote_ptrs)
+        ptr += 6;
+    }
+  };
+
+  return RenderVoicesInParallel(
+      pb_addr, m_voice_workers, m_voice_threads, m_dsphle->GetSystem().GetDSP(), buffers,
+      read_voice, render_voice,
+      [&](const ParallelVoice& voice) { WritePB(memory, voice.addr, voice.pb); });
+}
+
 void AXWiiUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr, u16 volume)
 {
   std::array<u16, 96> volume_ramp;
@@ -1364,6 +1364,7 @@ static void FileReadData(Memory::MemoryManager& memory, File::IOFile* file, u32
   if (length <= span.size())
   {
     file->Seek(seek_pos, File::SeekOrigin::Begin);
+    memory.MarkRangeDirty(address, length);
     file->ReadBytes(span.data(), length);
   }
   else
@@ -145,8 +145,8 @@ void CEXIBaseboard::DMAWrite(u32 addr, u32 size)
 
 void CEXIBaseboard::DMARead(u32 addr, u32 size)
 {
-  const auto& system = Core::System::GetInstance();
-  const auto& memory = system.GetMemory();
+  auto& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
   auto span = memory.GetSpanForAddress(addr);
 
   if (span.size() < size)
@@ -158,6 +158,7 @@ void CEXIBaseboard::DMARead(u32 addr, u32 size)
   NOTICE_LOG_FMT(SP1, "AM-BB: COMMAND: Backup DMA Read: {:08x} {:x}", addr, size);
 
   m_backup.Seek(m_backup_offset, File::SeekOrigin::Begin);
+  memory.MarkRangeDirty(addr, size);
   m_backup.ReadBytes(span.data(), size);
 }
 
@@ -37,6 +37,7 @@
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/WII_IPC.h"
+#include "Core/MemTools.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -238,7 +239,8 @@ bool MemoryManager::InitFastmemArena()
       continue;
 
     void* base = m_physical_base + region.physical_address;
-    void* view = m_arena.MapInMemoryRegion(region.shm_position, region.size, base, true);
+    void* view = m_arena.MapInMemoryRegion(region.shm_position, region.size, base,
+                                           ShouldMapWriteable(region.physical_address, true));
 
     if (base != view)
     {
@@ -309,7 +311,8 @@ void MemoryManager::UpdateDBATMappings(const PowerPC::BatTable& dbat_table)
             u32 position = physical_region.shm_position + intersection_start - mapping_address;
             u8* base = m_logical_base + mapped_logical_address;
 
-            void* mapped_pointer = m_arena.MapInMemoryRegion(position, mapped_size, base, true);
+            void* mapped_pointer = m_arena.MapInMemoryRegion(
+                position, mapped_size, base, ShouldMapWriteable(intersection_start, true));
             if (!mapped_pointer)
             {
               PanicAlertFmt("Memory::UpdateDBATMappings(): Failed to map memory region at 0x{:08X} "
@@ -317,8 +320,9 @@ void MemoryManager::UpdateDBATMappings(const PowerPC::BatTable& dbat_table)
                             intersection_start, mapped_size, logical_address);
               continue;
             }
-            m_dbat_mapped_entries.emplace(logical_address,
-                                          LogicalMemoryView{mapped_pointer, mapped_size});
+            m_dbat_mapped_entries.emplace(
+                logical_address,
+                LogicalMemoryView{mapped_pointer, mapped_size, intersection_start, true});
           }
 
           u32 bat_index = mapped_logical_address / PowerPC::BAT_PAGE_SIZE;
@@ -419,7 +423,9 @@ void MemoryManager::AddHostPageTableMapping(u32 logical_address, u32 translated_
       // Update the protection of an existing mapping.
       if (it->second.mapped_pointer == base && it->second.mapped_size == mapped_size)
       {
-        if (!m_arena.ChangeMappingProtection(base, mapped_size, writeable))
+        it->second.writeable = writeable;
+        if (!m_arena.ChangeMappingProtection(base, mapped_size,
+                                             ShouldMapWriteable(intersection_start, writeable)))
         {
           PanicAlertFmt("Memory::AddPageTableMapping(): Failed to change protection for memory "
                         "region at 0x{:08X} (size 0x{:08X}, logical fastmem region at 0x{:08X}).",
@@ -430,8 +436,8 @@ void MemoryManager::AddHostPageTableMapping(u32 logical_address, u32 translated_
     else
     {
       // Create a new mapping.
-      void* const mapped_pointer =
-          m_arena.MapInMemoryRegion(position, mapped_size, base, writeable);
+      void* const mapped_pointer = m_arena.MapInMemoryRegion(
+          position, mapped_size, base, ShouldMapWriteable(intersection_start, writeable));
       if (!mapped_pointer)
       {
         PanicAlertFmt("Memory::AddPageTableMapping(): Failed to map memory region at 0x{:08X} "
@@ -439,8 +445,9 @@ void MemoryManager::AddHostPageTableMapping(u32 logical_address, u32 translated_
                       intersection_start, mapped_size, logical_address);
         continue;
       }
-      m_page_table_mapped_entries.emplace(logical_address,
-                                          LogicalMemoryView{mapped_pointer, mapped_size});
+      m_page_table_mapped_entries.emplace(
+          logical_address,
+          LogicalMemoryView{mapped_pointer, mapped_size, intersection_start, writeable});
     }
   }
 }
@@ -539,19 +546,284 @@ void MemoryManager::DoState(PointerWrap& p)
     return;
   }
 
-  p.DoArray(m_ram, current_ram_size);
+  // Loading overwrites all of MEM1 and MEM2. Rather than taking a fault for every page, mark
+  // everything as dirty up front.
+  const bool include_ram = !m_exclude_ram_from_state;
+  if (include_ram && p.IsReadMode())
+    MarkAllPagesDirty();
+
+  if (include_ram)
+    p.DoArray(m_ram, current_ram_size);
   p.DoArray(m_l1_cache, current_l1_cache_size);
   p.DoMarker("Memory RAM");
   if (current_have_fake_vmem)
     p.DoArray(m_fake_vmem, current_fake_vmem_size);
   p.DoMarker("Memory FakeVMEM");
-  if (current_have_exram)
+  if (current_have_exram && include_ram)
     p.DoArray(m_exram, current_exram_size);
   p.DoMarker("Memory EXRAM");
 }
 
+bool MemoryManager::IsTrackedRegion(const PhysicalMemoryRegion& region) const
+{
+  return region.active && (region.out_pointer == &m_ram || region.out_pointer == &m_exram);
+}
+
+std::optional<size_t> MemoryManager::GetTrackedPageIndex(u32 physical_address) const
+{
+  size_t pages_before = 0;
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (!IsTrackedRegion(region))
+      continue;
+
+    if (physical_address >= region.physical_address &&
+        physical_address - region.physical_address < region.size)
+    {
+      return pages_before + (physical_address - region.physical_address) / m_page_size;
+    }
+    pages_before += region.size / m_page_size;
+  }
+  return std::nullopt;
+}
+
+u32 MemoryManager::GetTrackedPagePhysicalAddress(size_t index) const
+{
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (!IsTrackedRegion(region))
+      continue;
+
+    const size_t region_pages = region.size / m_page_size;
+    if (index < region_pages)
+      return region.physical_address + static_cast<u32>(index) * m_page_size;
+    index -= region_pages;
+  }
+  return INVALID_MAPPING;
+}
+
+bool MemoryManager::ShouldMapWriteable(u32 physical_address, bool writeable) const
+{
+  return writeable && !(m_dirty_page_tracking && GetTrackedPageIndex(physical_address));
+}
+
+void MemoryManager::SetTrackedMappingsWriteable(bool writeable)
+{
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (!IsTrackedRegion(region))
+      continue;
+
+    m_arena.ChangeMappingProtection(*region.out_pointer, region.size, writeable);
+    if (m_is_fastmem_arena_initialized)
+    {
+      m_arena.ChangeMappingProtection(m_physical_base + region.physical_address, region.size,
+                                      writeable);
+    }
+  }
+
+  for (const auto& [logical_address, entry] : m_dbat_mapped_entries)
+  {
+    if (GetTrackedPageIndex(entry.physical_address))
+      m_arena.ChangeMappingProtection(entry.mapped_pointer, entry.mapped_size, writeable);
+  }
+
+  for (const auto& [logical_address, entry] : m_page_table_mapped_entries)
+  {
+    if (entry.writeable && GetTrackedPageIndex(entry.physical_address))
+      m_arena.ChangeMappingProtection(entry.mapped_pointer, entry.mapped_size, writeable);
+  }
+}
+
+bool MemoryManager::StartDirtyPageTracking()
+{
+  if (m_dirty_page_tracking)
+    return true;
+
+  // Faults may come from any thread that writes to emulated memory, not just the CPU thread.
+  if (!EMM::IsExceptionHandlerSupported() || !EMM::IsExceptionHandlerProcessWide())
+    return false;
+
+  m_num_tracked_pages = 0;
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (IsTrackedRegion(region))
+      m_num_tracked_pages += region.size / m_page_size;
+  }
+  m_dirty_pages = std::make_unique<std::atomic<bool>[]>(m_num_tracked_pages);
+
+  while (m_dirty_page_lock.test_and_set(std::memory_order_acquire))
+  {
+  }
+  m_dirty_page_tracking = true;
+  SetTrackedMappingsWriteable(false);
+  m_dirty_page_lock.clear(std::memory_order_release);
+
+  INFO_LOG_FMT(MEMMAP, "Started dirty page tracking for {} pages", m_num_tracked_pages);
+  return true;
+}
+
+void MemoryManager::StopDirtyPageTracking()
+{
+  if (!m_dirty_page_tracking)
+    return;
+
+  while (m_dirty_page_lock.test_and_set(std::memory_order_acquire))
+  {
+  }
+  m_dirty_page_tracking = false;
+  SetTrackedMappingsWriteable(true);
+  m_dirty_page_lock.clear(std::memory_order_release);
+
+  m_dirty_pages.reset();
+  m_num_tracked_pages = 0;
+}
+
+std::vector<u32> MemoryManager::CollectDirtyPages()
+{
+  std::vector<u32> dirty_pages;
+  if (!m_dirty_page_tracking)
+    return dirty_pages;
+
+  // Holding the lock keeps the fault handler from making a page writeable again between it being
+  // write-protected and its flag being cleared here, which would lose any write after that point.
+  while (m_dirty_page_lock.test_and_set(std::memory_order_acquire))
+  {
+  }
+  SetTrackedMappingsWriteable(false);
+  for (size_t i = 0; i < m_num_tracked_pages; ++i)
+  {
+    if (m_dirty_pages[i].exchange(false, std::memory_order_relaxed))
+      dirty_pages.push_back(GetTrackedPagePhysicalAddress(i));
+  }
+  m_dirty_page_lock.clear(std::memory_order_release);
+
+  return dirty_pages;
+}
+
+void MemoryManager::MarkPageDirty(u32 physical_address, void* host_page)
+{
+  const std::optional<size_t> index = GetTrackedPageIndex(physical_address);
+  if (!index)
+    return;
+
+  while (m_dirty_page_lock.test_and_set(std::memory_order_acquire))
+  {
+  }
+  // Tracking may have been stopped while waiting for the lock, which makes everything writeable.
+  if (m_dirty_page_tracking)
+  {
+    m_dirty_pages[*index].store(true, std::memory_order_relaxed);
+    m_arena.ChangeMappingProtection(host_page, m_page_size, true);
+  }
+  m_dirty_page_lock.clear(std::memory_order_release);
+}
+
+void MemoryManager::MarkAllPagesDirty()
+{
+  if (!m_dirty_page_tracking)
+    return;
+
+  while (m_dirty_page_lock.test_and_set(std::memory_order_acquire))
+  {
+  }
+  for (size_t i = 0; i < m_num_tracked_pages; ++i)
+    m_dirty_pages[i].store(true, std::memory_order_relaxed);
+  SetTrackedMappingsWriteable(true);
+  m_dirty_page_lock.clear(std::memory_order_release);
+}
+
+void MemoryManager::MarkRangeDirty(u32 address, size_t size)
+{
+  if (!m_dirty_page_tracking || size == 0)
+    return;
+
+  // Same address decoding as GetSpanForAddress, but covering the whole host mapping.
+  address &= 0x3FFFFFFF;
+  u32 physical_address = address;
+  if ((address >> 28) == 0x1 && m_exram)
+    physical_address = 0x10000000 | (address & GetExRamMask());
+
+  const u32 first_page = physical_address & ~(m_page_size - 1);
+  const u64 end = u64{physical_address} + size;
+  for (u64 page = first_page; page < end; page += m_page_size)
+  {
+    const u32 page_address = static_cast<u32>(page);
+    u8* const host_page = page_address < 0x10000000 ? m_ram + page_address :
+                                                      m_exram + (page_address - 0x10000000);
+    MarkPageDirty(page_address, host_page);
+  }
+}
+
+bool MemoryManager::HandleDirtyPageFault(uintptr_t fault_address)
+{
+  if (!m_dirty_page_tracking)
+    return false;
+
+  u8* const address = reinterpret_cast<u8*>(fault_address);
+  u8* const host_page = reinterpret_cast<u8*>(fault_address & ~uintptr_t{m_page_size - 1});
+
+  // Writes from anywhere but JIT code go through the main views.
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (IsTrackedRegion(region) && address >= *region.out_pointer &&
+        address < *region.out_pointer + region.size)
+    {
+      MarkPageDirty(region.physical_address + static_cast<u32>(address - *region.out_pointer),
+                    host_page);
+      return true;
+    }
+  }
+
+  if (!m_is_fastmem_arena_initialized || !IsAddressInFastmemArea(address))
+    return false;
+
+  // Fastmem accesses only happen on the CPU thread, which is also the only thread that changes
+  // the logical mappings, so looking them up here can't race with them being modified.
+  std::optional<u32> physical_address;
+  if (address >= m_physical_base && address < m_physical_base + 0x1'0000'0000)
+  {
+    physical_address = static_cast<u32>(address - m_physical_base);
+  }
+  else if (address >= m_logical_base && address < m_logical_base + 0x1'0000'0000)
+  {
+    const auto translate = [address](const LogicalMemoryView& entry) -> std::optional<u32> {
+      u8* const mapped_pointer = static_cast<u8*>(entry.mapped_pointer);
+      // Writes to pages the guest isn't allowed to write to are for the JIT to handle.
+      if (!entry.writeable || address < mapped_pointer ||
+          address >= mapped_pointer + entry.mapped_size)
+      {
+        return std::nullopt;
+      }
+      return entry.physical_address + static_cast<u32>(address - mapped_pointer);
+    };
+
+    for (const auto& [logical_address, entry] : m_dbat_mapped_entries)
+    {
+      physical_address = translate(entry);
+      if (physical_address)
+        break;
+    }
+
+    if (!physical_address)
+    {
+      const u32 logical_address = static_cast<u32>(address - m_logical_base);
+      const auto it = m_page_table_mapped_entries.find(logical_address & ~(m_page_size - 1));
+      if (it != m_page_table_mapped_entries.end())
+        physical_address = translate(it->second);
+    }
+  }
+
+  if (!physical_address || !GetTrackedPageIndex(*physical_address))
+    return false;
+
+  MarkPageDirty(*physical_address, host_page);
+  return true;
+}
+
 void MemoryManager::Shutdown()
 {
+  StopDirtyPageTracking();
   ShutdownFastmemArena();
 
   m_is_initialized = false;
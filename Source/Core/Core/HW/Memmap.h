@@ -4,8 +4,12 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <span>
 #include <string>
@@ -58,6 +62,10 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 physical_address;
+  // Whether the guest is allowed to write through this view. While dirty page tracking is active,
+  // the host mapping may be write-protected even if this is set.
+  bool writeable;
 };
 
 class MemoryManager
@@ -106,6 +114,27 @@ public:
   void ShutdownFastmemArena();
   void DoState(PointerWrap& p);
 
+  // When set, DoState() doesn't include MEM1 and MEM2. For states which keep track of those
+  // separately, using dirty page tracking.
+  void SetExcludeRAMFromState(bool exclude) { m_exclude_ram_from_state = exclude; }
+
+  // Dirty page tracking for MEM1 and MEM2. While active, they are write-protected in every host
+  // mapping of them, and the first write to each host page is caught by the fault handler, which
+  // marks the page as dirty and makes it writeable again until the next CollectDirtyPages() call.
+  //
+  // Writes done by the host OS (such as reading a file or receiving from a socket straight into
+  // emulated memory) fail instead of faulting, so code doing those must call MarkRangeDirty() on
+  // the range first. Writes done by host code, on any thread, are caught like guest ones.
+  bool StartDirtyPageTracking();
+  void StopDirtyPageTracking();
+  bool IsDirtyPageTrackingActive() const { return m_dirty_page_tracking; }
+  // Returns the physical addresses of the host pages written to since the last call, and
+  // write-protects them again.
+  std::vector<u32> CollectDirtyPages();
+  void MarkRangeDirty(u32 address, size_t size);
+  // Called by the fault handler. Returns true if the fault was caused by dirty page tracking.
+  bool HandleDirtyPageFault(uintptr_t fault_address);
+
   void UpdateDBATMappings(const PowerPC::BatTable& dbat_table);
   void AddPageTableMapping(u32 logical_address, u32 translated_address, bool writeable);
   void RemovePageTableMappings(const std::set<u32>& mappings);
@@ -284,6 +313,16 @@ private:
   std::map<u32, std::vector<u32>> m_large_readable_pages;
   std::map<u32, std::vector<u32>> m_large_writeable_pages;
 
+  bool m_exclude_ram_from_state = false;
+
+  std::atomic<bool> m_dirty_page_tracking = false;
+  // One flag per host page, MEM1 pages first, followed by MEM2 pages.
+  std::unique_ptr<std::atomic<bool>[]> m_dirty_pages;
+  size_t m_num_tracked_pages = 0;
+  // Taken when changing protection for dirty page tracking. This is a spin lock rather than a
+  // mutex because the fault handler, which may run in a signal handler, has to take it as well.
+  std::atomic_flag m_dirty_page_lock;
+
   Core::System& m_system;
 
   static HostPageType GetHostPageTypeForPageSize(u32 page_size);
@@ -297,5 +336,13 @@ private:
   void RemoveLargePageTableMapping(u32 logical_address);
   void RemoveLargePageTableMapping(u32 logical_address, std::map<u32, std::vector<u32>>& map);
   void RemoveHostPageTableMapping(u32 logical_address);
+
+  bool IsTrackedRegion(const PhysicalMemoryRegion& region) const;
+  std::optional<size_t> GetTrackedPageIndex(u32 physical_address) const;
+  u32 GetTrackedPagePhysicalAddress(size_t index) const;
+  bool ShouldMapWriteable(u32 physical_address, bool writeable) const;
+  void SetTrackedMappingsWriteable(bool writeable);
+  void MarkPageDirty(u32 physical_address, void* host_page);
+  void MarkAllPagesDirty();
 };
 }  // namespace Memory
@@ -649,6 +649,8 @@ void WiiSocket::Update(bool read, bool write, bool except)
 
           u32 flags = memory.Read_U32(BufferIn + 0x04);
           int data_len = BufferOutSize;
+          // recvfrom() writes straight to emulated memory, which must be writeable for the OS.
+          memory.MarkRangeDirty(BufferOut, BufferOutSize);
           // Not a string, Windows requires a char* for recvfrom
           char* data = reinterpret_cast<char*>(memory.GetPointerForRange(BufferOut, BufferOutSize));
 
@@ -288,6 +288,7 @@ s32 SDIOSlot0Device::ExecuteCommand(const Request& request, u32 buffer_in, u32 b
     if (!m_card.Seek(address, File::SeekOrigin::Begin))
       ERROR_LOG_FMT(IOS_SD, "Seek failed");
 
+    memory.MarkRangeDirty(req.addr, size);
     if (m_card.ReadBytes(memory.GetPointerForRange(req.addr, size), size))
     {
       DEBUG_LOG_FMT(IOS_SD, "Outbuffer size {} got {}", rw_buffer_size, size);
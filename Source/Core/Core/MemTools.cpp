@@ -120,6 +120,11 @@ bool IsExceptionHandlerSupported()
   return true;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  return true;
+}
+
 #elif defined(__APPLE__) && !defined(USE_SIGACTION_ON_APPLE)
 
 static void CheckKR(const char* name, kern_return_t kr)
@@ -256,6 +261,12 @@ bool IsExceptionHandlerSupported()
   return true;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  // Exception ports are only set up for the thread which called InstallExceptionHandler().
+  return false;
+}
+
 #elif defined(_POSIX_VERSION) && !defined(_M_GENERIC)
 
 static struct sigaction old_sa_segv;
@@ -348,6 +359,11 @@ bool IsExceptionHandlerSupported()
   return true;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  return true;
+}
+
 #else  // _M_GENERIC or unsupported platform
 
 void InstallExceptionHandler()
@@ -363,6 +379,11 @@ bool IsExceptionHandlerSupported()
   return false;
 }
 
+bool IsExceptionHandlerProcessWide()
+{
+  return false;
+}
+
 #endif
 
 }  // namespace EMM
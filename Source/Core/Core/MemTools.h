@@ -8,4 +8,6 @@ namespace EMM
 void InstallExceptionHandler();
 void UninstallExceptionHandler();
 bool IsExceptionHandlerSupported();
+// Whether faults on threads other than the one which installed the handler are handled as well.
+bool IsExceptionHandlerProcessWide();
 }  // namespace EMM
@@ -26,6 +26,7 @@
 #include "Common/x64ABI.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
+#include "Core/Debugger/CodeTrace.h"
 #include "Core/HLE/HLE.h"
 #include "Core/HW/CPU.h"
 #include "Core/HW/GPFifo.h"
@@ -313,6 +314,8 @@ void Jit64::ClearCache()
   RefreshConfig();
   asm_routines.Regenerate();
   ResetFreeMemoryRanges();
+  m_warm_start_cache.Rearm();
+  m_trace_profile.Clear();
   Host_JitCacheInvalidation();
 }
 
@@ -338,6 +341,9 @@ void Jit64::ResetFreeMemoryRanges()
 
 void Jit64::Shutdown()
 {
+  m_warm_start_cache.Save();
+  m_warm_start_cache.Clear();
+
   FreeCodeSpace();
 
   auto& memory = m_system.GetMemory();
@@ -388,8 +394,10 @@ void Jit64::FallBackToInterpreter(UGeckoInstruction inst)
     }
     else
     {
+      // A trace continues at the target of a branch it follows.
+      const u32 inline_pc = js.op->branchTakenIsInlined ? js.op->branchTo : js.compilerPC + 4;
       MOV(32, R(RSCRATCH), PPCSTATE(npc));
-      CMP(32, R(RSCRATCH), Imm32(js.compilerPC + 4));
+      CMP(32, R(RSCRATCH), Imm32(inline_pc));
       FixupBranch c = J_CC(CC_Z);
       MOV(32, PPCSTATE(pc), R(RSCRATCH));
       WriteExceptionExit();
@@ -753,6 +761,14 @@ void Jit64::SingleStep()
   UnprotectStack();
 }
 
+bool Jit64::SupportsCodeTrace() const
+{
+  // Traced code runs on whichever thread holds the CPU, which needs the BLR optimization to be off,
+  // as it is while debugging. The instructions also have to stay in order, which they only do
+  // while stepping without profiling.
+  return IsDebuggingEnabled() && !IsProfilingEnabled() && m_system.GetCPU().IsStepping();
+}
+
 void Jit64::Trace()
 {
   std::string regs;
@@ -798,6 +814,12 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   }
   FreeRanges();
 
+  if (m_enable_warm_start_cache && !IsDebuggingEnabled() &&
+      !SConfig::GetInstance().bJITNoBlockCache)
+  {
+    WarmUpBlocks(em_address);
+  }
+
   std::size_t block_size = m_code_buffer.size();
 
   if (IsDebuggingEnabled())
@@ -810,10 +832,15 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     {
       if (m_system.GetCPU().IsStepping())
       {
-        block_size = 1;
+        // Code traces check every instruction before it runs, so they can run whole blocks.
+        // The instructions still have to stay in order, though.
+        if (!IsCodeTraceEnabled())
+        {
+          block_size = 1;
 
-        // Do not link this block to other blocks While single stepping
-        jo.enableBlocklink = false;
+          // Do not link this block to other blocks While single stepping
+          jo.enableBlocklink = false;
+        }
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
@@ -824,11 +851,24 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  // Blocks which have become hot are compiled again as traces, which follow the branch directions
+  // counted by the first-tier code.
+  m_compiling_trace =
+      m_enable_trace_tier && !IsDebuggingEnabled() && m_trace_profile.IsHot(em_address);
+  if (m_compiling_trace)
+  {
+    analyzer.SetTraceBranchPredicate(
+        [this](u32 address) { return m_trace_profile.IsBranchMostlyTaken(address); });
+  }
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
 
+  if (m_compiling_trace)
+    analyzer.SetTraceBranchPredicate({});
+
   if (code_block.m_memory_exception)
   {
     // Address of instruction could not be translated
@@ -840,38 +880,16 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     return;
   }
 
-  if (SetEmitterStateToFreeCodeRegion())
+  if (EmitBlock(em_address, nextPC))
   {
-    u8* near_start = GetWritableCodePtr();
-    u8* far_start = m_far_code.GetWritableCodePtr();
-
-    JitBlock* b = blocks.AllocateBlock(em_address);
-    if (DoJit(em_address, b, nextPC))
+    // Traces are not recorded, as warming up compiles first-tier blocks.
+    if (m_enable_warm_start_cache && !IsDebuggingEnabled() && !m_compiling_trace)
     {
-      // Code generation succeeded.
-
-      // Mark the memory regions that this code block uses as used in the local rangesets.
-      u8* near_end = GetWritableCodePtr();
-      if (near_start != near_end)
-        m_free_ranges_near.erase(near_start, near_end);
-      u8* far_end = m_far_code.GetWritableCodePtr();
-      if (far_start != far_end)
-        m_free_ranges_far.erase(far_start, far_end);
-
-      // Store the used memory regions in the block so we know what to mark as unused when the
-      // block gets invalidated.
-      b->near_begin = near_start;
-      b->near_end = near_end;
-      b->far_begin = far_start;
-      b->far_end = far_end;
-
-      blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block, m_code_buffer);
-
-#ifdef JIT_LOG_GENERATED_CODE
-      LogGeneratedCode();
-#endif
-      return;
+      m_warm_start_cache.Record(
+          em_address, m_ppc_state.feature_flags, code_block.m_num_instructions,
+          JitWarmStartCache::HashCodeBuffer(m_code_buffer, code_block.m_num_instructions));
     }
+    return;
   }
 
   if (clear_cache_and_retry_on_failure)
@@ -912,6 +930,123 @@ bool Jit64::SetEmitterStateToFreeCodeRegion()
   return true;
 }
 
+JitBlock* Jit64::EmitBlock(u32 em_address, u32 nextPC)
+{
+  if (!SetEmitterStateToFreeCodeRegion())
+    return nullptr;
+
+  u8* near_start = GetWritableCodePtr();
+  u8* far_start = m_far_code.GetWritableCodePtr();
+
+  JitBlock* b = blocks.AllocateBlock(em_address);
+  if (!DoJit(em_address, b, nextPC))
+    return nullptr;
+
+  // Code generation succeeded.
+
+  // Mark the memory regions that this code block uses as used in the local rangesets.
+  u8* near_end = GetWritableCodePtr();
+  if (near_start != near_end)
+    m_free_ranges_near.erase(near_start, near_end);
+  u8* far_end = m_far_code.GetWritableCodePtr();
+  if (far_start != far_end)
+    m_free_ranges_far.erase(far_start, far_end);
+
+  // Store the used memory regions in the block so we know what to mark as unused when the
+  // block gets invalidated.
+  b->near_begin = near_start;
+  b->near_end = near_end;
+  b->far_begin = far_start;
+  b->far_end = far_end;
+
+  blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block, m_code_buffer);
+
+#ifdef JIT_LOG_GENERATED_CODE
+  LogGeneratedCode();
+#endif
+
+  return b;
+}
+
+void Jit64::WarmUpBlocks(u32 em_address)
+{
+  if (m_game_id != m_warm_start_cache.GetGameID())
+  {
+    m_warm_start_cache.Save();
+    m_warm_start_cache.Load(m_game_id);
+  }
+
+  const std::vector<JitWarmStartCache::Entry> entries =
+      m_warm_start_cache.TakeEntriesToWarm(m_ppc_state.feature_flags);
+  if (entries.empty())
+    return;
+
+  // Leave most of the code space to the blocks the game actually runs right now.
+  constexpr size_t WARM_UP_CODE_BUDGET = CODE_SIZE / 4;
+  size_t code_size = 0;
+  size_t num_compiled = 0;
+
+  m_warming_up = true;
+  m_compiling_trace = false;
+  for (const JitWarmStartCache::Entry& entry : entries)
+  {
+    if (code_size >= WARM_UP_CODE_BUDGET)
+      break;
+
+    // The block being compiled right now is left to the caller, which would otherwise emit it a
+    // second time.
+    if (entry.effective_address == em_address ||
+        blocks.GetBlockFromStartAddress(entry.effective_address, m_ppc_state.feature_flags))
+    {
+      continue;
+    }
+
+    const u32 nextPC = analyzer.Analyze(entry.effective_address, &code_block, &m_code_buffer,
+                                        m_code_buffer.size());
+    if (code_block.m_memory_exception ||
+        code_block.m_num_instructions != entry.num_instructions ||
+        JitWarmStartCache::HashCodeBuffer(m_code_buffer, code_block.m_num_instructions) !=
+            entry.code_hash)
+    {
+      continue;
+    }
+
+    // Blocks using GQRs are specialized on the values the GQRs have at compile time, which is
+    // meaningless here. Leave them to be compiled when they are first executed.
+    if (ComputeStaticGQRs(code_block))
+      continue;
+
+    const JitBlock* b = EmitBlock(entry.effective_address, nextPC);
+    if (!b)
+    {
+      WARN_LOG_FMT(DYNA_REC, "Ran out of code space while warming up the JIT cache");
+      ClearCache();
+      break;
+    }
+
+    code_size += (b->near_end - b->near_begin) + (b->far_end - b->far_begin);
+    ++num_compiled;
+  }
+  m_warming_up = false;
+
+  INFO_LOG_FMT(DYNA_REC, "Warmed up {} of {} recorded JIT blocks ({} bytes)", num_compiled,
+               entries.size(), code_size);
+}
+
+bool Jit64::IsProfilingForTraces() const
+{
+  return m_enable_trace_tier && !IsDebuggingEnabled() && !m_compiling_trace;
+}
+
+void Jit64::PromoteToTrace(Jit64& jit, u32 address)
+{
+  jit.m_trace_profile.MarkHot(address);
+
+  // The dispatcher compiles the trace in place of the block.
+  if (JitBlock* b = jit.blocks.GetBlockFromStartAddress(address, jit.m_ppc_state.feature_flags))
+    jit.blocks.EraseSingleBlock(*b);
+}
+
 bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 {
   js.firstFPInstructionFound = false;
@@ -938,6 +1073,23 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   if (IsProfilingEnabled())
     ABI_CallFunctionP(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
 
+  if (IsProfilingForTraces())
+  {
+    // Count down the executions of the block, and have it recompiled as a trace once it is hot.
+    MOV(64, R(RSCRATCH), ImmPtr(m_trace_profile.GetEntryCounter(js.blockStart)));
+    SUB(32, MatR(RSCRATCH), Imm8(1));
+    FixupBranch hot = J_CC(CC_Z, Jump::Near);
+
+    SwitchToFarCode();
+    SetJumpTarget(hot);
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionPC(PromoteToTrace, this, js.blockStart);
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    JMP(asm_routines.dispatcher_no_check, true);
+    SwitchToNearCode();
+  }
+
 #if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
   // should help logged stack-traces become more accurate
   MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
@@ -987,7 +1139,8 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     }
   }
 
-  if (!js.noSpeculativeConstantsAddresses.contains(js.blockStart))
+  // While warming up, the register values have nothing to do with the block being compiled.
+  if (!m_warming_up && !js.noSpeculativeConstantsAddresses.contains(js.blockStart))
   {
     IntializeSpeculativeConstants();
   }
@@ -1103,6 +1256,27 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         SetJumpTarget(noBreakpoint);
       }
 
+      if (IsCodeTraceEnabled())
+      {
+        gpr.Flush();
+        fpr.Flush();
+
+        MOV(32, PPCSTATE(pc), Imm32(op.address));
+        ABI_PushRegistersAndAdjustStack({}, 0);
+        ABI_CallFunctionPPC(CodeTrace::TraceInstructionFromJIT, m_code_trace, &m_ppc_state,
+                            op.inst.hex);
+        ABI_PopRegistersAndAdjustStack({}, 0);
+        TEST(8, R(ABI_RETURN), R(ABI_RETURN));
+        FixupBranch continue_trace = J_CC(CC_Z);
+
+        Cleanup();
+        MOV(32, PPCSTATE(npc), Imm32(op.address));
+        SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
+        JMP(asm_routines.dispatcher_exit);
+
+        SetJumpTarget(continue_trace);
+      }
+
       if ((opinfo->flags & FL_USE_FPU) && !js.firstFPInstructionFound)
       {
         // This instruction uses FPU - needs to add FP exception bailout
@@ -32,6 +32,8 @@
 #include "Core/PowerPC/JitCommon/ConstantPropagation.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitCommon/JitTraceProfile.h"
+#include "Core/PowerPC/JitCommon/JitWarmStartCache.h"
 
 class HostDisassembler;
 namespace PPCAnalyst
@@ -64,6 +66,9 @@ public:
   void Jit(u32 em_address) override;
   void Jit(u32 em_address, bool clear_cache_and_retry_on_failure);
   bool DoJit(u32 em_address, JitBlock* b, u32 nextPC);
+  // Emits the block that was last analyzed into code_block and m_code_buffer.
+  // Returns nullptr if there is not enough free space in the near or far code regions.
+  JitBlock* EmitBlock(u32 em_address, u32 nextPC);
 
   void EraseSingleBlock(const JitBlock& block) override;
   std::vector<MemoryStats> GetMemoryStats() const override;
@@ -91,6 +96,8 @@ public:
 
   const CommonAsmRoutines* GetAsmRoutines() override { return &asm_routines; }
   const char* GetName() const override { return "JIT64"; }
+
+  bool SupportsCodeTrace() const override;
   // Run!
   void Run() override;
   void SingleStep() override;
@@ -111,6 +118,9 @@ public:
   template <bool condition>
   void WriteBranchWatch(u32 origin, u32 destination, UGeckoInstruction inst, BitSet32 caller_save);
   void WriteBranchWatchDestInRSCRATCH(u32 origin, UGeckoInstruction inst, BitSet32 caller_save);
+  // Counts which way a conditional branch went, if the block is a first-tier block which profiles
+  // for traces. Clobbers RSCRATCH and the flags.
+  void WriteBranchCount(u32 origin, bool taken);
 
   bool Cleanup();
 
@@ -282,6 +292,15 @@ private:
 
   void LogGeneratedCode() const;
 
+  // Compiles the blocks recorded in previous sessions of the running game.
+  void WarmUpBlocks(u32 em_address);
+
+  // Whether the block being compiled counts its executions and branch directions, so that it
+  // can be recompiled as a trace once it becomes hot.
+  bool IsProfilingForTraces() const;
+  // Called by a first-tier block when it has become hot.
+  static void PromoteToTrace(Jit64& jit, u32 address);
+
   static void ImHere(Jit64& jit);
 
   JitBlockCache blocks{*this};
@@ -297,6 +316,12 @@ private:
   Common::RangeSizeSet<u8*> m_free_ranges_near;
   Common::RangeSizeSet<u8*> m_free_ranges_far;
 
+  JitWarmStartCache m_warm_start_cache;
+  bool m_warming_up = false;
+
+  JitTraceProfile m_trace_profile;
+  bool m_compiling_trace = false;
+
   const bool m_im_here_debug = false;
   const bool m_im_here_log = false;
   std::map<u32, int> m_been_here;
@@ -105,6 +105,15 @@ void Jit64::WriteBranchWatchDestInRSCRATCH(u32 origin, UGeckoInstruction inst, B
   }
 }
 
+void Jit64::WriteBranchCount(u32 origin, bool taken)
+{
+  if (!IsProfilingForTraces())
+    return;
+
+  MOV(64, R(RSCRATCH), ImmPtr(m_trace_profile.GetBranchCounter(origin, taken)));
+  ADD(32, MatR(RSCRATCH), Imm8(1));
+}
+
 void Jit64::bx(UGeckoInstruction inst)
 {
   INSTRUCTION_START
@@ -179,6 +188,30 @@ void Jit64::bcx(UGeckoInstruction inst)
   if (inst.LK)
     MOV(32, PPCSTATE_LR, Imm32(js.compilerPC + 4));
 
+  if (js.op->branchTakenIsInlined)
+  {
+    // The trace continues at the branch target, so it's not taking the branch that leaves it.
+    // That is the unlikely case, so it goes to the far code.
+    SwitchToFarCode();
+    if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
+      SetJumpTarget(pConditionDontBranch);
+    if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+      SetJumpTarget(pCTRDontBranch);
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+      gpr.Flush();
+      fpr.Flush();
+
+      WriteBranchWatch<false>(js.compilerPC, js.compilerPC + 4, inst, {});
+      WriteExit(js.compilerPC + 4);
+    }
+    SwitchToNearCode();
+
+    WriteBranchWatch<true>(js.compilerPC, js.op->branchTo, inst, CallerSavedRegistersInUse());
+    return;
+  }
+
   // If this is not the last instruction of a block
   // and an unconditional branch, we will skip the rest process.
   // Because PPCAnalyst::Flatten() merged the blocks.
@@ -202,6 +235,7 @@ void Jit64::bcx(UGeckoInstruction inst)
     gpr.Flush();
     fpr.Flush();
 
+    WriteBranchCount(js.compilerPC, true);
     WriteBranchWatch<true>(js.compilerPC, js.op->branchTo, inst, {});
     if (js.op->branchIsIdleLoop)
     {
@@ -218,6 +252,8 @@ void Jit64::bcx(UGeckoInstruction inst)
   if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
     SetJumpTarget(pCTRDontBranch);
 
+  WriteBranchCount(js.compilerPC, false);
+
   if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE))
   {
     gpr.Flush();
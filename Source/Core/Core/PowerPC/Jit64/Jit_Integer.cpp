@@ -450,6 +450,27 @@ void Jit64::DoMergedBranchCondition()
     break;
   }
 
+  if (js.op[1].branchTakenIsInlined)
+  {
+    // The trace continues at the branch target, so not taking the branch leaves it.
+    SwitchToFarCode();
+    SetJumpTarget(pDontBranch);
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+
+      gpr.Flush();
+      fpr.Flush();
+
+      WriteBranchWatch<false>(nextPC, nextPC + 4, next, {});
+      WriteExit(nextPC + 4);
+    }
+    SwitchToNearCode();
+
+    WriteBranchWatch<true>(nextPC, js.op[1].branchTo, next, CallerSavedRegistersInUse());
+    return;
+  }
+
   {
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
@@ -457,11 +478,16 @@ void Jit64::DoMergedBranchCondition()
     gpr.Flush();
     fpr.Flush();
 
+    if (next.OPCD == 16)
+      WriteBranchCount(nextPC, true);
     DoMergedBranch();
   }
 
   SetJumpTarget(pDontBranch);
 
+  if (next.OPCD == 16)
+    WriteBranchCount(nextPC, false);
+
   if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE))
   {
     gpr.Flush();
@@ -503,7 +529,25 @@ void Jit64::DoMergedBranchImmediate(s64 val)
     break;
   }
 
-  if (branch)
+  if (js.op[1].branchTakenIsInlined)
+  {
+    // The trace continues at the branch target.
+    if (!branch)
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+
+      gpr.Flush();
+      fpr.Flush();
+      WriteBranchWatch<false>(nextPC, nextPC + 4, next, {});
+      WriteExit(nextPC + 4);
+    }
+    else
+    {
+      WriteBranchWatch<true>(nextPC, js.op[1].branchTo, next, CallerSavedRegistersInUse());
+    }
+  }
+  else if (branch)
   {
     gpr.Flush();
     fpr.Flush();
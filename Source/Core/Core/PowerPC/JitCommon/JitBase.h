@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <iosfwd>
 #include <map>
+#include <string>
 #include <string_view>
 #include <unordered_set>
 #include <utility>
@@ -35,6 +36,7 @@ namespace PowerPC
 class MMU;
 struct PowerPCState;
 }  // namespace PowerPC
+class CodeTrace;
 class PPCSymbolDB;
 
 // #define JIT_LOG_GENERATED_CODE  // Enables logging of generated code
@@ -154,6 +156,8 @@ protected:
   bool m_enable_profiling = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
+  bool m_enable_warm_start_cache = false;
+  bool m_enable_trace_tier = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
   bool m_low_dcbz_hack = false;
@@ -163,12 +167,16 @@ protected:
   bool m_fastmem_enabled = false;
   bool m_page_table_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
+  // The running title, for JitWarmStartCache
+  std::string m_game_id;
 
   bool m_enable_blr_optimization = false;
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JIT_SETTINGS;
+  CodeTrace* m_code_trace = nullptr;
+
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 27> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh() const;
   void RefreshConfig();
@@ -207,6 +215,12 @@ public:
     auto& branch_watch = m_system.GetPowerPC().GetBranchWatch();
     return branch_watch.GetRecordingActive();
   }
+  bool IsCodeTraceEnabled() const { return m_code_trace != nullptr; }
+
+  // Whether compiled code can call into a CodeTrace before every instruction. The cache has to be
+  // cleared after changing the CodeTrace.
+  virtual bool SupportsCodeTrace() const { return false; }
+  void SetCodeTrace(CodeTrace* code_trace) { m_code_trace = code_trace; }
 
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
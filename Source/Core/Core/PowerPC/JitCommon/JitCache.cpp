@@ -7,9 +7,8 @@
 #include <array>
 #include <cstring>
 #include <functional>
-#include <map>
+#include <new>
 #include <ranges>
-#include <set>
 #include <span>
 #include <utility>
 
@@ -46,11 +45,42 @@ void JitBlock::ProfileData::EndProfiling(ProfileData* data, u32 downcount_amount
   data->time_spent += Clock::now() - data->time_start;
 }
 
+JitBlock* JitBlockArena::Allocate(bool profiling_enabled)
+{
+  if (m_free_slots.empty())
+  {
+    auto& chunk = m_chunks.emplace_back(std::make_unique_for_overwrite<Slot[]>(BLOCKS_PER_CHUNK));
+    // Hand out the slots of the new chunk in ascending order.
+    for (std::size_t i = BLOCKS_PER_CHUNK; i > 0; --i)
+      m_free_slots.push_back(&chunk[i - 1]);
+  }
+
+  Slot* const slot = m_free_slots.back();
+  m_free_slots.pop_back();
+  return new (slot->storage) JitBlock(profiling_enabled);
+}
+
+void JitBlockArena::Free(JitBlock* block)
+{
+  block->~JitBlock();
+  m_free_slots.push_back(reinterpret_cast<Slot*>(block));
+}
+
+void JitBlockArena::Clear()
+{
+  m_free_slots.clear();
+  m_chunks.clear();
+}
+
 JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
 {
 }
 
-JitBaseBlockCache::~JitBaseBlockCache() = default;
+JitBaseBlockCache::~JitBaseBlockCache()
+{
+  for (JitBlock* block : m_blocks)
+    m_block_arena.Free(block);
+}
 
 void JitBaseBlockCache::Init()
 {
@@ -82,13 +112,14 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
-  for (auto& e : block_map)
-  {
-    DestroyBlock(e.second);
-  }
-  block_map.clear();
-  links_to.clear();
-  block_range_map.clear();
+  for (JitBlock* block : m_blocks)
+    DestroyBlock(*block);
+  for (JitBlock* block : m_blocks)
+    m_block_arena.Free(block);
+  m_blocks.clear();
+  m_block_arena.Clear();
+  m_physical_pages.Clear();
+  m_link_pages.Clear();
 
   valid_block.ClearAll();
 
@@ -115,15 +146,15 @@ JitBlock** JitBaseBlockCache::GetFastBlockMapFallback()
 void JitBaseBlockCache::RunOnBlocks(const Core::CPUThreadGuard&,
                                     const std::function<void(const JitBlock&)>& f) const
 {
-  for (const auto& e : block_map)
-    f(e.second);
+  for (const JitBlock* block : m_blocks)
+    f(*block);
 }
 
 void JitBaseBlockCache::WipeBlockProfilingData(const Core::CPUThreadGuard&)
 {
-  for (const auto& kv : block_map)
+  for (JitBlock* block : m_blocks)
   {
-    if (JitBlock::ProfileData* const profile_data = kv.second.profile_data.get())
+    if (JitBlock::ProfileData* const profile_data = block->profile_data.get())
       *profile_data = {};
   }
   Host_JitProfileDataWiped();
@@ -132,12 +163,15 @@ void JitBaseBlockCache::WipeBlockProfilingData(const Core::CPUThreadGuard&)
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
   const u32 physical_address = m_jit.m_mmu.JitCache_TranslateAddress(em_address).address;
-  JitBlock& b = block_map.emplace(physical_address, m_jit.IsProfilingEnabled())->second;
+  JitBlock& b = *m_block_arena.Allocate(m_jit.IsProfilingEnabled());
   b.effectiveAddress = em_address;
   b.physicalAddress = physical_address;
   b.feature_flags = m_jit.m_ppc_state.feature_flags;
   b.linkData.clear();
   b.fast_block_map_index = 0;
+  b.block_list_index = m_blocks.size();
+  m_blocks.push_back(&b);
+  m_physical_pages.GetOrCreate(physical_address).entries.push_back(&b);
   return &b;
 }
 
@@ -176,14 +210,21 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
       valid_block.Set(i / 32);
 
     for (u32 i = range_start & BLOCK_RANGE_MAP_MASK; i < range_end; i += BLOCK_RANGE_SIZE)
-      block_range_map[i].insert(&block);
+    {
+      auto& range = m_physical_pages.GetOrCreate(i).ranges[(i / BLOCK_RANGE_SIZE) %
+                                                           BLOCK_RANGES_PER_PAGE];
+      // Ranges are sorted, so a block can only be added to the same macro block twice in a row.
+      if (range.empty() || range.back() != &block)
+        range.push_back(&block);
+    }
   }
 
   if (block_link)
   {
-    for (const auto& e : block.linkData)
+    for (auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      e.source_block = &block;
+      AddIncomingLink(e);
     }
 
     LinkBlock(block);
@@ -217,12 +258,17 @@ JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, CPUEmuFeatureFla
     translated_addr = translated.address;
   }
 
-  auto iter = block_map.equal_range(translated_addr);
-  for (; iter.first != iter.second; iter.first++)
+  const PhysicalPage* page = m_physical_pages.Find(translated_addr);
+  if (!page)
+    return nullptr;
+
+  for (JitBlock* b : page->entries)
   {
-    JitBlock& b = iter.first->second;
-    if (b.effectiveAddress == addr && b.feature_flags == feature_flags)
-      return &b;
+    if (b->physicalAddress == translated_addr && b->effectiveAddress == addr &&
+        b->feature_flags == feature_flags)
+    {
+      return b;
+    }
   }
 
   return nullptr;
@@ -350,76 +396,97 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
-  // Iterate over all macro blocks which overlap the given range.
-  auto start = block_range_map.lower_bound(address & BLOCK_RANGE_MAP_MASK);
-  auto end = block_range_map.lower_bound(address + length);
-  while (start != end)
+  constexpr u32 PAGE_SIZE = JitPageTable<PhysicalPage>::PAGE_SIZE;
+  static_assert(PAGE_SIZE == BLOCK_RANGES_PER_PAGE * BLOCK_RANGE_SIZE);
+
+  // Iterate over all macro blocks which overlap the given range, skipping unused pages entirely.
+  const u64 end = u64{address} + length;
+  for (u64 page_address = address & ~u64{PAGE_SIZE - 1}; page_address < end;
+       page_address += PAGE_SIZE)
   {
-    // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
+    PhysicalPage* page = m_physical_pages.Find(static_cast<u32>(page_address));
+    if (!page)
+      continue;
+
+    const u64 range_begin = std::max<u64>(address, page_address) & BLOCK_RANGE_MAP_MASK;
+    const u64 range_end = std::min<u64>(end, page_address + PAGE_SIZE);
+    for (u64 i = range_begin; i < range_end; i += BLOCK_RANGE_SIZE)
     {
-      JitBlock* block = *iter;
-      if (block->OverlapsPhysicalRange(address, length))
+      // Iterate over all blocks in the macro block.
+      auto& range = page->ranges[(i / BLOCK_RANGE_SIZE) % BLOCK_RANGES_PER_PAGE];
+      std::size_t index = 0;
+      while (index < range.size())
       {
-        // If the block overlaps, also remove all other occupied slots in the other macro blocks.
-        // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (auto [range_start, range_end] : block->physical_addresses)
+        JitBlock* block = range[index];
+        if (block->OverlapsPhysicalRange(address, length))
         {
-          DEBUG_ASSERT(range_start != range_end);
-          for (u32 i = range_start & BLOCK_RANGE_MAP_MASK; i < range_end; i += BLOCK_RANGE_SIZE)
-          {
-            if (i != start->first)
-              block_range_map[i].erase(block);
-          }
+          // This also removes the block from the current macro block, moving another block into
+          // the current index.
+          RemoveFromRangeIndex(*block);
+          DestroyBlock(*block);
+          FreeBlock(*block);
         }
-
-        // And remove the block.
-        DestroyBlock(*block);
-        auto block_map_iter = block_map.equal_range(block->physicalAddress);
-        while (block_map_iter.first != block_map_iter.second)
+        else
         {
-          if (&block_map_iter.first->second == block)
-          {
-            block_map.erase(block_map_iter.first);
-            break;
-          }
-          block_map_iter.first++;
+          index++;
         }
-        iter = start->second.erase(iter);
-      }
-      else
-      {
-        iter++;
       }
     }
-
-    // If the macro block is empty, drop it.
-    if (start->second.empty())
-      start = block_range_map.erase(start);
-    else
-      start++;
   }
 }
 
 void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
 {
-  const auto equal_range = block_map.equal_range(block.physicalAddress);
-  const auto block_map_iter = std::ranges::find(equal_range.first, equal_range.second, &block,
-                                                [](const auto& kv) { return &kv.second; });
-  if (block_map_iter == equal_range.second) [[unlikely]]
+  const bool is_allocated =
+      block.block_list_index < m_blocks.size() && m_blocks[block.block_list_index] == &block;
+  if (!is_allocated) [[unlikely]]
     return;
 
-  JitBlock& mutable_block = block_map_iter->second;
+  JitBlock& mutable_block = *m_blocks[block.block_list_index];
+
+  RemoveFromRangeIndex(mutable_block);
+  DestroyBlock(mutable_block);
+  FreeBlock(mutable_block);  // The original JitBlock reference is now dangling.
+}
 
-  for (auto [range_start, range_end] : mutable_block.physical_addresses)
+void JitBaseBlockCache::RemoveFromRangeIndex(JitBlock& block)
+{
+  for (auto [range_start, range_end] : block.physical_addresses)
   {
+    DEBUG_ASSERT(range_start != range_end);
     for (u32 i = range_start & BLOCK_RANGE_MAP_MASK; i < range_end; i += BLOCK_RANGE_SIZE)
-      block_range_map[i].erase(&mutable_block);
+    {
+      PhysicalPage* page = m_physical_pages.Find(i);
+      if (!page)
+        continue;
+
+      auto& range = page->ranges[(i / BLOCK_RANGE_SIZE) % BLOCK_RANGES_PER_PAGE];
+      const auto it = std::ranges::find(range, &block);
+      if (it != range.end())
+      {
+        *it = range.back();
+        range.pop_back();
+      }
+    }
   }
+}
 
-  DestroyBlock(mutable_block);
-  block_map.erase(block_map_iter);  // The original JitBlock reference is now dangling.
+void JitBaseBlockCache::FreeBlock(JitBlock& block)
+{
+  auto& entries = m_physical_pages.GetOrCreate(block.physicalAddress).entries;
+  const auto entry = std::ranges::find(entries, &block);
+  if (entry != entries.end())
+  {
+    *entry = entries.back();
+    entries.pop_back();
+  }
+
+  JitBlock* const last = m_blocks.back();
+  last->block_list_index = block.block_list_index;
+  m_blocks[block.block_list_index] = last;
+  m_blocks.pop_back();
+
+  m_block_arena.Free(&block);
 }
 
 u32* JitBaseBlockCache::GetBlockBitSet() const
@@ -456,14 +523,15 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
 void JitBaseBlockCache::LinkBlock(JitBlock& block)
 {
   LinkBlockExits(block);
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
-    return;
 
-  for (JitBlock* b2 : it->second)
+  for (JitBlock::LinkData* e = GetFirstIncomingLink(block.effectiveAddress); e;
+       e = e->next_incoming)
   {
-    if (block.feature_flags == b2->feature_flags)
-      LinkBlockExits(*b2);
+    if (!e->linkStatus && e->source_block->feature_flags == block.feature_flags)
+    {
+      WriteLinkBlock(*e, &block);
+      e->linkStatus = true;
+    }
   }
 }
 
@@ -476,23 +544,69 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
   }
 
   // Unlink all exits of other blocks which points to this block
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
-    return;
-  for (JitBlock* sourceBlock : it->second)
+  for (JitBlock::LinkData* e = GetFirstIncomingLink(block.effectiveAddress); e;
+       e = e->next_incoming)
   {
-    if (sourceBlock->feature_flags != block.feature_flags)
+    if (e->source_block->feature_flags != block.feature_flags)
       continue;
 
-    for (auto& e : sourceBlock->linkData)
+    WriteLinkBlock(*e, nullptr);
+    e->linkStatus = false;
+  }
+}
+
+void JitBaseBlockCache::AddIncomingLink(JitBlock::LinkData& link)
+{
+  auto& targets = m_link_pages.GetOrCreate(link.exitAddress).targets;
+  auto target = std::ranges::find(targets, link.exitAddress, &LinkTarget::address);
+  if (target == targets.end())
+    target = targets.insert(targets.end(), LinkTarget{link.exitAddress, nullptr});
+
+  link.prev_incoming = nullptr;
+  link.next_incoming = target->first;
+  if (target->first)
+    target->first->prev_incoming = &link;
+  target->first = &link;
+}
+
+void JitBaseBlockCache::RemoveIncomingLink(JitBlock::LinkData& link)
+{
+  if (link.next_incoming)
+    link.next_incoming->prev_incoming = link.prev_incoming;
+
+  if (link.prev_incoming)
+  {
+    link.prev_incoming->next_incoming = link.next_incoming;
+  }
+  else if (LinkPage* page = m_link_pages.Find(link.exitAddress))
+  {
+    // This was the first link to the address, so the list head needs to be updated.
+    auto& targets = page->targets;
+    const auto target = std::ranges::find(targets, link.exitAddress, &LinkTarget::address);
+    if (target != targets.end())
     {
-      if (e.exitAddress == block.effectiveAddress)
+      target->first = link.next_incoming;
+      if (!target->first)
       {
-        WriteLinkBlock(e, nullptr);
-        e.linkStatus = false;
+        *target = targets.back();
+        targets.pop_back();
       }
     }
   }
+
+  link.source_block = nullptr;
+  link.prev_incoming = nullptr;
+  link.next_incoming = nullptr;
+}
+
+JitBlock::LinkData* JitBaseBlockCache::GetFirstIncomingLink(u32 address) const
+{
+  const LinkPage* page = m_link_pages.Find(address);
+  if (!page)
+    return nullptr;
+
+  const auto target = std::ranges::find(page->targets, address, &LinkTarget::address);
+  return target != page->targets.end() ? target->first : nullptr;
 }
 
 void JitBaseBlockCache::DestroyBlock(JitBlock& block)
@@ -515,14 +629,10 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
   UnlinkBlock(block);
 
   // Delete linking addresses
-  for (const auto& e : block.linkData)
+  for (auto& e : block.linkData)
   {
-    auto it = links_to.find(e.exitAddress);
-    if (it == links_to.end())
-      continue;
-    it->second.erase(&block);
-    if (it->second.empty())
-      links_to.erase(it);
+    if (e.source_block)
+      RemoveIncomingLink(e);
   }
 
   // Raise an signal if we are going to call this block again
@@ -6,13 +6,11 @@
 #include <array>
 #include <bitset>
 #include <chrono>
+#include <cstddef>
 #include <cstring>
 #include <functional>
-#include <map>
 #include <memory>
 #include <type_traits>
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -97,6 +95,12 @@ struct JitBlock : public JitBlockData
     u32 exitAddress;
     bool linkStatus;  // is it already linked?
     bool call;
+
+    // Intrusive list of all exits which point to exitAddress, maintained by JitBaseBlockCache.
+    // Only set once the owning block has been finalized with block linking enabled.
+    JitBlock* source_block = nullptr;
+    LinkData* prev_incoming = nullptr;
+    LinkData* next_incoming = nullptr;
   };
   std::vector<LinkData> linkData;
 
@@ -108,10 +112,78 @@ struct JitBlock : public JitBlockData
   std::vector<std::pair<u32, UGeckoInstruction>> original_buffer;
 
   std::unique_ptr<ProfileData> profile_data;
+
+  // Position of this block in JitBaseBlockCache's list of all blocks.
+  std::size_t block_list_index = 0;
 };
 
 typedef void (*CompiledCode)();
 
+// Stable-address storage for JitBlocks. Blocks are carved out of large chunks so that they end up
+// next to each other in memory, and the slots of destroyed blocks are reused.
+class JitBlockArena final
+{
+public:
+  JitBlockArena() = default;
+  JitBlockArena(const JitBlockArena&) = delete;
+  JitBlockArena& operator=(const JitBlockArena&) = delete;
+
+  JitBlock* Allocate(bool profiling_enabled);
+  void Free(JitBlock* block);
+  // Releases all memory. All blocks must have been freed beforehand.
+  void Clear();
+
+private:
+  static constexpr std::size_t BLOCKS_PER_CHUNK = 1024;
+
+  struct alignas(JitBlock) Slot
+  {
+    std::byte storage[sizeof(JitBlock)];
+  };
+
+  std::vector<std::unique_ptr<Slot[]>> m_chunks;
+  std::vector<Slot*> m_free_slots;
+};
+
+// Flat two-level table covering the whole 32-bit address space in pages of PAGE_SIZE bytes.
+// Second-level tables are allocated on first use, so only regions that contain code cost memory.
+template <typename Page>
+class JitPageTable final
+{
+public:
+  static constexpr u32 PAGE_SHIFT = 12;
+  static constexpr u32 PAGE_SIZE = 1u << PAGE_SHIFT;
+  static constexpr u32 PAGE_MASK = PAGE_SIZE - 1;
+
+  Page* Find(u32 address) const
+  {
+    const auto& region = m_regions[address >> REGION_SHIFT];
+    return region ? &(*region)[(address >> PAGE_SHIFT) & PAGES_PER_REGION_MASK] : nullptr;
+  }
+
+  Page& GetOrCreate(u32 address)
+  {
+    auto& region = m_regions[address >> REGION_SHIFT];
+    if (!region)
+      region = std::make_unique<Region>();
+    return (*region)[(address >> PAGE_SHIFT) & PAGES_PER_REGION_MASK];
+  }
+
+  void Clear()
+  {
+    for (auto& region : m_regions)
+      region.reset();
+  }
+
+private:
+  static constexpr u32 REGION_SHIFT = 20;
+  static constexpr u32 PAGES_PER_REGION = 1u << (REGION_SHIFT - PAGE_SHIFT);
+  static constexpr u32 PAGES_PER_REGION_MASK = PAGES_PER_REGION - 1;
+
+  using Region = std::array<Page, PAGES_PER_REGION>;
+  std::array<std::unique_ptr<Region>, 1u << (32 - REGION_SHIFT)> m_regions;
+};
+
 // This is essentially just an std::bitset, but Visual Studia 2013's
 // implementation of std::bitset is slow.
 class ValidBlockBitSet final
@@ -165,7 +237,7 @@ public:
   void RunOnBlocks(const Core::CPUThreadGuard& guard,
                    const std::function<void(const JitBlock&)>& f) const;
   void WipeBlockProfilingData(const Core::CPUThreadGuard& guard);
-  std::size_t GetBlockCount() const { return block_map.size(); }
+  std::size_t GetBlockCount() const { return m_blocks.size(); }
 
   JitBlock* AllocateBlock(u32 em_address);
   void FinalizeBlock(JitBlock& block, bool block_link, const PPCAnalyst::CodeBlock& code_block,
@@ -203,25 +275,57 @@ private:
   void UnlinkBlock(const JitBlock& block);
   void InvalidateICacheInternal(u32 physical_address, u32 address, u32 length, bool forced);
 
+  void AddIncomingLink(JitBlock::LinkData& link);
+  void RemoveIncomingLink(JitBlock::LinkData& link);
+  JitBlock::LinkData* GetFirstIncomingLink(u32 address) const;
+
+  void RemoveFromRangeIndex(JitBlock& block);
+  // Removes the block from all indices and frees it. The block must already be destroyed.
+  void FreeBlock(JitBlock& block);
+
   JitBlock* MoveBlockIntoFastCache(u32 em_address, CPUEmuFeatureFlags feature_flags);
 
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address, u32 msr);
 
-  // links_to hold all exit points of all valid blocks in a reverse way.
-  // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
-
-  // Map indexed by the physical address of the entry point.
-  // This is used to query the block based on the current PC in a slow way.
-  std::multimap<u32, JitBlock> block_map;  // start_addr -> block
-
   // Range of overlapping code indexed by a masked physical address.
   // This is used for invalidation of memory regions. The range is grouped
   // in macro blocks of each 0x100 bytes.
   static constexpr u32 BLOCK_RANGE_SIZE = 0x100;
   static constexpr u32 BLOCK_RANGE_MAP_MASK = ~(BLOCK_RANGE_SIZE - 1);
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  static constexpr u32 BLOCK_RANGES_PER_PAGE = 0x1000 / BLOCK_RANGE_SIZE;
+
+  struct PhysicalPage
+  {
+    // Blocks whose entry point lies within this page.
+    // This is used to query the block based on the current PC in a slow way.
+    std::vector<JitBlock*> entries;
+    // Blocks which occupy at least one instruction in each macro block of this page.
+    std::array<std::vector<JitBlock*>, BLOCK_RANGES_PER_PAGE> ranges;
+  };
+
+  struct LinkTarget
+  {
+    u32 address;
+    JitBlock::LinkData* first;
+  };
+  struct LinkPage
+  {
+    // One entry for each destination address within this page that some exit points to.
+    std::vector<LinkTarget> targets;
+  };
+
+  JitBlockArena m_block_arena;
+
+  // All blocks currently allocated, in no particular order.
+  std::vector<JitBlock*> m_blocks;
+
+  // Indexed by physical address.
+  JitPageTable<PhysicalPage> m_physical_pages;
+
+  // Indexed by effective address. Holds all exit points of all valid blocks in a reverse way.
+  // It is used to query all blocks which link to an address.
+  JitPageTable<LinkPage> m_link_pages;
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
@@ -0,0 +1,36 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitTraceProfile.h"
+
+s32* JitTraceProfile::GetEntryCounter(u32 address)
+{
+  // A block which is compiled again, e.g. after its code got invalidated, continues counting.
+  return &m_entry_counters.try_emplace(address, HOT_THRESHOLD).first->second;
+}
+
+u32* JitTraceProfile::GetBranchCounter(u32 address, bool taken)
+{
+  BranchCounters& counters = m_branch_counters[address];
+  return taken ? &counters.taken : &counters.not_taken;
+}
+
+bool JitTraceProfile::IsBranchMostlyTaken(u32 address) const
+{
+  const auto it = m_branch_counters.find(address);
+  if (it == m_branch_counters.end())
+    return false;
+
+  // Not taking a followed branch costs a side exit, so only follow branches which are rarely
+  // not taken.
+  const u64 taken = it->second.taken;
+  const u64 total = taken + it->second.not_taken;
+  return total >= MIN_BRANCH_SAMPLES && taken * 8 >= total * 7;
+}
+
+void JitTraceProfile::Clear()
+{
+  m_entry_counters.clear();
+  m_branch_counters.clear();
+  m_hot_addresses.clear();
+}
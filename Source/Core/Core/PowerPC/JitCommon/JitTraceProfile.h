@@ -0,0 +1,49 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Common/CommonTypes.h"
+
+// Execution counts gathered by the code of first-tier JIT blocks, which decide when a block is
+// recompiled as a trace and which way the trace goes at conditional branches.
+//
+// Compiled code increments the counters directly, so their addresses have to stay stable until
+// the code referencing them is gone, which is why they are only released by Clear().
+class JitTraceProfile
+{
+public:
+  // How often a block has to run before it is recompiled as a trace.
+  static constexpr s32 HOT_THRESHOLD = 1000;
+  // How often a conditional branch has to be reached before its direction is trusted.
+  static constexpr u32 MIN_BRANCH_SAMPLES = 16;
+
+  // Returns the counter a block counts down from HOT_THRESHOLD when it is entered. The block has
+  // become hot when the counter reaches zero.
+  s32* GetEntryCounter(u32 address);
+  // Returns the counter of how often the conditional branch at the address went the given way.
+  u32* GetBranchCounter(u32 address, bool taken);
+
+  // Whether the conditional branch at the address has been taken in nearly all of its executions.
+  bool IsBranchMostlyTaken(u32 address) const;
+
+  void MarkHot(u32 address) { m_hot_addresses.insert(address); }
+  bool IsHot(u32 address) const { return m_hot_addresses.contains(address); }
+
+  void Clear();
+
+private:
+  struct BranchCounters
+  {
+    u32 taken = 0;
+    u32 not_taken = 0;
+  };
+
+  // Nodes of unordered maps never move, so the addresses of the counters are stable.
+  std::unordered_map<u32, s32> m_entry_counters;
+  std::unordered_map<u32, BranchCounters> m_branch_counters;
+  std::unordered_set<u32> m_hot_addresses;
+};
@@ -0,0 +1,147 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitWarmStartCache.h"
+
+#include <utility>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace
+{
+constexpr u32 CACHE_FILE_MAGIC = 0x4353574A;  // JWSC
+constexpr u32 CACHE_FILE_VERSION = 1;
+
+struct SerializedEntry
+{
+  u32 effective_address;
+  u32 feature_flags;
+  u32 num_instructions;
+  u32 code_hash;
+};
+static_assert(sizeof(SerializedEntry) == 16);
+}  // namespace
+
+u32 JitWarmStartCache::HashCodeBuffer(const PPCAnalyst::CodeBuffer& code_buffer,
+                                      u32 num_instructions)
+{
+  u32 crc = Common::StartCRC32();
+  for (u32 i = 0; i < num_instructions; ++i)
+  {
+    const u32 words[] = {code_buffer[i].address, code_buffer[i].inst.hex};
+    crc = Common::UpdateCRC32(crc, reinterpret_cast<const u8*>(words), sizeof(words));
+  }
+  return crc;
+}
+
+std::string JitWarmStartCache::GetFilename() const
+{
+  return File::GetUserPath(D_CACHE_IDX) + "JIT" DIR_SEP + m_game_id + ".jitcache";
+}
+
+void JitWarmStartCache::Clear()
+{
+  m_game_id.clear();
+  m_entries.clear();
+  m_num_entries = 0;
+  m_warmed_feature_flags.clear();
+}
+
+void JitWarmStartCache::Load(const std::string& game_id)
+{
+  Clear();
+  if (game_id.empty())
+    return;
+  m_game_id = game_id;
+
+  File::IOFile file(GetFilename(), "rb");
+  if (!file)
+    return;
+
+  u32 magic;
+  u32 version;
+  if (!file.ReadArray(&magic, 1) || !file.ReadArray(&version, 1) || magic != CACHE_FILE_MAGIC ||
+      version != CACHE_FILE_VERSION)
+  {
+    WARN_LOG_FMT(DYNA_REC, "Ignoring JIT warm start cache {} with unknown version",
+                 GetFilename());
+    return;
+  }
+
+  SerializedEntry serialized;
+  while (m_num_entries < MAX_ENTRIES && file.ReadArray(&serialized, 1))
+  {
+    Record(serialized.effective_address, static_cast<CPUEmuFeatureFlags>(serialized.feature_flags),
+           serialized.num_instructions, serialized.code_hash);
+  }
+
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} JIT warm start entries for {}", m_num_entries, m_game_id);
+}
+
+void JitWarmStartCache::Save() const
+{
+  if (m_game_id.empty() || m_num_entries == 0)
+    return;
+
+  const std::string filename = GetFilename();
+  File::CreateFullPath(filename);
+  File::IOFile file(filename, "wb");
+  if (!file)
+  {
+    WARN_LOG_FMT(DYNA_REC, "Failed to open {} for writing", filename);
+    return;
+  }
+
+  file.WriteArray(&CACHE_FILE_MAGIC, 1);
+  file.WriteArray(&CACHE_FILE_VERSION, 1);
+  for (const auto& [feature_flags, entries] : m_entries)
+  {
+    for (const auto& [address, entry] : entries)
+    {
+      const SerializedEntry serialized{entry.effective_address, feature_flags,
+                                       entry.num_instructions, entry.code_hash};
+      file.WriteArray(&serialized, 1);
+    }
+  }
+}
+
+void JitWarmStartCache::Record(u32 effective_address, CPUEmuFeatureFlags feature_flags,
+                               u32 num_instructions, u32 code_hash)
+{
+  auto& entries = m_entries[feature_flags];
+  const auto it = entries.find(effective_address);
+  if (it != entries.end())
+  {
+    // The guest code at this address changed since it was last recorded; keep the newest version.
+    it->second.num_instructions = num_instructions;
+    it->second.code_hash = code_hash;
+    return;
+  }
+
+  if (m_num_entries >= MAX_ENTRIES)
+    return;
+
+  entries.emplace(effective_address, Entry{effective_address, num_instructions, code_hash});
+  ++m_num_entries;
+}
+
+std::vector<JitWarmStartCache::Entry>
+JitWarmStartCache::TakeEntriesToWarm(CPUEmuFeatureFlags feature_flags)
+{
+  if (!m_warmed_feature_flags.insert(feature_flags).second)
+    return {};
+
+  const auto it = m_entries.find(feature_flags);
+  if (it == m_entries.end())
+    return {};
+
+  std::vector<Entry> result;
+  result.reserve(it->second.size());
+  for (const auto& [address, entry] : it->second)
+    result.push_back(entry);
+  return result;
+}
@@ -0,0 +1,63 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+
+// Remembers which guest blocks a title compiled in previous sessions, so that the JIT can compile
+// them in one go the first time it runs instead of stuttering on every new block it encounters.
+//
+// Emitted host code is not stored: it embeds absolute pointers to the asm routines, the constant
+// pool and far code, none of which are stable across sessions. What is stored is enough to redo
+// the work eagerly and to reject stale entries: the block's start address, the feature flags it
+// was compiled with, and a hash of the analyzed guest instructions. An entry is only compiled if
+// re-analyzing the current guest memory at that address produces the same instructions.
+class JitWarmStartCache
+{
+public:
+  struct Entry
+  {
+    u32 effective_address;
+    u32 num_instructions;
+    u32 code_hash;
+  };
+
+  // Upper bound on the number of blocks stored per game.
+  static constexpr size_t MAX_ENTRIES = 0x40000;
+
+  static u32 HashCodeBuffer(const PPCAnalyst::CodeBuffer& code_buffer, u32 num_instructions);
+
+  // Loads the entries recorded for the given game ID, discarding any previous state.
+  void Load(const std::string& game_id);
+  // Writes all loaded and recorded entries back to disk.
+  void Save() const;
+  void Clear();
+
+  const std::string& GetGameID() const { return m_game_id; }
+
+  void Record(u32 effective_address, CPUEmuFeatureFlags feature_flags, u32 num_instructions,
+              u32 code_hash);
+
+  // Returns the entries for the given feature flags the first time it is called for them after
+  // Load() or Rearm(), and an empty list on subsequent calls.
+  std::vector<Entry> TakeEntriesToWarm(CPUEmuFeatureFlags feature_flags);
+  // Called when the JIT cache is cleared so that the blocks get compiled again.
+  void Rearm() { m_warmed_feature_flags.clear(); }
+
+private:
+  std::string GetFilename() const;
+
+  std::string m_game_id;
+  // feature flags -> (effective address -> entry)
+  std::map<u32, std::map<u32, Entry>> m_entries;
+  size_t m_num_entries = 0;
+  std::set<u32> m_warmed_feature_flags;
+};
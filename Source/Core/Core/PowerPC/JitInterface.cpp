@@ -11,6 +11,7 @@
 #include "Common/CommonTypes.h"
 
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
@@ -210,6 +211,11 @@ std::size_t JitInterface::GetBlockCount() const
 
 bool JitInterface::HandleFault(uintptr_t access_address, SContext* ctx)
 {
+  // Faults caused by dirty page tracking can come from any code writing to emulated memory, JIT or
+  // not, so they need to be dealt with first.
+  if (m_system.GetMemory().HandleDirtyPageFault(access_address))
+    return true;
+
   // Prevent nullptr dereference on a crash with no JIT present
   if (!m_jit)
   {
@@ -235,6 +241,16 @@ void JitInterface::ClearCache(const Core::CPUThreadGuard&)
     m_jit->ClearCache();
 }
 
+bool JitInterface::SetCodeTrace(const Core::CPUThreadGuard& guard, CodeTrace* code_trace)
+{
+  if (!m_jit || (code_trace && !m_jit->SupportsCodeTrace()))
+    return false;
+
+  m_jit->SetCodeTrace(code_trace);
+  ClearCache(guard);
+  return true;
+}
+
 void JitInterface::ClearSafe()
 {
   if (m_jit)
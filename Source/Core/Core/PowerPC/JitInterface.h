@@ -17,6 +17,7 @@
 
 class CPUCoreBase;
 class PointerWrap;
+class CodeTrace;
 class JitBase;
 struct JitBlock;
 
@@ -65,6 +66,11 @@ public:
   // Clearing CodeCache
   void ClearCache(const Core::CPUThreadGuard& guard);
 
+  // Makes compiled code call into <code_trace> before every instruction, or stop doing so if it
+  // is null. Returns false if the JIT can't do this, in which case the trace has to single step
+  // through the interpreter.
+  bool SetCodeTrace(const Core::CPUThreadGuard& guard, CodeTrace* code_trace);
+
   // This clear is "safe" in the sense that it's okay to run from
   // inside a JIT'ed block: it clears the instruction cache, but not
   // the JIT'ed code.
@@ -40,6 +40,8 @@ namespace PPCAnalyst
 {
 // 0 does not perform block merging
 constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
+// Traces are only compiled for hot code, so they can afford to get longer.
+constexpr u32 TRACE_FOLLOWING_THRESHOLD = 8;
 
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
@@ -831,7 +833,9 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   u32 numFollows = 0;
   u32 num_inst = 0;
 
-  const bool enable_follow = m_enable_branch_following;
+  const bool is_trace = static_cast<bool>(m_trace_branch_predicate);
+  const bool enable_follow = m_enable_branch_following || is_trace;
+  const u32 follow_threshold = is_trace ? TRACE_FOLLOWING_THRESHOLD : BRANCH_FOLLOWING_THRESHOLD;
 
   auto& system = Core::System::GetInstance();
   auto& mmu = system.GetMMU();
@@ -895,7 +899,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       {
         code[i].branchTo = code[caller].address + 4;
         if ((inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION) &&
-            numFollows < BRANCH_FOLLOWING_THRESHOLD)
+            numFollows < follow_threshold)
         {
           // bclrx with unconditional branch = return
           // Follow it if we can propagate the LR value of the last CALL instruction.
@@ -916,6 +920,23 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
         // LR has been overwritten, so we give up on following the return address.
         found_call = false;
       }
+      else if (is_trace && inst.OPCD == 16 && !inst.LK && numFollows < follow_threshold &&
+               m_trace_branch_predicate(address))
+      {
+        // A conditional branch which is nearly always taken. Branches back into the trace are
+        // left alone, as following them would unroll loops instead of linking back to their
+        // start.
+        const u32 target = code[i].branchTo;
+        if (std::none_of(code, code + i + 1, [target](const CodeOp& op) {
+              return op.address == target;
+            }))
+        {
+          follow = true;
+          code[i].branchTakenIsInlined = true;
+          // Like for conditional continue, the CALL/RET pair can't be guaranteed anymore.
+          found_call = false;
+        }
+      }
     }
 
     if (HasOption(OPTION_CONDITIONAL_CONTINUE))
@@ -949,7 +970,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
 
-    if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    if (follow && numFollows < follow_threshold)
     {
       // Follow the unconditional branch.
       numFollows++;
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <utility>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -40,6 +42,9 @@ struct CodeOp  // 16B
   BitSet8 crOut;
   bool branchUsesCtr = false;
   bool branchIsIdleLoop = false;
+  // The block continues at branchTo, and not taking the branch exits it. Only set for conditional
+  // branches followed when analyzing a trace.
+  bool branchTakenIsInlined = false;
   BitSet8 wantsCR;
   bool wantsFPRF = false;
   bool wantsCA = false;
@@ -184,6 +189,13 @@ public:
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
+  // While set, blocks are analyzed as traces through hot code: unconditional branches are followed
+  // further than usual, and so are the conditional branches for which the predicate returns true.
+  // Requires JIT support for CodeOp::branchTakenIsInlined.
+  void SetTraceBranchPredicate(std::function<bool(u32 address)> predicate)
+  {
+    m_trace_branch_predicate = std::move(predicate);
+  }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
 
 private:
@@ -208,6 +220,7 @@ private:
   bool m_enable_branch_following = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
+  std::function<bool(u32 address)> m_trace_branch_predicate;
 };
 
 void FindFunctions(const Core::CPUThreadGuard& guard, u32 startAddr, u32 endAddr,
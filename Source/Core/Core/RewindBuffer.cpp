@@ -0,0 +1,154 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/RewindBuffer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <lz4.h>
+
+#include "Common/Logging/Log.h"
+
+namespace State
+{
+// XORs the first size bytes of target with other, treating other as zero past other_size.
+static void XorInPlace(u8* target, std::size_t size, const u8* other, std::size_t other_size)
+{
+  const std::size_t common_size = std::min(size, other_size);
+  for (std::size_t i = 0; i < common_size; ++i)
+    target[i] ^= other[i];
+}
+
+static bool Compress(const u8* data, std::size_t size, Common::UniqueBuffer<u8>& scratch,
+                     std::vector<u8>& compressed)
+{
+  if (size == 0)
+  {
+    compressed.clear();
+    return true;
+  }
+
+  if (size > LZ4_MAX_INPUT_SIZE)
+    return false;
+
+  const int bound = LZ4_compressBound(static_cast<int>(size));
+  if (scratch.size() < static_cast<std::size_t>(bound))
+    scratch.reset(bound);
+
+  const int compressed_size =
+      LZ4_compress_default(reinterpret_cast<const char*>(data),
+                           reinterpret_cast<char*>(scratch.data()), static_cast<int>(size), bound);
+  if (compressed_size <= 0)
+    return false;
+
+  compressed.assign(scratch.data(), scratch.data() + compressed_size);
+  return true;
+}
+
+static bool Decompress(const std::vector<u8>& compressed, u8* data, std::size_t size)
+{
+  if (size == 0)
+    return true;
+
+  const int decompressed_size = LZ4_decompress_safe(
+      reinterpret_cast<const char*>(compressed.data()), reinterpret_cast<char*>(data),
+      static_cast<int>(compressed.size()), static_cast<int>(size));
+  return decompressed_size == static_cast<int>(size);
+}
+
+void RewindBuffer::SetMemoryBudget(std::size_t memory_budget)
+{
+  m_memory_budget = memory_budget;
+  EnforceMemoryBudget();
+}
+
+void RewindBuffer::Push(Common::UniqueBuffer<u8> state, std::size_t size,
+                        std::vector<u8> extra_delta)
+{
+  if (m_newest_size != 0)
+  {
+    // The previous newest state is no longer needed as is, so compute the delta in place.
+    XorInPlace(m_newest.data(), m_newest_size, state.data(), size);
+
+    Delta delta;
+    delta.size = m_newest_size;
+    delta.extra_size = extra_delta.size();
+    if (Compress(m_newest.data(), m_newest_size, m_scratch, delta.compressed) &&
+        Compress(extra_delta.data(), extra_delta.size(), m_scratch, delta.compressed_extra))
+    {
+      m_delta_bytes += delta.compressed.size() + delta.compressed_extra.size();
+      m_deltas.push_back(std::move(delta));
+    }
+    else
+    {
+      // Without this delta, none of the older states can be reconstructed anymore.
+      ERROR_LOG_FMT(CORE, "Failed to compress rewind state delta, dropping rewind history");
+      m_deltas.clear();
+      m_delta_bytes = 0;
+    }
+  }
+
+  m_newest = std::move(state);
+  m_newest_size = size;
+  EnforceMemoryBudget();
+}
+
+std::size_t RewindBuffer::Pop(Common::UniqueBuffer<u8>& state, std::vector<u8>* extra_delta)
+{
+  if (extra_delta)
+    extra_delta->clear();
+
+  const std::size_t size = m_newest_size;
+  if (size == 0)
+    return 0;
+
+  state = std::move(m_newest);
+  m_newest_size = 0;
+  if (m_deltas.empty())
+    return size;
+
+  Delta delta = std::move(m_deltas.back());
+  m_deltas.pop_back();
+  m_delta_bytes -= delta.compressed.size() + delta.compressed_extra.size();
+
+  m_newest.reset(delta.size);
+  bool success = Decompress(delta.compressed, m_newest.data(), delta.size);
+  if (success && extra_delta)
+  {
+    extra_delta->resize(delta.extra_size);
+    success = Decompress(delta.compressed_extra, extra_delta->data(), delta.extra_size);
+  }
+
+  if (!success)
+  {
+    ERROR_LOG_FMT(CORE, "Failed to decompress rewind state delta, dropping rewind history");
+    Clear();
+    if (extra_delta)
+      extra_delta->clear();
+    return size;
+  }
+
+  m_newest_size = delta.size;
+  XorInPlace(m_newest.data(), m_newest_size, state.data(), size);
+  return size;
+}
+
+void RewindBuffer::Clear()
+{
+  m_newest.reset();
+  m_newest_size = 0;
+  m_deltas.clear();
+  m_delta_bytes = 0;
+  m_scratch.reset();
+}
+
+void RewindBuffer::EnforceMemoryBudget()
+{
+  while (!m_deltas.empty() && GetMemoryUsage() > m_memory_budget)
+  {
+    m_delta_bytes -= m_deltas.front().compressed.size() + m_deltas.front().compressed_extra.size();
+    m_deltas.pop_front();
+  }
+}
+}  // namespace State
@@ -0,0 +1,68 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+
+namespace State
+{
+// Keeps a history of recent savestates in memory for rewinding.
+//
+// Only the newest state is stored as is. Every older state is stored as the LZ4 compressed XOR of
+// itself with the state that followed it. Consecutive states are mostly identical (large parts of
+// MEM1/MEM2 don't change within a few seconds), so the XOR is mostly zeroes and compresses to a
+// small fraction of the state size, and walking back one state is a single decompress + XOR.
+//
+// Callers which track part of the emulated state separately (like the MEM1/MEM2 pages written to
+// between two states) can store their own delta alongside each state, which is compressed as well
+// and handed back when the state is popped.
+class RewindBuffer
+{
+public:
+  explicit RewindBuffer(std::size_t memory_budget = 0) : m_memory_budget(memory_budget) {}
+
+  // The oldest states are dropped once the newest state and the deltas together use more than the
+  // given number of bytes. The newest state is always kept.
+  void SetMemoryBudget(std::size_t memory_budget);
+  std::size_t GetMemoryBudget() const { return m_memory_budget; }
+
+  // Makes the first size bytes of the given buffer the newest state. extra_delta is the caller's
+  // data for getting from this state back to the previous one, and is ignored for the first state.
+  void Push(Common::UniqueBuffer<u8> state, std::size_t size, std::vector<u8> extra_delta = {});
+  // Moves the newest state into the given buffer and makes the state before it the newest one.
+  // If extra_delta is given, it receives the extra delta passed in when the popped state was
+  // pushed. Returns the size of the state, or 0 if there are no states left.
+  std::size_t Pop(Common::UniqueBuffer<u8>& state, std::vector<u8>* extra_delta = nullptr);
+
+  void Clear();
+
+  std::size_t GetNumStates() const { return m_newest_size == 0 ? 0 : m_deltas.size() + 1; }
+  std::size_t GetMemoryUsage() const { return m_newest.size() + m_delta_bytes; }
+
+private:
+  struct Delta
+  {
+    std::vector<u8> compressed;
+    std::size_t size;
+    std::vector<u8> compressed_extra;
+    std::size_t extra_size;
+  };
+
+  void EnforceMemoryBudget();
+
+  std::size_t m_memory_budget;
+  Common::UniqueBuffer<u8> m_newest;
+  std::size_t m_newest_size = 0;
+  // Oldest first. m_deltas.back() reconstructs the state before m_newest.
+  std::deque<Delta> m_deltas;
+  std::size_t m_delta_bytes = 0;
+  // Reused between calls to avoid reallocating a state sized buffer each time.
+  Common::UniqueBuffer<u8> m_scratch;
+};
+}  // namespace State
@@ -4,12 +4,16 @@
 #include "Core/State.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
+#include <future>
 #include <locale>
 #include <map>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -19,6 +23,7 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/Buffer.h"
 #include "Common/ChunkFile.h"
@@ -36,6 +41,7 @@
 #include "Common/WorkQueueThread.h"
 
 #include "Core/AchievementManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -46,6 +52,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RewindBuffer.h"
 #include "Core/System.h"
 
 #include "UICommon/UICommon.h"
@@ -89,6 +96,8 @@ struct CompressAndDumpStateArgs
 {
   Common::UniqueBuffer<u8> buffer;
   std::string filename;
+  CompressionType compression_type;
+  int zstd_level;
   std::shared_lock<decltype(s_state_saves_in_progress)> task_lock;
 };
 
@@ -96,8 +105,30 @@ struct CompressAndDumpStateArgs
 // Only the CPU thread manipulates this worker.
 static Common::WorkQueueThreadSP<CompressAndDumpStateArgs> s_compress_and_dump_thread;
 
+struct RewindCaptureArgs
+{
+  Common::UniqueBuffer<u8> buffer;
+  std::size_t size;
+  std::vector<u8> ram_delta;
+  std::size_t memory_budget;
+};
+
+// Recent states kept in memory for rewinding. The rewind worker pushes new captures, and rewinding
+// pops states on the CPU thread after waiting for the worker to become idle. Since captures are
+// also queued from the CPU thread, the two never access the buffer at the same time.
+static RewindBuffer s_rewind_buffer;
+static Common::WorkQueueThreadSP<RewindCaptureArgs> s_rewind_thread;
+static bool s_rewind_active = false;
+static u32 s_frames_since_rewind_capture = 0;
+static u32 s_last_rewind_state_size = 0;
+
+// If dirty page tracking is available, rewind states don't include MEM1 and MEM2. Instead, this
+// holds a copy of them as of the newest rewind state, and every state carries the previous
+// contents of only those pages which were written to since the state before it.
+static Common::UniqueBuffer<u8> s_rewind_ram_shadow;
+
 // Don't forget to increase this after doing changes on the savestate system
-constexpr u32 STATE_VERSION = 192;  // Last changed in PR 14646
+constexpr u32 STATE_VERSION = 193;  // Last changed for chunked savestate compression
 
 // Increase this if the StateExtendedHeader definition changes
 constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
@@ -107,6 +138,10 @@ constexpr u32 COMPRESSED_DATA_OFFSET = 0;
 
 constexpr u32 COOKIE_BASE = 0xBAADBABE;
 
+// The chunked compression types split the state into chunks of this size, which are compressed
+// and decompressed independently of each other so that all cores can work on them at once.
+constexpr u32 COMPRESSION_CHUNK_SIZE = 2 * 1024 * 1024;
+
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
 // because they save the exact Dolphin version to savestates.
@@ -123,8 +158,6 @@ static const std::map<u32, std::pair<std::string, std::string>> s_old_versions =
     {38, {"4.0-4963", "4.0-5267"}}, {39, {"4.0-5279", "4.0-5525"}}, {40, {"4.0-5531", "4.0-5809"}},
     {41, {"4.0-5811", "4.0-5923"}}, {42, {"4.0-5925", "4.0-5946"}}};
 
-static constexpr bool s_use_compression = true;
-
 // Acquired for tasks that will write state save data to the filesystem.
 // This allows for later waiting on completion of said tasks when necessary.
 // We want to maintain a proper order of async operations, e.g. Save, Save, GetInfoString.
@@ -355,19 +388,99 @@ static void CompressBufferToFile(std::span<const u8> raw_buffer, File::IOFile& f
   }
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+// Runs func(i) for every i in [0, count), spread over all available cores.
+template <typename Func>
+static void ParallelFor(size_t count, const Func& func)
+{
+  const size_t num_threads =
+      std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+
+  std::atomic<size_t> next_index = 0;
+  const auto worker = [&] {
+    for (size_t i = next_index++; i < count; i = next_index++)
+      func(i);
+  };
+
+  std::vector<std::future<void>> futures;
+  for (size_t i = 1; i < num_threads; ++i)
+    futures.emplace_back(std::async(std::launch::async, worker));
+  worker();
+
+  for (std::future<void>& future : futures)
+    future.get();
+}
+
+static void CompressChunkedBufferToFile(std::span<const u8> raw_buffer,
+                                        CompressionType compression_type, int zstd_level,
+                                        File::IOFile& f)
+{
+  const u32 num_chunks = static_cast<u32>(
+      (raw_buffer.size() + COMPRESSION_CHUNK_SIZE - 1) / COMPRESSION_CHUNK_SIZE);
+  std::vector<std::vector<u8>> compressed_chunks(num_chunks);
+  std::atomic<bool> failed = false;
+
+  ParallelFor(num_chunks, [&](size_t i) {
+    const std::span<const u8> chunk = raw_buffer.subspan(
+        i * COMPRESSION_CHUNK_SIZE,
+        std::min<size_t>(COMPRESSION_CHUNK_SIZE, raw_buffer.size() - i * COMPRESSION_CHUNK_SIZE));
+    std::vector<u8>& compressed = compressed_chunks[i];
+
+    if (compression_type == CompressionType::ChunkedZstd)
+    {
+      compressed.resize(ZSTD_compressBound(chunk.size()));
+      const size_t compressed_len = ZSTD_compress(compressed.data(), compressed.size(),
+                                                  chunk.data(), chunk.size(), zstd_level);
+      if (ZSTD_isError(compressed_len))
+        failed = true;
+      else
+        compressed.resize(compressed_len);
+    }
+    else
+    {
+      compressed.resize(LZ4_compressBound(static_cast<int>(chunk.size())));
+      const int compressed_len = LZ4_compress_default(
+          reinterpret_cast<const char*>(chunk.data()), reinterpret_cast<char*>(compressed.data()),
+          static_cast<int>(chunk.size()), static_cast<int>(compressed.size()));
+      if (compressed_len == 0)
+        failed = true;
+      else
+        compressed.resize(compressed_len);
+    }
+  });
+
+  if (failed)
+  {
+    PanicAlertFmtT("Internal {0} Error - compression failed",
+                   compression_type == CompressionType::ChunkedZstd ? "zstd" : "LZ4");
+    return;
+  }
+
+  // The chunk table comes first, so that loading can find all chunks without parsing them.
+  std::vector<u32> compressed_sizes(num_chunks);
+  for (u32 i = 0; i < num_chunks; ++i)
+    compressed_sizes[i] = static_cast<u32>(compressed_chunks[i].size());
+
+  f.WriteArray(&COMPRESSION_CHUNK_SIZE, 1);
+  f.WriteArray(&num_chunks, 1);
+  f.WriteArray(compressed_sizes.data(), compressed_sizes.size());
+  for (const std::vector<u8>& compressed : compressed_chunks)
+    f.WriteBytes(compressed.data(), compressed.size());
+}
+
+static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size,
+                                 CompressionType compression_type)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void WriteHeadersToFile(size_t uncompressed_size, CompressionType compression_type,
+                               File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -379,7 +492,7 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
   StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
+  CreateExtendedHeader(extended_header, uncompressed_size, compression_type);
 
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
@@ -413,12 +526,38 @@ static void CompressAndDumpState(Core::System& system, const CompressAndDumpStat
     return;
   }
 
-  WriteHeadersToFile(buffer.size(), f);
+  // States with an unknown compression type can't be loaded, so an invalid setting falls back to
+  // storing the state uncompressed.
+  CompressionType compression_type = save_args.compression_type;
+  switch (compression_type)
+  {
+  case CompressionType::Uncompressed:
+  case CompressionType::LZ4:
+  case CompressionType::ChunkedLZ4:
+  case CompressionType::ChunkedZstd:
+    break;
+  default:
+    WARN_LOG_FMT(CORE, "Unknown savestate compression {}, saving uncompressed",
+                 static_cast<int>(compression_type));
+    compression_type = CompressionType::Uncompressed;
+    break;
+  }
+
+  WriteHeadersToFile(buffer.size(), compression_type, f);
 
-  if (s_use_compression)
+  switch (compression_type)
+  {
+  case CompressionType::LZ4:
     CompressBufferToFile(buffer, f);
-  else
+    break;
+  case CompressionType::ChunkedLZ4:
+  case CompressionType::ChunkedZstd:
+    CompressChunkedBufferToFile(buffer, compression_type, save_args.zstd_level, f);
+    break;
+  default:
     f.WriteBytes(buffer.data(), buffer.size());
+    break;
+  }
 
   if (!f.IsGood())
     Core::DisplayMessage("Failed to write state file", 2000);
@@ -485,6 +624,8 @@ static void SaveAsFromCore(Core::System& system, std::string filename)
     CompressAndDumpStateArgs dump_args{
         .buffer = std::move(buffer),
         .filename = std::move(filename),
+        .compression_type = Config::Get(Config::MAIN_SAVESTATE_COMPRESSION),
+        .zstd_level = Config::Get(Config::MAIN_SAVESTATE_ZSTD_LEVEL),
         .task_lock = GetStateSaveTaskLock(),
     };
     Core::DisplayMessage("Saving State...", 1000);
@@ -693,6 +834,82 @@ static bool DecompressLZ4(Common::UniqueBuffer<u8>& raw_buffer, u64 size, File::
   }
 }
 
+static bool DecompressChunked(Common::UniqueBuffer<u8>& raw_buffer, u64 size,
+                              CompressionType compression_type, File::IOFile& f)
+{
+  u32 chunk_size = 0;
+  u32 num_chunks = 0;
+  if (!f.ReadArray(&chunk_size, 1) || !f.ReadArray(&num_chunks, 1))
+  {
+    PanicAlertFmt("Could not read state chunk table");
+    return false;
+  }
+
+  if (chunk_size == 0 || num_chunks != (size + chunk_size - 1) / chunk_size)
+  {
+    PanicAlertFmt("State chunk table corrupted ({0} chunks of {1} bytes for {2} bytes)",
+                  num_chunks, chunk_size, size);
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes(num_chunks);
+  if (!f.ReadArray(compressed_sizes.data(), compressed_sizes.size()))
+  {
+    PanicAlertFmt("Could not read state chunk table");
+    return false;
+  }
+
+  std::vector<u64> compressed_offsets(num_chunks);
+  u64 compressed_size = 0;
+  for (u32 i = 0; i < num_chunks; ++i)
+  {
+    compressed_offsets[i] = compressed_size;
+    compressed_size += compressed_sizes[i];
+  }
+
+  // Read everything at once so that the decompression threads never wait on the file.
+  Common::UniqueBuffer<u8> compressed_data(compressed_size);
+  if (!f.ReadBytes(compressed_data.data(), compressed_size))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.reset(size);
+  std::atomic<bool> failed = false;
+
+  ParallelFor(num_chunks, [&](size_t i) {
+    const u8* const src = compressed_data.data() + compressed_offsets[i];
+    u8* const dst = raw_buffer.data() + i * chunk_size;
+    const size_t dst_size = std::min<u64>(chunk_size, size - i * chunk_size);
+
+    if (compression_type == CompressionType::ChunkedZstd)
+    {
+      const size_t result = ZSTD_decompress(dst, dst_size, src, compressed_sizes[i]);
+      if (ZSTD_isError(result) || result != dst_size)
+        failed = true;
+    }
+    else
+    {
+      const int result = LZ4_decompress_safe(reinterpret_cast<const char*>(src),
+                                             reinterpret_cast<char*>(dst),
+                                             static_cast<int>(compressed_sizes[i]),
+                                             static_cast<int>(dst_size));
+      if (result < 0 || static_cast<size_t>(result) != dst_size)
+        failed = true;
+    }
+  });
+
+  if (failed)
+  {
+    PanicAlertFmtT("Internal {0} Error - decompression failed",
+                   compression_type == CompressionType::ChunkedZstd ? "zstd" : "LZ4");
+    return false;
+  }
+
+  return true;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -775,6 +992,20 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
 
     break;
   }
+  case CompressionType::ChunkedLZ4:
+  case CompressionType::ChunkedZstd:
+  {
+    const auto compression_type =
+        static_cast<CompressionType>(extended_header.base_header.compression_type);
+    Core::DisplayMessage("Decompressing State...", OSD::Duration::SHORT);
+    if (!DecompressChunked(buffer, extended_header.base_header.uncompressed_size,
+                           compression_type, f))
+    {
+      return;
+    }
+
+    break;
+  }
   case CompressionType::Uncompressed:
   {
     u64 header_len = sizeof(StateHeaderLegacy) + sizeof(StateHeaderVersion) +
@@ -879,6 +1110,209 @@ void LoadAs(Core::System& system, std::string filename)
   });
 }
 
+static void PushRewindState(RewindCaptureArgs args)
+{
+  s_rewind_buffer.SetMemoryBudget(args.memory_budget);
+  s_rewind_buffer.Push(std::move(args.buffer), args.size, std::move(args.ram_delta));
+}
+
+// Returns the host pointer and the offset into the shadow copy for a page returned by
+// Memory::MemoryManager::CollectDirtyPages(). The shadow copy stores MEM2 right after MEM1.
+static std::pair<u8*, std::size_t> GetRewindRAMPage(Memory::MemoryManager& memory,
+                                                    u32 physical_address)
+{
+  if ((physical_address >> 28) == 0x1)
+  {
+    const u32 offset = physical_address & 0x0FFFFFFF;
+    return {memory.GetEXRAM() + offset, memory.GetRamSize() + offset};
+  }
+  return {memory.GetRAM() + physical_address, physical_address};
+}
+
+static void StartRewind(Core::System& system)
+{
+  auto& memory = system.GetMemory();
+  s_rewind_buffer.Clear();
+  s_rewind_ram_shadow.reset();
+
+  if (memory.StartDirtyPageTracking())
+  {
+    const std::size_t mem1_size = memory.GetRamSize();
+    const std::size_t mem2_size = memory.GetEXRAM() ? memory.GetExRamSize() : 0;
+    s_rewind_ram_shadow.reset(mem1_size + mem2_size);
+    std::memcpy(s_rewind_ram_shadow.data(), memory.GetRAM(), mem1_size);
+    if (mem2_size != 0)
+      std::memcpy(s_rewind_ram_shadow.data() + mem1_size, memory.GetEXRAM(), mem2_size);
+  }
+  else
+  {
+    INFO_LOG_FMT(CORE, "Dirty page tracking is unavailable, rewind states will include all RAM");
+  }
+
+  s_rewind_active = true;
+}
+
+static void StopRewind(Core::System& system)
+{
+  s_rewind_thread.WaitForCompletion();
+  s_rewind_buffer.Clear();
+  s_rewind_ram_shadow.reset();
+  system.GetMemory().StopDirtyPageTracking();
+  s_rewind_active = false;
+}
+
+// Brings the shadow copy of MEM1/MEM2 up to date and returns the previous contents of the pages
+// which changed, each one preceded by its physical address.
+static std::vector<u8> UpdateRewindRAMShadow(Memory::MemoryManager& memory)
+{
+  const std::vector<u32> dirty_pages = memory.CollectDirtyPages();
+  const u32 page_size = memory.GetHostPageSize();
+
+  std::vector<u8> ram_delta(dirty_pages.size() * (sizeof(u32) + page_size));
+  u8* out = ram_delta.data();
+  for (const u32 physical_address : dirty_pages)
+  {
+    const auto [live_page, shadow_offset] = GetRewindRAMPage(memory, physical_address);
+    u8* const shadow_page = s_rewind_ram_shadow.data() + shadow_offset;
+
+    std::memcpy(out, &physical_address, sizeof(u32));
+    out += sizeof(u32);
+    std::memcpy(out, shadow_page, page_size);
+    out += page_size;
+    std::memcpy(shadow_page, live_page, page_size);
+  }
+  return ram_delta;
+}
+
+static void CaptureRewindState(Core::System& system)
+{
+  if (!s_rewind_active)
+    StartRewind(system);
+
+  auto& memory = system.GetMemory();
+  const bool track_ram = !s_rewind_ram_shadow.empty();
+
+  // Only the serialization has to happen on the CPU thread. Delta encoding and compressing it
+  // against the previous state is left to the rewind worker. The size of these states has nothing
+  // to do with the size of regular ones, so keep SaveToBuffer's estimate for those intact.
+  const u32 last_state_size = s_last_state_size;
+  Common::UniqueBuffer<u8> buffer(static_cast<std::size_t>(s_last_rewind_state_size) * 110 / 100);
+  memory.SetExcludeRAMFromState(track_ram);
+  const std::size_t size = SaveToBuffer(system, buffer);
+  memory.SetExcludeRAMFromState(false);
+  s_last_state_size = last_state_size;
+  if (size == 0)
+    return;
+  s_last_rewind_state_size = static_cast<u32>(size);
+
+  std::vector<u8> ram_delta;
+  if (track_ram)
+    ram_delta = UpdateRewindRAMShadow(memory);
+
+  const std::size_t memory_budget =
+      std::size_t{Config::Get(Config::MAIN_REWIND_MEMORY_BUDGET_MB)} << 20;
+  s_rewind_thread.Push({std::move(buffer), size, std::move(ram_delta),
+                        memory_budget - std::min(memory_budget, s_rewind_ram_shadow.size())});
+}
+
+void OnFrameEnd(Core::System& system)
+{
+  if (!Config::Get(Config::MAIN_REWIND_ENABLED))
+  {
+    if (s_rewind_active)
+      StopRewind(system);
+    return;
+  }
+
+  if (++s_frames_since_rewind_capture < Config::Get(Config::MAIN_REWIND_INTERVAL_FRAMES))
+    return;
+  s_frames_since_rewind_capture = 0;
+
+  // Rewinding is refused in these cases, so don't spend time capturing states for it.
+  if (NetPlay::IsNetPlayRunning() || AchievementManager::GetInstance().IsHardcoreModeActive() ||
+      system.GetMovie().IsMovieActive())
+  {
+    return;
+  }
+
+  // This runs inside the VI event, which CoreTiming has already popped and which is midway through
+  // updating the VI state. A state captured right now would hang the game after being loaded.
+  system.GetCoreTiming().RunAfterEvents([&system] { CaptureRewindState(system); });
+}
+
+void Rewind(Core::System& system)
+{
+  if (!CheckIfStateLoadIsAllowed(system))
+    return;
+
+  Core::RunOnCPUThread(system, [&system] {
+    if (system.GetMovie().IsMovieActive())
+    {
+      Core::DisplayMessage("Rewinding is disabled while a movie is active", 2000);
+      return;
+    }
+
+    s_rewind_thread.WaitForCompletion();
+
+    Common::UniqueBuffer<u8> buffer;
+    std::vector<u8> ram_delta;
+    const std::size_t size = s_rewind_buffer.Pop(buffer, &ram_delta);
+    if (size == 0)
+    {
+      Core::DisplayMessage("There is nothing to rewind to", 2000);
+      return;
+    }
+
+    auto& memory = system.GetMemory();
+    const bool track_ram = !s_rewind_ram_shadow.empty();
+    const u32 page_size = memory.GetHostPageSize();
+    if (track_ram)
+    {
+      // The shadow copy holds MEM1/MEM2 as of the state being loaded, so only the pages which were
+      // written to since then have to be restored from it.
+      for (const u32 physical_address : memory.CollectDirtyPages())
+      {
+        const auto [live_page, shadow_offset] = GetRewindRAMPage(memory, physical_address);
+        std::memcpy(live_page, s_rewind_ram_shadow.data() + shadow_offset, page_size);
+      }
+    }
+
+    memory.SetExcludeRAMFromState(track_ram);
+    const bool loaded_successfully = LoadFromBuffer(system, std::span(buffer.data(), size));
+    memory.SetExcludeRAMFromState(false);
+    if (!loaded_successfully)
+    {
+      Core::DisplayMessage("The rewind state could not be loaded", OSD::Duration::NORMAL);
+      StopRewind(system);
+      return;
+    }
+
+    if (track_ram)
+    {
+      // Step the shadow copy back to the state before the one which was just loaded. Emulated
+      // memory now differs from the shadow copy in these pages, so they count as dirty.
+      for (std::size_t i = 0; i + sizeof(u32) + page_size <= ram_delta.size();
+           i += sizeof(u32) + page_size)
+      {
+        u32 physical_address;
+        std::memcpy(&physical_address, ram_delta.data() + i, sizeof(u32));
+        const std::size_t shadow_offset = GetRewindRAMPage(memory, physical_address).second;
+        std::memcpy(s_rewind_ram_shadow.data() + shadow_offset, ram_delta.data() + i + sizeof(u32),
+                    page_size);
+        memory.MarkRangeDirty(physical_address, page_size);
+      }
+    }
+
+    // Start counting towards the next capture from the state we rewound to.
+    s_frames_since_rewind_capture = 0;
+    Core::DisplayMessage(
+        fmt::format("Rewound ({} states left)", s_rewind_buffer.GetNumStates()), 1000);
+
+    if (s_on_after_load_callback)
+      s_on_after_load_callback();
+  });
+}
+
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback)
 {
   s_on_after_load_callback = std::move(callback);
@@ -888,6 +1322,10 @@ void Init(Core::System& system)
 {
   s_compress_and_dump_thread.Reset("Savestate Worker",
                                    std::bind_front(&CompressAndDumpState, std::ref(system)));
+  s_rewind_thread.Reset("Rewind Worker", &PushRewindState);
+  s_rewind_active = false;
+  s_frames_since_rewind_capture = 0;
+  s_last_rewind_state_size = 0;
 
   s_flush_unsaved_data_hook = UICommon::AddFlushUnsavedDataCallback([] {
     // Holding the lock for any amount of time means there are no pending state save tasks.
@@ -898,6 +1336,10 @@ void Init(Core::System& system)
 void Shutdown()
 {
   s_compress_and_dump_thread.Shutdown();
+  s_rewind_thread.Shutdown();
+  s_rewind_buffer.Clear();
+  s_rewind_ram_shadow.reset();
+  s_rewind_active = false;
   s_undo_load_buffer.reset();
   s_flush_unsaved_data_hook.reset();
 }
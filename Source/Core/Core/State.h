@@ -54,6 +54,10 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // The following types split the state into independently compressed chunks, which allows
+  // compressing and decompressing them in parallel.
+  ChunkedLZ4 = 2,
+  ChunkedZstd = 3,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
@@ -103,6 +107,13 @@ void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
 void UndoLoadState(Core::System& system);
 
+// Must be called on the CPU thread at the end of every frame. Captures a state for rewinding every
+// few frames while rewinding is enabled.
+void OnFrameEnd(Core::System& system);
+// Loads the most recent state captured for rewinding and discards it, so that calling this
+// repeatedly steps further back in time.
+void Rewind(Core::System& system);
+
 // for calling back into UI code without introducing a dependency on it in core
 using AfterLoadCallbackFunc = std::function<void()>;
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback);
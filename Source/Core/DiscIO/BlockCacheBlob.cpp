@@ -0,0 +1,362 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/BlockCacheBlob.h"
+
+#include <algorithm>
+#include <compare>
+#include <condition_variable>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Common/WorkQueueThread.h"
+
+#include "DiscIO/VolumeWii.h"
+
+namespace DiscIO
+{
+// Used as the partition data offset of reads which are not decrypted.
+static constexpr u64 RAW_DATA = std::numeric_limits<u64>::max();
+
+// How many consecutive blocks have to be read before the following blocks are read ahead.
+static constexpr u32 SEQUENTIAL_READ_THRESHOLD = 2;
+static constexpr u64 MAX_READ_AHEAD_BLOCKS = 4;
+
+// Caches need room for the blocks being read ahead and for the blocks being read.
+static constexpr u64 MIN_CACHED_BLOCKS = 4;
+
+class BlockCache final
+{
+public:
+  struct Key
+  {
+    u64 partition_data_offset;
+    u64 block_index;
+
+    auto operator<=>(const Key&) const = default;
+  };
+
+  BlockCache(const BlobReader& reader, u64 memory_budget, u32 read_ahead_threads)
+      : m_raw_block_size{reader.GetBlockSize()},
+        // Decrypted reads of a partition skip the hashes, so their blocks are smaller.
+        m_decrypted_block_size{std::max<u64>(m_raw_block_size / VolumeWii::BLOCK_TOTAL_SIZE, 1) *
+                               VolumeWii::BLOCK_DATA_SIZE},
+        m_data_size{reader.GetDataSize()}, m_memory_budget{memory_budget},
+        m_read_ahead_blocks{std::min(MAX_READ_AHEAD_BLOCKS,
+                                     memory_budget / m_raw_block_size / MIN_CACHED_BLOCKS)}
+  {
+    for (u32 i = 0; i < read_ahead_threads; ++i)
+    {
+      auto& worker = m_workers.emplace_back(std::make_unique<Worker>());
+      worker->reader = reader.CopyReader();
+      worker->thread.Reset(fmt::format("Disc Read-Ahead {}", i),
+                           [this, reader = worker->reader.get()](Key key) { Fill(*reader, key); });
+    }
+
+    INFO_LOG_FMT(DISCIO, "BlockCacheBlobReader: Created with {} KiB blocks and {} KiB of memory",
+                 m_raw_block_size >> 10, m_memory_budget >> 10);
+  }
+
+  ~BlockCache()
+  {
+    // Pending blocks which are never filled don't matter, as no reader is left to wait for them.
+    for (auto& worker : m_workers)
+      worker->thread.StopAndCancel();
+
+    INFO_LOG_FMT(DISCIO, "BlockCacheBlobReader: {} hits, {} misses, {} blocks read ahead", m_hits,
+                 m_misses, m_read_ahead_count);
+  }
+
+  BlockCache(const BlockCache&) = delete;
+  BlockCache& operator=(const BlockCache&) = delete;
+
+  u64 GetBlockSize(u64 partition_data_offset) const
+  {
+    return partition_data_offset == RAW_DATA ? m_raw_block_size : m_decrypted_block_size;
+  }
+
+  u64 GetReadAheadBlocks() const { return m_workers.empty() ? 0 : m_read_ahead_blocks; }
+
+  // Copies part of a block to out_ptr. If the block is not cached, it is read using the given
+  // reader, which has to belong to the calling thread.
+  bool Read(BlobReader& reader, Key key, u64 offset_in_block, u64 size, u8* out_ptr)
+  {
+    std::unique_lock lock(m_mutex);
+
+    auto it = m_blocks.find(key);
+    if (it != m_blocks.end() && !it->second.data)
+    {
+      // Another thread is already reading the block, most likely ahead of us. If it fails, the
+      // block is gone once we wake up, and we try reading it ourselves.
+      m_block_filled.wait(lock, [&] {
+        it = m_blocks.find(key);
+        return it == m_blocks.end() || it->second.data;
+      });
+    }
+
+    std::shared_ptr<const std::vector<u8>> data;
+    if (it != m_blocks.end())
+    {
+      ++m_hits;
+      m_lru.splice(m_lru.begin(), m_lru, it->second.lru_position);
+      data = it->second.data;
+      lock.unlock();
+    }
+    else
+    {
+      ++m_misses;
+      m_blocks.emplace(key, Block{});
+      lock.unlock();
+      data = Fill(reader, key);
+    }
+
+    if (!data || offset_in_block + size > data->size())
+      return false;
+
+    std::memcpy(out_ptr, data->data() + offset_in_block, size);
+    return true;
+  }
+
+  // Starts reading a block on a worker thread, unless it is already cached or being read.
+  void ReadAhead(Key key)
+  {
+    if (key.partition_data_offset == RAW_DATA && key.block_index * m_raw_block_size >= m_data_size)
+      return;
+
+    {
+      std::lock_guard lock(m_mutex);
+      if (!m_blocks.try_emplace(key).second)
+        return;
+      ++m_read_ahead_count;
+    }
+
+    // Consecutive blocks go to different workers, so that they are decompressed in parallel.
+    m_workers[key.block_index % m_workers.size()]->thread.Push(key);
+  }
+
+private:
+  struct Block
+  {
+    // Null while the block is being read.
+    std::shared_ptr<const std::vector<u8>> data;
+    std::list<Key>::iterator lru_position;
+  };
+
+  struct Worker
+  {
+    std::unique_ptr<BlobReader> reader;
+    Common::WorkQueueThread<Key> thread;
+  };
+
+  // Reads a block which has been added to m_blocks as pending, and publishes the result.
+  std::shared_ptr<const std::vector<u8>> Fill(BlobReader& reader, Key key)
+  {
+    const u64 block_size = GetBlockSize(key.partition_data_offset);
+    const u64 offset = key.block_index * block_size;
+
+    std::shared_ptr<std::vector<u8>> data;
+    if (key.partition_data_offset == RAW_DATA)
+    {
+      // The last block ends with the data.
+      data = std::make_shared<std::vector<u8>>(std::min(block_size, m_data_size - offset));
+      if (!reader.Read(offset, data->size(), data->data()))
+        data.reset();
+    }
+    else if (reader.SupportsReadWiiDecrypted(offset, block_size, key.partition_data_offset))
+    {
+      // Blocks which go past the end of the partition data are not supported, and are never
+      // cached. Reads of them go straight to the reader instead.
+      data = std::make_shared<std::vector<u8>>(block_size);
+      if (!reader.ReadWiiDecrypted(offset, block_size, data->data(), key.partition_data_offset))
+        data.reset();
+    }
+
+    {
+      std::lock_guard lock(m_mutex);
+      const auto it = m_blocks.find(key);
+      if (data)
+      {
+        it->second.data = data;
+        it->second.lru_position = m_lru.insert(m_lru.begin(), key);
+        m_cached_size += data->size();
+        EvictOverBudget();
+      }
+      else
+      {
+        m_blocks.erase(it);
+      }
+    }
+    m_block_filled.notify_all();
+
+    return data;
+  }
+
+  void EvictOverBudget()
+  {
+    // The most recently used block always stays, as it has just been read.
+    while (m_cached_size > m_memory_budget && m_lru.size() > 1)
+    {
+      const auto it = m_blocks.find(m_lru.back());
+      m_cached_size -= it->second.data->size();
+      m_blocks.erase(it);
+      m_lru.pop_back();
+    }
+  }
+
+  const u64 m_raw_block_size;
+  const u64 m_decrypted_block_size;
+  const u64 m_data_size;
+  const u64 m_memory_budget;
+  const u64 m_read_ahead_blocks;
+
+  std::mutex m_mutex;
+  std::condition_variable m_block_filled;
+  std::map<Key, Block> m_blocks;
+  // Cached blocks, the most recently used first. Blocks which are being read are not included.
+  std::list<Key> m_lru;
+  u64 m_cached_size = 0;
+
+  u64 m_hits = 0;
+  u64 m_misses = 0;
+  u64 m_read_ahead_count = 0;
+
+  // Destroyed first, so that the workers are stopped before the rest of the cache goes away.
+  std::vector<std::unique_ptr<Worker>> m_workers;
+};
+
+class BlockCacheBlobReader final : public BlobReader
+{
+public:
+  BlockCacheBlobReader(std::shared_ptr<BlockCache> cache, std::unique_ptr<BlobReader> reader)
+      : m_cache{std::move(cache)}, m_reader{std::move(reader)}
+  {
+  }
+
+  std::unique_ptr<BlobReader> CopyReader() const override
+  {
+    return std::make_unique<BlockCacheBlobReader>(m_cache, m_reader->CopyReader());
+  }
+
+  BlobType GetBlobType() const override { return m_reader->GetBlobType(); }
+  u64 GetRawSize() const override { return m_reader->GetRawSize(); }
+  u64 GetDataSize() const override { return m_reader->GetDataSize(); }
+  DataSizeType GetDataSizeType() const override { return m_reader->GetDataSizeType(); }
+
+  u64 GetBlockSize() const override { return m_reader->GetBlockSize(); }
+  bool HasFastRandomAccessInBlock() const override
+  {
+    return m_reader->HasFastRandomAccessInBlock();
+  }
+  std::string GetCompressionMethod() const override { return m_reader->GetCompressionMethod(); }
+  std::optional<int> GetCompressionLevel() const override
+  {
+    return m_reader->GetCompressionLevel();
+  }
+
+  bool Read(u64 offset, u64 size, u8* out_ptr) override
+  {
+    // Reads past the end of the data return blank data in some formats. They aren't worth caching.
+    if (offset + size > m_reader->GetDataSize())
+      return m_reader->Read(offset, size, out_ptr);
+
+    return ReadThroughCache(offset, size, out_ptr, RAW_DATA);
+  }
+
+  bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override
+  {
+    return m_reader->SupportsReadWiiDecrypted(offset, size, partition_data_offset);
+  }
+
+  bool ReadWiiDecrypted(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset) override
+  {
+    return ReadThroughCache(offset, size, out_ptr, partition_data_offset);
+  }
+
+private:
+  bool ReadThroughCache(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset)
+  {
+    const u64 block_size = m_cache->GetBlockSize(partition_data_offset);
+
+    while (size > 0)
+    {
+      const BlockCache::Key key{partition_data_offset, offset / block_size};
+      const u64 offset_in_block = offset % block_size;
+      const u64 read_size = std::min(size, block_size - offset_in_block);
+
+      if (!m_cache->Read(*m_reader, key, offset_in_block, read_size, out_ptr) &&
+          !ReadDirectly(offset, read_size, out_ptr, partition_data_offset))
+      {
+        return false;
+      }
+
+      ReadAhead(key);
+
+      offset += read_size;
+      size -= read_size;
+      out_ptr += read_size;
+    }
+
+    return true;
+  }
+
+  bool ReadDirectly(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset)
+  {
+    if (partition_data_offset == RAW_DATA)
+      return m_reader->Read(offset, size, out_ptr);
+
+    return m_reader->ReadWiiDecrypted(offset, size, out_ptr, partition_data_offset);
+  }
+
+  void ReadAhead(const BlockCache::Key& key)
+  {
+    if (m_last_key && key.partition_data_offset == m_last_key->partition_data_offset &&
+        key.block_index == m_last_key->block_index + 1)
+    {
+      ++m_sequential_blocks;
+    }
+    else if (m_last_key != key)
+    {
+      m_sequential_blocks = 0;
+    }
+    m_last_key = key;
+
+    if (m_sequential_blocks < SEQUENTIAL_READ_THRESHOLD)
+      return;
+
+    const u64 read_ahead_blocks = m_cache->GetReadAheadBlocks();
+    for (u64 i = 1; i <= read_ahead_blocks; ++i)
+      m_cache->ReadAhead({key.partition_data_offset, key.block_index + i});
+  }
+
+  const std::shared_ptr<BlockCache> m_cache;
+  const std::unique_ptr<BlobReader> m_reader;
+
+  std::optional<BlockCache::Key> m_last_key;
+  u32 m_sequential_blocks = 0;
+};
+
+std::unique_ptr<BlobReader> CreateBlockCacheBlobReader(std::unique_ptr<BlobReader> reader,
+                                                       u64 memory_budget, u32 read_ahead_threads)
+{
+  const u64 block_size = reader->GetBlockSize();
+  if (reader->HasFastRandomAccessInBlock() || block_size == 0 ||
+      memory_budget < block_size * MIN_CACHED_BLOCKS)
+  {
+    return reader;
+  }
+
+  auto cache = std::make_shared<BlockCache>(*reader, memory_budget, read_ahead_threads);
+  return std::make_unique<BlockCacheBlobReader>(std::move(cache), std::move(reader));
+}
+
+}  // namespace DiscIO
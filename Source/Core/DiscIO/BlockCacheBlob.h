@@ -0,0 +1,21 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+
+#include "Common/CommonTypes.h"
+#include "DiscIO/Blob.h"
+
+namespace DiscIO
+{
+
+// Keeps recently read blocks of a compressed reader in memory, decompressed, up to memory_budget
+// bytes. The cache is shared by all copies of the returned reader. When reads are sequential, the
+// blocks after them are decompressed ahead of time on read_ahead_threads worker threads.
+// Readers which can read any part of a block quickly are returned unchanged.
+std::unique_ptr<BlobReader> CreateBlockCacheBlobReader(std::unique_ptr<BlobReader> reader,
+                                                       u64 memory_budget, u32 read_ahead_threads);
+
+}  // namespace DiscIO
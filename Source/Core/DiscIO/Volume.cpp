@@ -3,6 +3,7 @@
 
 #include "DiscIO/Volume.h"
 
+#include <algorithm>
 #include <cstring>
 #include <functional>
 #include <map>
@@ -22,6 +23,7 @@
 #include "Core/IOS/ES/Formats.h"
 
 #include "DiscIO/Blob.h"
+#include "DiscIO/BlockCacheBlob.h"
 #include "DiscIO/CachedBlob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/Enums.h"
@@ -145,7 +147,14 @@ std::unique_ptr<VolumeDisc> CreateDiscForCore(const std::string& path)
   if (Config::Get(Config::MAIN_LOAD_GAME_INTO_MEMORY))
     return TryCreateDisc(reader, CreateScrubbingCachedBlobReader);
 
-  return TryCreateDisc(reader);
+  const u64 block_cache_size = u64(std::max(Config::Get(Config::MAIN_DISC_BLOCK_CACHE_SIZE), 0))
+                               << 20;
+  const u32 read_ahead_threads =
+      u32(std::clamp(Config::Get(Config::MAIN_DISC_READ_AHEAD_THREADS), 0, 4));
+  return TryCreateDisc(reader, [&](std::unique_ptr<BlobReader> blob_reader) {
+    return CreateBlockCacheBlobReader(std::move(blob_reader), block_cache_size,
+                                      read_ahead_threads);
+  });
 }
 
 static std::unique_ptr<VolumeWAD> TryCreateWAD(std::unique_ptr<BlobReader>& reader)
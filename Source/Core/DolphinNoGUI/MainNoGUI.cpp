@@ -6,7 +6,10 @@
 #include <OptionParser.h>
 #include <csignal>
 #include <cstdio>
+#include <iostream>
+#include <memory>
 #include <string>
+#include <variant>
 #include <vector>
 
 #ifndef _WIN32
@@ -15,11 +18,15 @@
 #include <windows.h>
 #endif
 
+#include "Common/Config/Config.h"
+#include "Common/JsonUtil.h"
 #include "Common/ScopeGuard.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
+#include "Core/FifoPlayer/FifoBenchmark.h"
 #include "Core/Host.h"
 #include "Core/System.h"
 
@@ -209,6 +216,16 @@ int main(const int argc, char* argv[])
                 "macos"
 #endif
       });
+  parser->add_option("--fifo_benchmark")
+      .action("store")
+      .type("int")
+      .metavar("<loops>")
+      .help("Play the FIFO log the given number of times as fast as possible, then print how long "
+            "each frame took as JSON");
+  parser->add_option("--benchmark_output")
+      .action("store")
+      .metavar("<file>")
+      .help("Write the results of --fifo_benchmark to this file instead of stdout");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -283,6 +300,24 @@ int main(const int argc, char* argv[])
     return 1;
   }
 
+  std::unique_ptr<FifoBenchmark> fifo_benchmark;
+  if (options.is_set("fifo_benchmark"))
+  {
+    const int num_loops = static_cast<int>(options.get("fifo_benchmark"));
+    if (!boot || !std::holds_alternative<BootParameters::DFF>(boot->parameters) || num_loops < 1)
+    {
+      fprintf(stderr, "--fifo_benchmark needs a FIFO log and a positive number of loops.\n");
+      return 1;
+    }
+
+    // Don't let the emulated frame rate limit the benchmark.
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+
+    fifo_benchmark = std::make_unique<FifoBenchmark>(Core::System::GetInstance(), num_loops,
+                                                     [] { s_platform->Stop(); });
+  }
+
   auto core_state_changed_hook = Core::AddOnStateChangedCallback([](const Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -319,6 +354,27 @@ int main(const int argc, char* argv[])
   Core::Shutdown(Core::System::GetInstance());
   s_platform.reset();
 
+  if (fifo_benchmark)
+  {
+    if (!fifo_benchmark->IsFinished())
+      fprintf(stderr, "The FIFO log was stopped before it was played to the end.\n");
+
+    const picojson::value results = fifo_benchmark->GetResults();
+    if (options.is_set("benchmark_output"))
+    {
+      const std::string path = static_cast<const char*>(options.get("benchmark_output"));
+      if (!JsonToFile(path, results, true))
+      {
+        fprintf(stderr, "Could not write the benchmark results to %s\n", path.c_str());
+        return 1;
+      }
+    }
+    else
+    {
+      std::cout << results.serialize(true);
+    }
+  }
+
   return 0;
 }
 
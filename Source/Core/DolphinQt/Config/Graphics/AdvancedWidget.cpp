@@ -225,9 +225,12 @@ void AdvancedWidget::CreateWidgets()
       tr("Defer EFB Cache Invalidation"), Config::GFX_HACK_EFB_DEFER_INVALIDATION, m_game_layer);
   m_manual_texture_sampling = new ConfigBool(
       tr("Manual Texture Sampling"), Config::GFX_HACK_FAST_TEXTURE_SAMPLING, m_game_layer, true);
+  m_vertex_data_cache = new ConfigBool(tr("Cache Converted Vertex Data"),
+                                       Config::GFX_VERTEX_DATA_CACHE, m_game_layer);
 
   experimental_layout->addWidget(m_defer_efb_access_invalidation, 0, 0);
   experimental_layout->addWidget(m_manual_texture_sampling, 0, 1);
+  experimental_layout->addWidget(m_vertex_data_cache, 1, 0);
 
   main_layout->addWidget(debugging_box);
   main_layout->addWidget(utility_box);
@@ -391,6 +394,11 @@ void AdvancedWidget::AddDescriptions()
       "resolutions.<br><br>If this setting is enabled, the Texture Filtering setting will be "
       "disabled."
       "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_VERTEX_DATA_CACHE_DESCRIPTION[] = QT_TR_NOOP(
+      "Keeps converted vertex data which games draw repeatedly, such as display lists which are "
+      "called every frame, and copies it instead of converting it again.<br><br>May improve "
+      "performance in games with a lot of static geometry, at the cost of some memory.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
 
 #ifdef _WIN32
   static const char TR_BORDERLESS_FULLSCREEN_DESCRIPTION[] = QT_TR_NOOP(
@@ -476,4 +484,5 @@ void AdvancedWidget::AddDescriptions()
   m_crop_custom_bottom->SetDescription(tr(TR_CROP_CUSTOM_BOTTOM));
   m_defer_efb_access_invalidation->SetDescription(tr(TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION));
   m_manual_texture_sampling->SetDescription(tr(TR_MANUAL_TEXTURE_SAMPLING_DESCRIPTION));
+  m_vertex_data_cache->SetDescription(tr(TR_VERTEX_DATA_CACHE_DESCRIPTION));
 }
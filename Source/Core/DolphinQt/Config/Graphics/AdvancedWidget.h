@@ -73,6 +73,7 @@ private:
   // Experimental
   ConfigBool* m_defer_efb_access_invalidation;
   ConfigBool* m_manual_texture_sampling;
+  ConfigBool* m_vertex_data_cache;
 
   Config::Layer* m_game_layer = nullptr;
 };
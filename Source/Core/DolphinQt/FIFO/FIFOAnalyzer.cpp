@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <bit>
+#include <optional>
 #include <ranges>
 #include <utility>
 
@@ -345,7 +346,10 @@ void FIFOAnalyzer::UpdateDetails()
   const u32 end_part_nr = items[0]->data(0, PART_END_ROLE).toUInt();
 
   const auto& [parts, _part_type_counts] = m_fifo_player.GetAnalyzedFrameInfo(frame_nr);
-  const auto& fifo_frame = m_fifo_player.GetFile()->GetFrame(frame_nr);
+  const std::optional<FifoFrameInfo> frame_data = m_fifo_player.GetFile()->GetFrame(frame_nr);
+  if (!frame_data)
+    return;
+  const FifoFrameInfo& fifo_frame = *frame_data;
 
   const u32 object_start = parts[start_part_nr].m_start;
   const u32 object_end = parts[end_part_nr].m_end;
@@ -428,7 +432,13 @@ void FIFOAnalyzer::BeginSearch()
   const u32 end_part_nr = items[0]->data(0, PART_END_ROLE).toUInt();
 
   const auto& [parts, _part_type_counts] = m_fifo_player.GetAnalyzedFrameInfo(frame_nr);
-  const FifoFrameInfo& fifo_frame = m_fifo_player.GetFile()->GetFrame(frame_nr);
+  const std::optional<FifoFrameInfo> frame_data = m_fifo_player.GetFile()->GetFrame(frame_nr);
+  if (!frame_data)
+  {
+    m_search_label->setText(tr("Failed to read the frame"));
+    return;
+  }
+  const FifoFrameInfo& fifo_frame = *frame_data;
 
   const u32 object_start = parts[start_part_nr].m_start;
   const u32 object_end = parts[end_part_nr].m_end;
@@ -756,7 +766,10 @@ void FIFOAnalyzer::UpdateDescription()
   const u32 entry_nr = m_detail_list->currentRow();
 
   const auto& [parts, _part_type_counts] = m_fifo_player.GetAnalyzedFrameInfo(frame_nr);
-  const FifoFrameInfo& fifo_frame = m_fifo_player.GetFile()->GetFrame(frame_nr);
+  const std::optional<FifoFrameInfo> frame_data = m_fifo_player.GetFile()->GetFrame(frame_nr);
+  if (!frame_data)
+    return;
+  const FifoFrameInfo& fifo_frame = *frame_data;
 
   const u32 object_start = parts[start_part_nr].m_start;
   const u32 object_end = parts[end_part_nr].m_end;
@@ -4,6 +4,7 @@
 #include "DolphinQt/FIFO/FIFOPlayerWindow.h"
 
 #include <QCheckBox>
+#include <QComboBox>
 #include <QDialogButtonBox>
 #include <QEvent>
 #include <QGroupBox>
@@ -17,6 +18,7 @@
 #include <QTabWidget>
 #include <QVBoxLayout>
 
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/FifoPlayer/FifoDataFile.h"
 #include "Core/FifoPlayer/FifoPlayer.h"
@@ -153,8 +155,17 @@ void FIFOPlayerWindow::CreateWidgets()
   m_frame_record_count->setMaximum(3600);
   m_frame_record_count->setValue(3);
 
+  m_compression = new QComboBox;
+  m_compression_label = new QLabel(tr("Compression:"));
+
+  m_compression->addItem(tr("None"), static_cast<int>(FifoCompression::None));
+  m_compression->addItem(QStringLiteral("LZ4"), static_cast<int>(FifoCompression::LZ4));
+  m_compression->addItem(QStringLiteral("Zstandard"), static_cast<int>(FifoCompression::Zstd));
+
   recording_layout->addWidget(m_frame_record_count_label);
   recording_layout->addWidget(m_frame_record_count);
+  recording_layout->addWidget(m_compression_label);
+  recording_layout->addWidget(m_compression);
   recording_group->setLayout(recording_layout);
 
   m_button_box = new QDialogButtonBox(QDialogButtonBox::Close);
@@ -194,6 +205,8 @@ void FIFOPlayerWindow::LoadSettings()
 
   m_early_memory_updates->setChecked(Config::Get(Config::MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES));
   m_loop->setChecked(Config::Get(Config::MAIN_FIFOPLAYER_LOOP_REPLAY));
+  m_compression->setCurrentIndex(m_compression->findData(
+      static_cast<int>(Config::Get(Config::MAIN_FIFOPLAYER_COMPRESSION))));
 }
 
 void FIFOPlayerWindow::ConnectWidgets()
@@ -205,6 +218,8 @@ void FIFOPlayerWindow::ConnectWidgets()
   connect(m_button_box, &QDialogButtonBox::rejected, this, &FIFOPlayerWindow::hide);
   connect(m_early_memory_updates, &QCheckBox::toggled, this, &FIFOPlayerWindow::OnConfigChanged);
   connect(m_loop, &QCheckBox::toggled, this, &FIFOPlayerWindow::OnConfigChanged);
+  connect(m_compression, &QComboBox::currentIndexChanged, this,
+          &FIFOPlayerWindow::OnConfigChanged);
 
   connect(m_frame_range_from, &QSpinBox::valueChanged, this, &FIFOPlayerWindow::OnLimitsChanged);
   connect(m_frame_range_to, &QSpinBox::valueChanged, this, &FIFOPlayerWindow::OnLimitsChanged);
@@ -314,14 +329,13 @@ void FIFOPlayerWindow::UpdateInfo()
   if (m_fifo_recorder.IsRecordingDone())
   {
     FifoDataFile* file = m_fifo_recorder.GetRecordedFile();
-    size_t fifo_bytes = 0;
-    size_t mem_bytes = 0;
+    u64 fifo_bytes = 0;
+    u64 mem_bytes = 0;
 
     for (u32 i = 0; i < file->GetFrameCount(); ++i)
     {
-      fifo_bytes += file->GetFrame(i).fifoData.size();
-      for (const auto& mem_update : file->GetFrame(i).memoryUpdates)
-        mem_bytes += mem_update.data.size();
+      fifo_bytes += file->GetFifoDataSize(i);
+      mem_bytes += file->GetMemoryUpdatesSize(i);
     }
 
     m_info_label->setText(tr("%1 FIFO bytes\n%2 memory bytes\n%3 frames")
@@ -366,6 +380,8 @@ void FIFOPlayerWindow::OnConfigChanged()
   Config::SetBase(Config::MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES,
                   m_early_memory_updates->isChecked());
   Config::SetBase(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, m_loop->isChecked());
+  Config::SetBase(Config::MAIN_FIFOPLAYER_COMPRESSION,
+                  static_cast<FifoCompression>(m_compression->currentData().toInt()));
 }
 
 void FIFOPlayerWindow::OnLimitsChanged()
@@ -408,6 +424,8 @@ void FIFOPlayerWindow::UpdateControls()
 
   m_frame_record_count_label->setEnabled(enable_frame_record_count);
   m_frame_record_count->setEnabled(enable_frame_record_count);
+  m_compression_label->setEnabled(enable_frame_record_count);
+  m_compression->setEnabled(enable_frame_record_count);
 
   m_load->setEnabled(core_is_uninitialized);
   m_record->setEnabled(core_is_running && !is_playing);
@@ -7,6 +7,7 @@
 
 #include "Core/Core.h"
 
+class QComboBox;
 class QDialogButtonBox;
 class QLabel;
 class QPushButton;
@@ -66,6 +67,8 @@ private:
   QLabel* m_frame_range_to_label;
   QSpinBox* m_frame_record_count;
   QLabel* m_frame_record_count_label;
+  QComboBox* m_compression;
+  QLabel* m_compression_label;
   QSpinBox* m_object_range_from;
   QLabel* m_object_range_from_label;
   QSpinBox* m_object_range_to;
@@ -187,6 +187,15 @@ void AudioPane::CreateWidgets()
   audio_buffer_size_label->setText(tr("%1 ms").arg(audio_buffer_size->value()));
   audio_buffer_size_label->setFixedWidth(QFontMetrics(font()).boundingRect(tr(" 000 ms")).width());
 
+  QStringList resampling_options{tr("Low (6-Point Hermite)"), tr("Medium (16-Tap Sinc)"),
+                                 tr("High (32-Tap Sinc)")};
+  m_resampling_quality_combo =
+      new ConfigChoice(resampling_options, Config::MAIN_AUDIO_RESAMPLING_QUALITY);
+
+  auto* resampling_layout = new QHBoxLayout;
+  resampling_layout->addWidget(new QLabel(tr("Resampling Quality:")));
+  resampling_layout->addWidget(m_resampling_quality_combo, 1);
+
   m_audio_fill_gaps = new ConfigBool(tr("Fill Audio Gaps"), Config::MAIN_AUDIO_FILL_GAPS);
 
   m_audio_preserve_pitch =
@@ -202,10 +211,11 @@ void AudioPane::CreateWidgets()
   buffer_layout->addWidget(audio_buffer_size_label);
 
   playback_layout->addLayout(buffer_layout, 0, 0);
-  playback_layout->addWidget(m_audio_fill_gaps, 1, 0);
-  playback_layout->addWidget(m_audio_preserve_pitch, 2, 0);
-  playback_layout->addWidget(m_speed_up_mute_enable, 3, 0);
-  playback_layout->setRowStretch(4, 1);
+  playback_layout->addLayout(resampling_layout, 1, 0);
+  playback_layout->addWidget(m_audio_fill_gaps, 2, 0);
+  playback_layout->addWidget(m_audio_preserve_pitch, 3, 0);
+  playback_layout->addWidget(m_speed_up_mute_enable, 4, 0);
+  playback_layout->setRowStretch(5, 1);
   playback_box->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
 
   // Wiimote Audio Routing
@@ -423,6 +433,10 @@ void AudioPane::AddDescriptions()
       "Keeps audio at normal pitch when changing emulation speed. Without this, audio pitch "
       "changes proportionally with speed.<br><br><dolphin_emphasis>If unsure, leave this "
       "unchecked.</dolphin_emphasis>");
+  static const char TR_RESAMPLING_QUALITY_DESCRIPTION[] = QT_TR_NOOP(
+      "Selects how audio is converted to the sample rate of the audio backend. Higher settings "
+      "are clearer, especially for high-pitched sounds, but use more CPU time.<br><br>"
+      "<dolphin_emphasis>If unsure, select Low.</dolphin_emphasis>");
   static const char TR_SPEED_UP_MUTE_DESCRIPTION[] =
       QT_TR_NOOP("Mutes the audio when overriding the emulation speed limit (default hotkey: Tab). "
                  "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
@@ -461,6 +475,9 @@ void AudioPane::AddDescriptions()
   m_speed_up_mute_enable->SetTitle(tr("Mute When Disabling Speed Limit"));
   m_speed_up_mute_enable->SetDescription(tr(TR_SPEED_UP_MUTE_DESCRIPTION));
 
+  m_resampling_quality_combo->SetTitle(tr("Resampling Quality"));
+  m_resampling_quality_combo->SetDescription(tr(TR_RESAMPLING_QUALITY_DESCRIPTION));
+
   m_audio_fill_gaps->SetTitle(tr("Fill Audio Gaps"));
   m_audio_fill_gaps->SetDescription(tr(TR_FILL_AUDIO_GAPS_DESCRIPTION));
 
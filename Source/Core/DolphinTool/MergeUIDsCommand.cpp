@@ -0,0 +1,78 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/MergeUIDsCommand.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/ostream.h>
+
+#include "VideoCommon/PipelineUIDDatabase.h"
+
+namespace DolphinTool
+{
+int MergeUIDsCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: mergeuids [options]... FILE...\n\n"
+               "Merges the pipeline UID files (.uidcache) of a game, for example from the shader "
+               "cache directories of several machines, into one database. Place the database in "
+               "Load/PipelineUIDs/ as <game ID>.uidcache to have all of its pipelines compiled "
+               "when the game starts.");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the merged database FILE. If it exists, it is merged into as well.")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser.parse_args(args);
+  const std::vector<std::string> input_paths = parser.args();
+
+  // Validate options
+  const std::string& output_path = options["output"];
+  if (output_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+
+  if (input_paths.empty())
+  {
+    fmt::print(std::cerr, "Error: No input files\n");
+    return EXIT_FAILURE;
+  }
+
+  // Keep the UIDs of an existing database first, so that merging more files into it only appends.
+  VideoCommon::PipelineUIDDatabase database;
+  if (database.Load(output_path))
+    fmt::print(std::cout, "{}: {} UIDs\n", output_path, database.GetSize());
+
+  for (const std::string& input_path : input_paths)
+  {
+    const size_t previous_size = database.GetSize();
+    if (!database.Load(input_path))
+    {
+      fmt::print(std::cerr, "Error: {} is not a pipeline UID file of the current version\n",
+                 input_path);
+      return EXIT_FAILURE;
+    }
+
+    fmt::print(std::cout, "{}: {} new UIDs\n", input_path, database.GetSize() - previous_size);
+  }
+
+  if (!database.Save(output_path))
+  {
+    fmt::print(std::cerr, "Error: Unable to write {}\n", output_path);
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Wrote {} UIDs to {}\n", database.GetSize(), output_path);
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -12,6 +12,7 @@
 #include "DolphinTool/ConvertCommand.h"
 #include "DolphinTool/ExtractCommand.h"
 #include "DolphinTool/HeaderCommand.h"
+#include "DolphinTool/MergeUIDsCommand.h"
 #include "DolphinTool/VerifyCommand.h"
 
 #ifdef _WIN32
@@ -22,7 +23,7 @@ static void PrintUsage()
 {
   fmt::print(std::cerr, "usage: dolphin-tool COMMAND -h\n"
                         "\n"
-                        "commands supported: [convert, verify, header, extract]\n");
+                        "commands supported: [convert, verify, header, extract, mergeuids]\n");
 }
 
 #ifdef _WIN32
@@ -49,6 +50,8 @@ int main(int argc, char* argv[])
     return DolphinTool::HeaderCommand(args);
   else if (command_str == "extract")
     return DolphinTool::Extract(args);
+  else if (command_str == "mergeuids")
+    return DolphinTool::MergeUIDsCommand(args);
   PrintUsage();
   return EXIT_FAILURE;
 }
@@ -4,11 +4,24 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/Thread.h"
+
+#include "Core/Config/GraphicsSettings.h"
 
 #include "VideoBackends/Software/NativeVertexFormat.h"
 #include "VideoBackends/Software/SWEfbInterface.h"
@@ -95,21 +108,100 @@ struct Slope
   }
 };
 
+// A triangle which passed setup, with everything needed to rasterize it. Triangles are queued
+// until the end of the batch, because the vertices they were set up from get reused.
+struct TriangleSetup
+{
+  Slope ZSlope;
+  Slope WSlope;
+  Slope ColorSlopes[2][4];
+  Slope TexSlopes[8][3];
+
+  // Half-edge constants, in 28.4 fixed point
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+  s32 C1, C2, C3;
+
+  // Bounding rectangle, clipped to the scissor
+  s32 minx, maxx, miny, maxy;
+};
+
+// The state of one thread drawing pixels.
+struct DrawContext
+{
+  Tev tev;
+  RasterBlock rasterBlock;
+};
+
+// The EFB is split into tiles which are drawn in parallel. Every tile is drawn by a single
+// thread, which draws the triangles overlapping it in submission order, so the result does not
+// depend on the number of threads. Tiles are made of whole 2x2 blocks, since the LOD of a block
+// is computed from all of its pixels.
+static constexpr s32 TILE_SIZE = 32;
+static_assert(TILE_SIZE % BLOCK_SIZE == 0);
+static constexpr s32 TILES_X = (EFB_WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr s32 TILES_Y = (EFB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr u32 NUM_TILES = TILES_X * TILES_Y;
+
+// Batches which cover fewer pixels than this (going by their bounding rectangles) are drawn on
+// the video thread alone, since waking up the workers would take longer.
+static constexpr u64 MIN_PIXELS_FOR_WORKERS = 4096;
+
 static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
 
-static Tev tev;
-static RasterBlock rasterBlock;
+static std::vector<TriangleSetup> s_triangles;
+static u64 s_queued_pixels = 0;
+static std::array<std::vector<u32>, NUM_TILES> s_tile_triangles;
+
+// The first context belongs to the video thread, the others to the worker threads.
+static std::vector<std::unique_ptr<DrawContext>> s_contexts;
+static std::vector<std::thread> s_workers;
+static std::mutex s_work_mutex;
+static std::condition_variable s_work_cv;
+static std::condition_variable s_work_done_cv;
+static u64 s_work_generation = 0;
+static u32 s_busy_workers = 0;
+static bool s_workers_exit = false;
+static std::atomic<u32> s_next_tile = 0;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+static void WorkerThread(u32 index);
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
   ZSlope = Slope();
+
+  int num_threads = Config::Get(Config::GFX_SW_RASTERIZER_THREADS);
+  if (num_threads < 0)
+    num_threads = std::clamp(cpu_info.num_cores, 1, 16);
+  num_threads = std::clamp(num_threads, 1, static_cast<int>(NUM_TILES));
+
+  s_contexts.clear();
+  for (int i = 0; i < num_threads; i++)
+    s_contexts.push_back(std::make_unique<DrawContext>());
+
+  s_workers_exit = false;
+  for (int i = 1; i < num_threads; i++)
+    s_workers.emplace_back(WorkerThread, static_cast<u32>(i));
+}
+
+void Shutdown()
+{
+  {
+    std::lock_guard lk(s_work_mutex);
+    s_workers_exit = true;
+  }
+  s_work_cv.notify_all();
+  for (std::thread& worker : s_workers)
+    worker.join();
+  s_workers.clear();
+  s_contexts.clear();
+
+  s_triangles.clear();
+  s_queued_pixels = 0;
 }
 
 void ScissorChanged()
@@ -141,31 +233,39 @@ static inline int iround(float x)
   return t;
 }
 
-void SetTevKonstColors()
+void SetTevState()
 {
-  tev.SetKonstColors();
+  for (auto& context : s_contexts)
+  {
+    context->tev.SetKonstColors();
+    context->tev.SetupCombinerStages();
+  }
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(DrawContext& context, const TriangleSetup& triangle, s32 x, s32 y, s32 xi,
+                 s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  Tev& tev = context.tev;
+  const RasterBlock& rasterBlock = context.rasterBlock;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  ++tev.RasterizedPixels;
+
+  s32 z = (s32)std::clamp<float>(triangle.ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
+    ++tev.PerfQuadCounts[PQ_ZCOMP_INPUT_ZCOMPLOC];
     if (bpmem.zmode.test_enable)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
         return;
     }
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
+    ++tev.PerfQuadCounts[PQ_ZCOMP_OUTPUT_ZCOMPLOC];
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
   tev.Position[0] = x;
   tev.Position[1] = y;
@@ -176,7 +276,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      const float color = ColorSlopes[i][comp].GetValue(x, y);
+      const float color = triangle.ColorSlopes[i][comp].GetValue(x, y);
       tev.Color[i][comp] = (u8)std::clamp<float>(color, 0.0f, 255.0f);
     }
   }
@@ -204,7 +304,8 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   tev.Draw();
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -215,9 +316,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -255,7 +356,8 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(RasterBlock& rasterBlock, const TriangleSetup& triangle, s32 blockX,
+                       s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
@@ -266,19 +368,19 @@ static void BuildBlock(s32 blockX, s32 blockY)
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / triangle.WSlope.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = triangle.TexSlopes[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = triangle.TexSlopes[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = triangle.TexSlopes[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -288,7 +390,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -300,7 +403,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -317,9 +421,8 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+static void SetupTriangle(const OutputVertexData* v0, const OutputVertexData* v1,
+                          const OutputVertexData* v2, const BPFunctions::ScissorRect& scissor)
 {
   // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
   // zfreeze depends on it
@@ -337,24 +440,6 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 X2 = iround(16.0f * (v1->screenPosition.x - scissor.x_off)) - 9;
   const s32 X3 = iround(16.0f * (v2->screenPosition.x - scissor.x_off)) - 9;
 
-  // Deltas
-  const s32 DX12 = X1 - X2;
-  const s32 DX23 = X2 - X3;
-  const s32 DX31 = X3 - X1;
-
-  const s32 DY12 = Y1 - Y2;
-  const s32 DY23 = Y2 - Y3;
-  const s32 DY31 = Y3 - Y1;
-
-  // Fixed-point deltas
-  const s32 FDX12 = DX12 * 16;
-  const s32 FDX23 = DX23 * 16;
-  const s32 FDX31 = DX31 * 16;
-
-  const s32 FDY12 = DY12 * 16;
-  const s32 FDY23 = DY23 * 16;
-  const s32 FDY31 = DY31 * 16;
-
   // Bounding rectangle
   s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
   s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
@@ -375,51 +460,101 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   if (minx >= maxx || miny >= maxy)
     return;
 
+  TriangleSetup& triangle = s_triangles.emplace_back();
+  triangle.ZSlope = ZSlope;
+  triangle.minx = minx;
+  triangle.maxx = maxx;
+  triangle.miny = miny;
+  triangle.maxy = maxy;
+  s_queued_pixels += static_cast<u64>(maxx - minx) * (maxy - miny);
+
   // Set up the remaining slopes
   const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
                          scissor.y_off);
 
   float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
                 1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
+  triangle.WSlope = Slope(w[0], w[1], w[2], ctx);
 
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    {
+      triangle.ColorSlopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
   }
 
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
-    TexSlopes[i][0] =
+    triangle.TexSlopes[i][0] =
         Slope(v0->texCoords[i].x * w[0], v1->texCoords[i].x * w[1], v2->texCoords[i].x * w[2], ctx);
-    TexSlopes[i][1] =
+    triangle.TexSlopes[i][1] =
         Slope(v0->texCoords[i].y * w[0], v1->texCoords[i].y * w[1], v2->texCoords[i].y * w[2], ctx);
-    TexSlopes[i][2] =
+    triangle.TexSlopes[i][2] =
         Slope(v0->texCoords[i].z * w[0], v1->texCoords[i].z * w[1], v2->texCoords[i].z * w[2], ctx);
   }
 
+  // Deltas
+  triangle.DX12 = X1 - X2;
+  triangle.DX23 = X2 - X3;
+  triangle.DX31 = X3 - X1;
+
+  triangle.DY12 = Y1 - Y2;
+  triangle.DY23 = Y2 - Y3;
+  triangle.DY31 = Y3 - Y1;
+
   // Half-edge constants
-  s32 C1 = DY12 * X1 - DX12 * Y1;
-  s32 C2 = DY23 * X2 - DX23 * Y2;
-  s32 C3 = DY31 * X3 - DX31 * Y3;
+  triangle.C1 = triangle.DY12 * X1 - triangle.DX12 * Y1;
+  triangle.C2 = triangle.DY23 * X2 - triangle.DX23 * Y2;
+  triangle.C3 = triangle.DY31 * X3 - triangle.DX31 * Y3;
 
   // Correct for fill convention
-  if (DY12 < 0 || (DY12 == 0 && DX12 > 0))
-    C1++;
-  if (DY23 < 0 || (DY23 == 0 && DX23 > 0))
-    C2++;
-  if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
-    C3++;
+  if (triangle.DY12 < 0 || (triangle.DY12 == 0 && triangle.DX12 > 0))
+    triangle.C1++;
+  if (triangle.DY23 < 0 || (triangle.DY23 == 0 && triangle.DX23 > 0))
+    triangle.C2++;
+  if (triangle.DY31 < 0 || (triangle.DY31 == 0 && triangle.DX31 > 0))
+    triangle.C3++;
+}
+
+// Draws the part of the triangle inside the given rectangle, whose edges must be aligned to blocks.
+static void RasterizeTriangle(DrawContext& context, const TriangleSetup& triangle, s32 left,
+                              s32 top, s32 right, s32 bottom)
+{
+  const s32 DX12 = triangle.DX12;
+  const s32 DX23 = triangle.DX23;
+  const s32 DX31 = triangle.DX31;
+  const s32 DY12 = triangle.DY12;
+  const s32 DY23 = triangle.DY23;
+  const s32 DY31 = triangle.DY31;
+  const s32 C1 = triangle.C1;
+  const s32 C2 = triangle.C2;
+  const s32 C3 = triangle.C3;
+  const s32 minx = triangle.minx;
+  const s32 maxx = triangle.maxx;
+  const s32 miny = triangle.miny;
+  const s32 maxy = triangle.maxy;
+
+  // Fixed-point deltas
+  const s32 FDX12 = DX12 * 16;
+  const s32 FDX23 = DX23 * 16;
+  const s32 FDX31 = DX31 * 16;
+
+  const s32 FDY12 = DY12 * 16;
+  const s32 FDY23 = DY23 * 16;
+  const s32 FDY31 = DY31 * 16;
 
   // Start in corner of 2x2 block
-  s32 block_minx = minx & ~(BLOCK_SIZE - 1);
-  s32 block_miny = miny & ~(BLOCK_SIZE - 1);
+  s32 block_minx = std::max(minx & ~(BLOCK_SIZE - 1), left);
+  s32 block_miny = std::max(miny & ~(BLOCK_SIZE - 1), top);
+  const s32 block_maxx = std::min(maxx, right);
+  const s32 block_maxy = std::min(maxy, bottom);
 
   // Loop through blocks
-  for (s32 y = block_miny & ~(BLOCK_SIZE - 1); y < maxy; y += BLOCK_SIZE)
+  for (s32 y = block_miny; y < block_maxy; y += BLOCK_SIZE)
   {
-    for (s32 x = block_minx; x < maxx; x += BLOCK_SIZE)
+    for (s32 x = block_minx; x < block_maxx; x += BLOCK_SIZE)
     {
       s32 x1_ = (x + BLOCK_SIZE - 1);
       s32 y1_ = (y + BLOCK_SIZE - 1);
@@ -453,7 +588,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(context.rasterBlock, triangle, x, y);
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -463,7 +598,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            Draw(context, triangle, x + ix, y + iy, ix, iy);
           }
         }
       }
@@ -486,7 +621,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
               if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+                Draw(context, triangle, x + ix, y + iy, ix, iy);
             }
 
             CX1 -= FDY12;
@@ -509,6 +644,95 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
   INCSTAT(g_stats.this_frame.num_triangles_drawn);
 
   for (const auto& scissor : scissors)
-    DrawTriangleFrontFace(v0, v1, v2, scissor);
+    SetupTriangle(v0, v1, v2, scissor);
+}
+
+static void DrawTiles(DrawContext& context)
+{
+  for (u32 tile = s_next_tile.fetch_add(1, std::memory_order_relaxed); tile < NUM_TILES;
+       tile = s_next_tile.fetch_add(1, std::memory_order_relaxed))
+  {
+    const s32 left = static_cast<s32>(tile % TILES_X) * TILE_SIZE;
+    const s32 top = static_cast<s32>(tile / TILES_X) * TILE_SIZE;
+    for (const u32 index : s_tile_triangles[tile])
+      RasterizeTriangle(context, s_triangles[index], left, top, left + TILE_SIZE, top + TILE_SIZE);
+  }
+}
+
+static void WorkerThread(u32 index)
+{
+  Common::SetCurrentThreadName(fmt::format("SW Rasterizer {}", index).c_str());
+
+  u64 generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock lk(s_work_mutex);
+      s_work_cv.wait(lk, [&] { return s_workers_exit || s_work_generation != generation; });
+      if (s_workers_exit)
+        return;
+      generation = s_work_generation;
+    }
+
+    DrawTiles(*s_contexts[index]);
+
+    {
+      std::lock_guard lk(s_work_mutex);
+      if (--s_busy_workers == 0)
+        s_work_done_cv.notify_one();
+    }
+  }
+}
+
+void Flush()
+{
+  if (s_triangles.empty())
+    return;
+
+  if (s_workers.empty() || s_queued_pixels < MIN_PIXELS_FOR_WORKERS)
+  {
+    for (const TriangleSetup& triangle : s_triangles)
+      RasterizeTriangle(*s_contexts[0], triangle, 0, 0, EFB_WIDTH, EFB_HEIGHT);
+  }
+  else
+  {
+    for (u32 i = 0; i < s_triangles.size(); i++)
+    {
+      const TriangleSetup& triangle = s_triangles[i];
+      const s32 first_x = (triangle.minx & ~(BLOCK_SIZE - 1)) / TILE_SIZE;
+      const s32 first_y = (triangle.miny & ~(BLOCK_SIZE - 1)) / TILE_SIZE;
+      const s32 last_x = (triangle.maxx - 1) / TILE_SIZE;
+      const s32 last_y = (triangle.maxy - 1) / TILE_SIZE;
+      for (s32 tile_y = first_y; tile_y <= last_y; tile_y++)
+      {
+        for (s32 tile_x = first_x; tile_x <= last_x; tile_x++)
+          s_tile_triangles[tile_y * TILES_X + tile_x].push_back(i);
+      }
+    }
+
+    s_next_tile.store(0, std::memory_order_relaxed);
+    {
+      std::lock_guard lk(s_work_mutex);
+      s_busy_workers = static_cast<u32>(s_workers.size());
+      s_work_generation++;
+    }
+    s_work_cv.notify_all();
+
+    DrawTiles(*s_contexts[0]);
+
+    {
+      std::unique_lock lk(s_work_mutex);
+      s_work_done_cv.wait(lk, [] { return s_busy_workers == 0; });
+    }
+
+    for (auto& tile_triangles : s_tile_triangles)
+      tile_triangles.clear();
+  }
+
+  for (auto& context : s_contexts)
+    context->tev.FlushCounters();
+
+  s_triangles.clear();
+  s_queued_pixels = 0;
 }
 }  // namespace Rasterizer
@@ -10,14 +10,20 @@ struct OutputVertexData;
 namespace Rasterizer
 {
 void Init();
+void Shutdown();
 void ScissorChanged();
 
 void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
                   const OutputVertexData* v2, s32 x_off, s32 y_off);
+// Queues the triangle to be drawn by the next Flush().
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2);
+// Draws all queued triangles, in parallel if there are enough pixels to make it worthwhile. The
+// triangles must all have been queued with the same BP state, which holds within a batch.
+void Flush();
 
-void SetTevKonstColors();
+// Updates the TEV state derived from bpmem at the start of a batch.
+void SetTevState();
 
 struct RasterBlockPixel
 {
@@ -21,16 +21,6 @@
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/XFMemory.h"
 
-static inline s16 Clamp255(s16 in)
-{
-  return std::clamp<s16>(in, 0, 255);
-}
-
-static inline s16 Clamp1024(s16 in)
-{
-  return std::clamp<s16>(in, -1024, 1023);
-}
-
 void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
 {
   switch (colorChan)
@@ -77,119 +67,6 @@ void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
   }
 }
 
-void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
-{
-  for (int i = BLU_C; i <= RED_C; i++)
-  {
-    const InputRegType& InputReg = inputs[i];
-
-    const u16 c = InputReg.c + (InputReg.c >> 7);
-
-    s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-    temp <<= s_ScaleLShiftLUT[cc.scale];
-    temp += (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
-    temp >>= 8;
-    temp = cc.op == TevOp::Sub ? -temp : temp;
-
-    s32 result = ((InputReg.d + s_BiasLUT[cc.bias]) << s_ScaleLShiftLUT[cc.scale]) + temp;
-    result = result >> s_ScaleRShiftLUT[cc.scale];
-
-    Reg[cc.dest][i] = result;
-  }
-}
-
-void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
-{
-  for (int i = BLU_C; i <= RED_C; i++)
-  {
-    u32 a, b;
-    switch (cc.compare_mode)
-    {
-    case TevCompareMode::R8:
-      a = inputs[RED_C].a;
-      b = inputs[RED_C].b;
-      break;
-
-    case TevCompareMode::GR16:
-      a = (inputs[GRN_C].a << 8) | inputs[RED_C].a;
-      b = (inputs[GRN_C].b << 8) | inputs[RED_C].b;
-      break;
-
-    case TevCompareMode::BGR24:
-      a = (inputs[BLU_C].a << 16) | (inputs[GRN_C].a << 8) | inputs[RED_C].a;
-      b = (inputs[BLU_C].b << 16) | (inputs[GRN_C].b << 8) | inputs[RED_C].b;
-      break;
-
-    case TevCompareMode::RGB8:
-      a = inputs[i].a;
-      b = inputs[i].b;
-      break;
-
-    default:
-      PanicAlertFmt("Invalid compare mode {}", cc.compare_mode);
-      continue;
-    }
-
-    if (cc.comparison == TevComparison::GT)
-      Reg[cc.dest][i] = inputs[i].d + ((a > b) ? inputs[i].c : 0);
-    else
-      Reg[cc.dest][i] = inputs[i].d + ((a == b) ? inputs[i].c : 0);
-  }
-}
-
-void Tev::DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
-{
-  const InputRegType& InputReg = inputs[ALP_C];
-
-  const u16 c = InputReg.c + (InputReg.c >> 7);
-
-  s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-  temp <<= s_ScaleLShiftLUT[ac.scale];
-  temp += (ac.scale == TevScale::Divide2) ? 0 : (ac.op == TevOp::Sub) ? 127 : 128;
-  temp = ac.op == TevOp::Sub ? (-temp >> 8) : (temp >> 8);
-
-  s32 result = ((InputReg.d + s_BiasLUT[ac.bias]) << s_ScaleLShiftLUT[ac.scale]) + temp;
-  result = result >> s_ScaleRShiftLUT[ac.scale];
-
-  Reg[ac.dest].a = result;
-}
-
-void Tev::DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
-{
-  u32 a, b;
-  switch (ac.compare_mode)
-  {
-  case TevCompareMode::R8:
-    a = inputs[RED_C].a;
-    b = inputs[RED_C].b;
-    break;
-
-  case TevCompareMode::GR16:
-    a = (inputs[GRN_C].a << 8) | inputs[RED_C].a;
-    b = (inputs[GRN_C].b << 8) | inputs[RED_C].b;
-    break;
-
-  case TevCompareMode::BGR24:
-    a = (inputs[BLU_C].a << 16) | (inputs[GRN_C].a << 8) | inputs[RED_C].a;
-    b = (inputs[BLU_C].b << 16) | (inputs[GRN_C].b << 8) | inputs[RED_C].b;
-    break;
-
-  case TevCompareMode::A8:
-    a = inputs[ALP_C].a;
-    b = inputs[ALP_C].b;
-    break;
-
-  default:
-    PanicAlertFmt("Invalid compare mode {}", ac.compare_mode);
-    return;
-  }
-
-  if (ac.comparison == TevComparison::GT)
-    Reg[ac.dest].a = inputs[ALP_C].d + ((a > b) ? inputs[ALP_C].c : 0);
-  else
-    Reg[ac.dest].a = inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
-}
-
 static bool AlphaCompare(int alpha, int ref, CompareMode comp)
 {
   switch (comp)
@@ -389,7 +266,14 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+  ++PixelsIn;
+
+  // Stages without a texture and indirect stages using an unsampled indirect texture read
+  // whatever was left over in these. Don't let that leak from the previously drawn pixel, which
+  // depends on how the rasterizer splits the work between threads.
+  RawTexColor = TevColor();
+  TexColor = TevColor();
+  std::memset(IndirectTex, 0, sizeof(IndirectTex));
 
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
@@ -489,51 +373,21 @@ void Tev::Draw()
     SetRasColor(order.getColorChan(stageOdd), ac.rswap);
 
     // combine inputs
-    InputRegType inputs[4];
-    inputs[BLU_C].a = m_ColorInputLUT[cc.a].b;
-    inputs[BLU_C].b = m_ColorInputLUT[cc.b].b;
-    inputs[BLU_C].c = m_ColorInputLUT[cc.c].b;
-    inputs[BLU_C].d = m_ColorInputLUT[cc.d].b;
-    inputs[GRN_C].a = m_ColorInputLUT[cc.a].g;
-    inputs[GRN_C].b = m_ColorInputLUT[cc.b].g;
-    inputs[GRN_C].c = m_ColorInputLUT[cc.c].g;
-    inputs[GRN_C].d = m_ColorInputLUT[cc.d].g;
-    inputs[RED_C].a = m_ColorInputLUT[cc.a].r;
-    inputs[RED_C].b = m_ColorInputLUT[cc.b].r;
-    inputs[RED_C].c = m_ColorInputLUT[cc.c].r;
-    inputs[RED_C].d = m_ColorInputLUT[cc.d].r;
-    inputs[ALP_C].a = m_AlphaInputLUT[ac.a].a;
-    inputs[ALP_C].b = m_AlphaInputLUT[ac.b].a;
-    inputs[ALP_C].c = m_AlphaInputLUT[ac.c].a;
-    inputs[ALP_C].d = m_AlphaInputLUT[ac.d].a;
-
-    if (cc.bias != TevBias::Compare)
-      DrawColorRegular(cc, inputs);
-    else
-      DrawColorCompare(cc, inputs);
-
-    if (cc.clamp)
-    {
-      Reg[cc.dest].r = Clamp255(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp255(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp255(Reg[cc.dest].b);
-    }
-    else
-    {
-      Reg[cc.dest].r = Clamp1024(Reg[cc.dest].r);
-      Reg[cc.dest].g = Clamp1024(Reg[cc.dest].g);
-      Reg[cc.dest].b = Clamp1024(Reg[cc.dest].b);
-    }
-
-    if (ac.bias != TevBias::Compare)
-      DrawAlphaRegular(ac, inputs);
-    else
-      DrawAlphaCompare(ac, inputs);
-
-    if (ac.clamp)
-      Reg[ac.dest].a = Clamp255(Reg[ac.dest].a);
-    else
-      Reg[ac.dest].a = Clamp1024(Reg[ac.dest].a);
+    TevCombiner::Inputs inputs;
+    const TevColorRef& color_a = m_ColorInputLUT[cc.a];
+    const TevColorRef& color_b = m_ColorInputLUT[cc.b];
+    const TevColorRef& color_c = m_ColorInputLUT[cc.c];
+    const TevColorRef& color_d = m_ColorInputLUT[cc.d];
+    inputs.a = {m_AlphaInputLUT[ac.a].a, color_a.b, color_a.g, color_a.r};
+    inputs.b = {m_AlphaInputLUT[ac.b].a, color_b.b, color_b.g, color_b.r};
+    inputs.c = {m_AlphaInputLUT[ac.c].a, color_c.b, color_c.g, color_c.r};
+    inputs.d = {m_AlphaInputLUT[ac.d].a, color_d.b, color_d.g, color_d.r};
+
+    const std::array<s16, 4> result = TevCombiner::Combine(CombinerStages[stageNum], inputs);
+    Reg[cc.dest].r = result[RED_C];
+    Reg[cc.dest].g = result[GRN_C];
+    Reg[cc.dest].b = result[BLU_C];
+    Reg[ac.dest].a = result[ALP_C];
   }
 
   // convert to 8 bits per component
@@ -663,21 +517,23 @@ void Tev::Draw()
   if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    ++PerfQuadCounts[PQ_ZCOMP_INPUT];
 
     if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    ++PerfQuadCounts[PQ_ZCOMP_OUTPUT];
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  BBox[0] = std::min(BBox[0], static_cast<u16>(Position[0] & ~1));
+  BBox[1] = std::max(BBox[1], static_cast<u16>(Position[0] | 1));
+  BBox[2] = std::min(BBox[2], static_cast<u16>(Position[1] & ~1));
+  BBox[3] = std::max(BBox[3], static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  ++PixelsOut;
+  ++PerfQuadCounts[PQ_BLEND_INPUT];
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
@@ -695,3 +551,33 @@ void Tev::SetKonstColors()
     KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
   }
 }
+
+void Tev::SetupCombinerStages()
+{
+  for (unsigned int stageNum = 0; stageNum <= bpmem.genMode.numtevstages; stageNum++)
+  {
+    CombinerStages[stageNum] = TevCombiner::SetupStage(bpmem.combiners[stageNum].colorC,
+                                                       bpmem.combiners[stageNum].alphaC);
+  }
+}
+
+void Tev::FlushCounters()
+{
+  for (u32 i = 0; i < PQ_NUM_MEMBERS; i++)
+  {
+    if (PerfQuadCounts[i] != 0)
+      EfbInterface::IncPerfCounterQuadCount(static_cast<PerfQueryType>(i), PerfQuadCounts[i]);
+  }
+  PerfQuadCounts = {};
+
+  // The initial values leave the bounding box unchanged if no pixel was drawn.
+  BBoxManager::Update(BBox[0], BBox[1], BBox[2], BBox[3]);
+  BBox = {0xffff, 0, 0xffff, 0};
+
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, RasterizedPixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, PixelsIn);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, PixelsOut);
+  RasterizedPixels = 0;
+  PixelsIn = 0;
+  PixelsOut = 0;
+}
@@ -5,8 +5,11 @@
 
 #include <array>
 
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "VideoBackends/Software/TevCombiner.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -90,14 +93,6 @@ class Tev
     }
   };
 
-  struct InputRegType
-  {
-    unsigned a : 8;
-    unsigned b : 8;
-    unsigned c : 8;
-    signed d : 11;
-  };
-
   struct TextureCoordinateType
   {
     signed s : 24;
@@ -193,9 +188,7 @@ class Tev
       TevKonstRef::Value(KonstantColors[2].a),  // Konst 2 Alpha
       TevKonstRef::Value(KonstantColors[3].a),  // Konst 3 Alpha
   };
-  static constexpr Common::EnumMap<s16, TevBias::Compare> s_BiasLUT{0, 128, -128, 0};
-  static constexpr Common::EnumMap<u8, TevScale::Divide2> s_ScaleLShiftLUT{0, 1, 2, 0};
-  static constexpr Common::EnumMap<u8, TevScale::Divide2> s_ScaleRShiftLUT{0, 0, 0, 1};
+  std::array<TevCombiner::Stage, 16> CombinerStages;
 
   enum BufferBase
   {
@@ -206,11 +199,6 @@ class Tev
 
   void SetRasColor(RasColorChan colorChan, u32 swaptable);
 
-  void DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
-  void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
-  void DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
-  void DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4]);
-
   void Indirect(unsigned int stageNum, s32 s, s32 t);
 
 public:
@@ -222,6 +210,15 @@ public:
   s32 TextureLod[16]{};
   bool TextureLinear[16]{};
 
+  // Counters for the pixels drawn by this instance. The rasterizer draws tiles of the EFB with
+  // one instance per thread, so they are only added to the global perf query values, bounding box
+  // and statistics by FlushCounters().
+  std::array<u32, PQ_NUM_MEMBERS> PerfQuadCounts{};
+  std::array<u16, 4> BBox{0xffff, 0, 0xffff, 0};  // left, right, top, bottom
+  u32 RasterizedPixels = 0;
+  u32 PixelsIn = 0;
+  u32 PixelsOut = 0;
+
   enum
   {
     ALP_C,
@@ -231,5 +228,8 @@ public:
   };
 
   void SetKonstColors();
+  // Updates the state derived from bpmem, which must not change until the next call.
+  void SetupCombinerStages();
   void Draw();
+  void FlushCounters();
 };
@@ -0,0 +1,311 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/Software/TevCombiner.h"
+
+#include <algorithm>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
+#include "Common/Intrinsics.h"
+
+namespace TevCombiner
+{
+namespace
+{
+struct InputRegType
+{
+  unsigned a : 8;
+  unsigned b : 8;
+  unsigned c : 8;
+  signed d : 11;
+};
+
+constexpr Common::EnumMap<s16, TevBias::Compare> s_BiasLUT{0, 128, -128, 0};
+constexpr Common::EnumMap<u8, TevScale::Divide2> s_ScaleLShiftLUT{0, 1, 2, 0};
+constexpr Common::EnumMap<u8, TevScale::Divide2> s_ScaleRShiftLUT{0, 0, 0, 1};
+
+s16 Clamp255(s16 in)
+{
+  return std::clamp<s16>(in, 0, 255);
+}
+
+s16 Clamp1024(s16 in)
+{
+  return std::clamp<s16>(in, -1024, 1023);
+}
+
+s16 DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType& InputReg)
+{
+  const u16 c = InputReg.c + (InputReg.c >> 7);
+
+  s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
+  temp <<= s_ScaleLShiftLUT[cc.scale];
+  temp += (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
+  temp >>= 8;
+  temp = cc.op == TevOp::Sub ? -temp : temp;
+
+  s32 result = ((InputReg.d + s_BiasLUT[cc.bias]) << s_ScaleLShiftLUT[cc.scale]) + temp;
+  result = result >> s_ScaleRShiftLUT[cc.scale];
+
+  return result;
+}
+
+s16 DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4],
+                     int i)
+{
+  u32 a, b;
+  switch (cc.compare_mode)
+  {
+  case TevCompareMode::R8:
+    a = inputs[RED_C].a;
+    b = inputs[RED_C].b;
+    break;
+
+  case TevCompareMode::GR16:
+    a = (inputs[GRN_C].a << 8) | inputs[RED_C].a;
+    b = (inputs[GRN_C].b << 8) | inputs[RED_C].b;
+    break;
+
+  case TevCompareMode::BGR24:
+    a = (inputs[BLU_C].a << 16) | (inputs[GRN_C].a << 8) | inputs[RED_C].a;
+    b = (inputs[BLU_C].b << 16) | (inputs[GRN_C].b << 8) | inputs[RED_C].b;
+    break;
+
+  case TevCompareMode::RGB8:
+  default:
+    a = inputs[i].a;
+    b = inputs[i].b;
+    break;
+  }
+
+  if (cc.comparison == TevComparison::GT)
+    return inputs[i].d + ((a > b) ? inputs[i].c : 0);
+  else
+    return inputs[i].d + ((a == b) ? inputs[i].c : 0);
+}
+
+s16 DrawAlphaRegular(const TevStageCombiner::AlphaCombiner& ac, const InputRegType& InputReg)
+{
+  const u16 c = InputReg.c + (InputReg.c >> 7);
+
+  s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
+  temp <<= s_ScaleLShiftLUT[ac.scale];
+  temp += (ac.scale == TevScale::Divide2) ? 0 : (ac.op == TevOp::Sub) ? 127 : 128;
+  temp = ac.op == TevOp::Sub ? (-temp >> 8) : (temp >> 8);
+
+  s32 result = ((InputReg.d + s_BiasLUT[ac.bias]) << s_ScaleLShiftLUT[ac.scale]) + temp;
+  result = result >> s_ScaleRShiftLUT[ac.scale];
+
+  return result;
+}
+
+s16 DrawAlphaCompare(const TevStageCombiner::AlphaCombiner& ac, const InputRegType inputs[4])
+{
+  u32 a, b;
+  switch (ac.compare_mode)
+  {
+  case TevCompareMode::R8:
+    a = inputs[RED_C].a;
+    b = inputs[RED_C].b;
+    break;
+
+  case TevCompareMode::GR16:
+    a = (inputs[GRN_C].a << 8) | inputs[RED_C].a;
+    b = (inputs[GRN_C].b << 8) | inputs[RED_C].b;
+    break;
+
+  case TevCompareMode::BGR24:
+    a = (inputs[BLU_C].a << 16) | (inputs[GRN_C].a << 8) | inputs[RED_C].a;
+    b = (inputs[BLU_C].b << 16) | (inputs[GRN_C].b << 8) | inputs[RED_C].b;
+    break;
+
+  case TevCompareMode::A8:
+  default:
+    a = inputs[ALP_C].a;
+    b = inputs[ALP_C].b;
+    break;
+  }
+
+  if (ac.comparison == TevComparison::GT)
+    return inputs[ALP_C].d + ((a > b) ? inputs[ALP_C].c : 0);
+  else
+    return inputs[ALP_C].d + ((a == b) ? inputs[ALP_C].c : 0);
+}
+
+std::array<s32, 4> GetCompareWeights(TevCompareMode mode)
+{
+  switch (mode)
+  {
+  case TevCompareMode::R8:
+    return {0, 0, 0, 1};
+  case TevCompareMode::GR16:
+    return {0, 0, 1 << 8, 1};
+  case TevCompareMode::BGR24:
+    return {0, 1 << 16, 1 << 8, 1};
+  default:
+    return {0, 0, 0, 0};
+  }
+}
+}  // namespace
+
+Stage SetupStage(const TevStageCombiner::ColorCombiner& cc,
+                 const TevStageCombiner::AlphaCombiner& ac)
+{
+  Stage stage{};
+  stage.color_hex = cc.hex;
+  stage.alpha_hex = ac.hex;
+
+  // The bias, op, clamp and scale bitfields are in the same place in both combiners.
+  const auto setup_lane = [&stage](int lane, TevBias bias, TevOp op, TevComparison comparison,
+                                   bool clamp, TevScale scale, bool is_alpha) {
+    stage.bias[lane] = s_BiasLUT[bias];
+    stage.scale_multiplier[lane] = 1 << s_ScaleLShiftLUT[scale];
+    stage.round[lane] = scale == TevScale::Divide2 ? 0 : op == TevOp::Sub ? 127 : 128;
+    // The alpha combiner negates before dropping the fraction, the color combiner after.
+    stage.negate_before_shift[lane] = is_alpha && op == TevOp::Sub ? -1 : 0;
+    stage.negate_after_shift[lane] = !is_alpha && op == TevOp::Sub ? -1 : 0;
+    stage.divide_by_2[lane] = s_ScaleRShiftLUT[scale] ? -1 : 0;
+    stage.compare[lane] = bias == TevBias::Compare ? -1 : 0;
+    stage.compare_gt[lane] = comparison == TevComparison::GT ? -1 : 0;
+    stage.clamp_min[lane] = clamp ? 0 : -1024;
+    stage.clamp_max[lane] = clamp ? 255 : 1023;
+  };
+
+  setup_lane(ALP_C, ac.bias, ac.op, ac.comparison, ac.clamp, ac.scale, true);
+  for (int lane = BLU_C; lane <= RED_C; lane++)
+    setup_lane(lane, cc.bias, cc.op, cc.comparison, cc.clamp, cc.scale, false);
+
+  stage.color_compare_weights = GetCompareWeights(cc.compare_mode);
+  stage.alpha_compare_weights = GetCompareWeights(ac.compare_mode);
+  stage.compare_own_channel[ALP_C] = ac.compare_mode == TevCompareMode::A8 ? -1 : 0;
+  for (int lane = BLU_C; lane <= RED_C; lane++)
+    stage.compare_own_channel[lane] = cc.compare_mode == TevCompareMode::RGB8 ? -1 : 0;
+
+  return stage;
+}
+
+std::array<s16, 4> CombineScalar(const Stage& stage, const Inputs& inputs)
+{
+  TevStageCombiner::ColorCombiner cc;
+  cc.hex = stage.color_hex;
+  TevStageCombiner::AlphaCombiner ac;
+  ac.hex = stage.alpha_hex;
+
+  InputRegType regs[4];
+  for (int i = 0; i < 4; i++)
+  {
+    regs[i].a = inputs.a[i];
+    regs[i].b = inputs.b[i];
+    regs[i].c = inputs.c[i];
+    regs[i].d = inputs.d[i];
+  }
+
+  std::array<s16, 4> result;
+  for (int i = BLU_C; i <= RED_C; i++)
+  {
+    const s16 value =
+        cc.bias != TevBias::Compare ? DrawColorRegular(cc, regs[i]) : DrawColorCompare(cc, regs, i);
+    result[i] = cc.clamp ? Clamp255(value) : Clamp1024(value);
+  }
+
+  const s16 alpha =
+      ac.bias != TevBias::Compare ? DrawAlphaRegular(ac, regs[ALP_C]) : DrawAlphaCompare(ac, regs);
+  result[ALP_C] = ac.clamp ? Clamp255(alpha) : Clamp1024(alpha);
+
+  return result;
+}
+
+#ifdef _M_X86_64
+FUNCTION_TARGET_SSE41
+static __m128i LoadLanes(const std::array<s16, 4>& values)
+{
+  return _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values.data())));
+}
+
+FUNCTION_TARGET_SSE41
+static __m128i LoadLanes(const std::array<s32, 4>& values)
+{
+  return _mm_load_si128(reinterpret_cast<const __m128i*>(values.data()));
+}
+
+// Negates the lanes whose mask is all ones.
+FUNCTION_TARGET_SSE41
+static __m128i NegateIf(__m128i values, __m128i mask)
+{
+  return _mm_sub_epi32(_mm_xor_si128(values, mask), mask);
+}
+
+// Returns the sum of all lanes in every lane.
+FUNCTION_TARGET_SSE41
+static __m128i HorizontalSum(__m128i values)
+{
+  const __m128i sum = _mm_add_epi32(values, _mm_shuffle_epi32(values, _MM_SHUFFLE(1, 0, 3, 2)));
+  return _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+// Packs the compared channels of each combiner into one value, and puts the value of the color
+// combiner into the color lanes and the value of the alpha combiner into the alpha lane.
+FUNCTION_TARGET_SSE41
+static __m128i GetCompareValues(const Stage& stage, __m128i channels)
+{
+  const __m128i color =
+      HorizontalSum(_mm_mullo_epi32(channels, LoadLanes(stage.color_compare_weights)));
+  const __m128i alpha =
+      HorizontalSum(_mm_mullo_epi32(channels, LoadLanes(stage.alpha_compare_weights)));
+  const __m128i packed = _mm_blend_epi16(color, alpha, 0x03);
+  return _mm_blendv_epi8(packed, channels, LoadLanes(stage.compare_own_channel));
+}
+
+FUNCTION_TARGET_SSE41
+std::array<s16, 4> CombineSSE41(const Stage& stage, const Inputs& inputs)
+{
+  const __m128i byte_mask = _mm_set1_epi32(0xff);
+  const __m128i a = _mm_and_si128(LoadLanes(inputs.a), byte_mask);
+  const __m128i b = _mm_and_si128(LoadLanes(inputs.b), byte_mask);
+  const __m128i c = _mm_and_si128(LoadLanes(inputs.c), byte_mask);
+  // Sign extend from 11 bits
+  const __m128i d = _mm_srai_epi32(_mm_slli_epi32(LoadLanes(inputs.d), 21), 21);
+
+  // Regular combiner: (d + bias + lerp(a, b, c)) * scale
+  const __m128i scale = LoadLanes(stage.scale_multiplier);
+  const __m128i c_adjusted = _mm_add_epi32(c, _mm_srli_epi32(c, 7));
+  __m128i lerp = _mm_add_epi32(_mm_mullo_epi32(a, _mm_sub_epi32(_mm_set1_epi32(256), c_adjusted)),
+                               _mm_mullo_epi32(b, c_adjusted));
+  lerp = _mm_add_epi32(_mm_mullo_epi32(lerp, scale), LoadLanes(stage.round));
+  lerp = NegateIf(lerp, LoadLanes(stage.negate_before_shift));
+  lerp = _mm_srai_epi32(lerp, 8);
+  lerp = NegateIf(lerp, LoadLanes(stage.negate_after_shift));
+
+  __m128i regular =
+      _mm_add_epi32(_mm_mullo_epi32(_mm_add_epi32(d, LoadLanes(stage.bias)), scale), lerp);
+  regular = _mm_blendv_epi8(regular, _mm_srai_epi32(regular, 1), LoadLanes(stage.divide_by_2));
+
+  // Compare combiner: d + (a > b or a == b ? c : 0)
+  const __m128i compare_a = GetCompareValues(stage, a);
+  const __m128i compare_b = GetCompareValues(stage, b);
+  const __m128i passed = _mm_blendv_epi8(_mm_cmpeq_epi32(compare_a, compare_b),
+                                         _mm_cmpgt_epi32(compare_a, compare_b),
+                                         LoadLanes(stage.compare_gt));
+  const __m128i compared = _mm_add_epi32(d, _mm_and_si128(passed, c));
+
+  __m128i result = _mm_blendv_epi8(regular, compared, LoadLanes(stage.compare));
+  result = _mm_max_epi32(result, LoadLanes(stage.clamp_min));
+  result = _mm_min_epi32(result, LoadLanes(stage.clamp_max));
+
+  std::array<s16, 4> output;
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(output.data()), _mm_packs_epi32(result, result));
+  return output;
+}
+#endif
+
+std::array<s16, 4> Combine(const Stage& stage, const Inputs& inputs)
+{
+#ifdef _M_X86_64
+  if (cpu_info.bSSE4_1)
+    return CombineSSE41(stage, inputs);
+#endif
+  return CombineScalar(stage, inputs);
+}
+}  // namespace TevCombiner
@@ -0,0 +1,69 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/BPMemory.h"
+
+// The arithmetic of a TEV stage: the color and alpha combiners applied to the inputs selected for
+// one pixel. All values are in the ABGR order of the Tev's color registers, so the color combiner
+// works on the blue, green and red lanes and the alpha combiner on the alpha lane.
+namespace TevCombiner
+{
+enum
+{
+  ALP_C,
+  BLU_C,
+  GRN_C,
+  RED_C
+};
+
+struct Inputs
+{
+  // Like on hardware, only the low 8 bits of a, b and c and the low 11 bits of d are used.
+  std::array<s16, 4> a;
+  std::array<s16, 4> b;
+  std::array<s16, 4> c;
+  std::array<s16, 4> d;
+};
+
+// The combiner configuration of a stage, expanded into per-lane constants so that combining needs
+// no branches. Set up once per batch, as the configuration cannot change within one.
+struct Stage
+{
+  // For the scalar implementation
+  u32 color_hex;
+  u32 alpha_hex;
+
+  alignas(16) std::array<s32, 4> bias;
+  alignas(16) std::array<s32, 4> scale_multiplier;
+  alignas(16) std::array<s32, 4> round;
+  alignas(16) std::array<s32, 4> negate_before_shift;
+  alignas(16) std::array<s32, 4> negate_after_shift;
+  alignas(16) std::array<s32, 4> divide_by_2;
+  alignas(16) std::array<s32, 4> compare;
+  alignas(16) std::array<s32, 4> compare_gt;
+  // Weights which pack the compared channels into a single value, separately for the lanes of the
+  // color combiner and the alpha combiner. Lanes which compare their own channel have none.
+  alignas(16) std::array<s32, 4> color_compare_weights;
+  alignas(16) std::array<s32, 4> alpha_compare_weights;
+  alignas(16) std::array<s32, 4> compare_own_channel;
+  alignas(16) std::array<s32, 4> clamp_min;
+  alignas(16) std::array<s32, 4> clamp_max;
+};
+
+Stage SetupStage(const TevStageCombiner::ColorCombiner& cc,
+                 const TevStageCombiner::AlphaCombiner& ac);
+
+// Returns the results of the stage, clamped to the range of the destination registers.
+std::array<s16, 4> Combine(const Stage& stage, const Inputs& inputs);
+
+// Reference implementation, one lane at a time.
+std::array<s16, 4> CombineScalar(const Stage& stage, const Inputs& inputs);
+#ifdef _M_X86_64
+std::array<s16, 4> CombineSSE41(const Stage& stage, const Inputs& inputs);
+#endif
+}  // namespace TevCombiner
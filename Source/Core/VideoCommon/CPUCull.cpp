@@ -3,6 +3,8 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <chrono>
+
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
@@ -10,8 +12,10 @@
 #include "Core/System.h"
 
 #include "VideoCommon/CPMemory.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
 // We really want things like c.w * a.x - a.w * c.x to stay symmetric, so they cancel to zero on
@@ -96,15 +100,15 @@ static CPUCull::CullFunction GetCullFunction0()
   // Note: AVX version only actually AVX on compilers that support __attribute__((target))
   // Sorry, MSVC + Sandy Bridge.  (Ivy+ and AMD see very little benefit thanks to mov elimination)
   if (MIN_SSE >= 50 || cpu_info.bAVX)
-    return CPUCull_AVX::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_AVX::GetVisibleTriangles<Primitive, Mode>;
   else if (MIN_SSE >= 30 || cpu_info.bSSE3)
-    return CPUCull_SSE3::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_SSE3::GetVisibleTriangles<Primitive, Mode>;
   else
-    return CPUCull_SSE::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_SSE::GetVisibleTriangles<Primitive, Mode>;
 #elif defined(USE_NEON)
-  return CPUCull_NEON::AreAllVerticesCulled<Primitive, Mode>;
+  return CPUCull_NEON::GetVisibleTriangles<Primitive, Mode>;
 #else
-  return CPUCull_Scalar::AreAllVerticesCulled<Primitive, Mode>;
+  return CPUCull_Scalar::GetVisibleTriangles<Primitive, Mode>;
 #endif
 }
 
@@ -119,6 +123,20 @@ static Common::EnumMap<CPUCull::CullFunction, CullMode::All> GetCullFunction1()
   };
 }
 
+static u32 GetNumTriangles(OpcodeDecoder::Primitive primitive, u32 count)
+{
+  switch (primitive)
+  {
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
+    return count / 4 * 2 + (count % 4 == 3);
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
+    return count / 3;
+  default:
+    return count < 2 ? 0 : count - 2;
+  }
+}
+
 CPUCull::~CPUCull() = default;
 
 void CPUCull::Init()
@@ -135,11 +153,15 @@ void CPUCull::Init()
   m_cull_table[Prim::GX_DRAW_TRIANGLE_FAN] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
 }
 
-bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                                   const u8* src, u32 count)
+u32 CPUCull::CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                           const u8* src, u32 count)
 {
   ASSERT_MSG(VIDEO, primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES,
              "CPUCull should not be called on lines or points");
+  using Clock = std::chrono::steady_clock;
+  const bool measure_time = g_ActiveConfig.bOverlayStats;
+  const Clock::time_point start_time = measure_time ? Clock::now() : Clock::time_point();
+
   const u32 stride = loader->m_native_vtx_decl.stride;
   const bool posHas3Elems = loader->m_native_vtx_decl.position.components >= 3;
   const bool perVertexPosMtx = loader->m_native_vtx_decl.posmtx.enable;
@@ -150,6 +172,9 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
     m_transform_buffer.reset(static_cast<TransformedVertex*>(
         Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 32)));
   }
+  // Strips and fans have the most triangles per vertex
+  if (m_visible_triangles.size() < count * 3) [[unlikely]]
+    m_visible_triangles.resize(MathUtil::NextPowerOf2(count) * 3);
 
   // transform functions need the projection matrix to transform to clip space
   auto& system = Core::System::GetInstance();
@@ -164,7 +189,18 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
   transform(m_transform_buffer.get(), src, stride, count);
   const CullFunction cull = m_cull_table[primitive][cull_mode];
-  return cull(m_transform_buffer.get(), count);
+  const u16* end = cull(m_transform_buffer.get(), count, m_visible_triangles.data());
+  m_num_visible_indices = static_cast<u32>(end - m_visible_triangles.data());
+
+  const u32 num_culled = GetNumTriangles(primitive, count) - m_num_visible_indices / 3;
+  ADDSTAT(g_stats.this_frame.num_triangles_cpu_culled, num_culled);
+  if (measure_time)
+  {
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_time);
+    ADDSTAT(g_stats.this_frame.cpu_cull_time_ns, static_cast<u64>(elapsed.count()));
+  }
+  return num_culled;
 }
 
 template <typename T>
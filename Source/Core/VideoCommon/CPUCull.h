@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -12,8 +15,16 @@ class CPUCull
 public:
   ~CPUCull();
   void Init();
-  bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                            const u8* src, u32 count);
+  // Culls the triangles of the primitive which are offscreen or backfacing, and returns how many
+  // were culled. The remaining ones are returned by GetVisibleTriangles.
+  u32 CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive, const u8* src,
+                    u32 count);
+  // Three vertex indices per triangle, relative to the first vertex of the primitive, in the same
+  // order as IndexGenerator would write them.
+  std::span<const u16> GetVisibleTriangles() const
+  {
+    return {m_visible_triangles.data(), m_num_visible_indices};
+  }
 
   struct alignas(16) TransformedVertex
   {
@@ -21,7 +32,7 @@ public:
   };
 
   using TransformFunction = void (*)(void*, const void*, u32, int);
-  using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
+  using CullFunction = u16* (*)(const CPUCull::TransformedVertex*, int, u16*);
 
 private:
   template <typename T>
@@ -31,6 +42,8 @@ private:
   };
   std::unique_ptr<TransformedVertex[], BufferDeleter<TransformedVertex>> m_transform_buffer{};
   u32 m_transform_buffer_size = 0;
+  std::vector<u16> m_visible_triangles;
+  u32 m_num_visible_indices = 0;
   std::array<std::array<TransformFunction, 2>, 2> m_transform_table{};
   Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
                   OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
@@ -653,10 +653,24 @@ ATTR_TARGET DOLPHIN_FORCE_INLINE static bool CullTriangle(const CPUCull::Transfo
   return cull;
 }
 
+template <CullMode Mode>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static u16* AddTriangleIfVisible(
+    const CPUCull::TransformedVertex* transformed, u16* indices, int a, int b, int c)
+{
+  if (!CullTriangle<Mode>(transformed[a], transformed[b], transformed[c]))
+  {
+    *indices++ = a;
+    *indices++ = b;
+    *indices++ = c;
+  }
+  return indices;
+}
+
 template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
-ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* transformed,
-                                             int count)
+ATTR_TARGET static u16* GetVisibleTriangles(const CPUCull::TransformedVertex* transformed,
+                                            int count, u16* indices)
 {
+  // Triangles are visited in the same order and with the same winding as in IndexGenerator
   switch (Primitive)
   {
   case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
@@ -665,47 +679,35 @@ ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* t
     int i = 3;
     for (; i < count; i += 4)
     {
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 2], transformed[i - 1]))
-        return false;
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 1], transformed[i - 0]))
-        return false;
+      indices = AddTriangleIfVisible<Mode>(transformed, indices, i - 3, i - 2, i - 1);
+      indices = AddTriangleIfVisible<Mode>(transformed, indices, i - 3, i - 1, i - 0);
     }
     // three vertices remaining, so render a triangle
     if (i == count)
-    {
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 2], transformed[i - 1]))
-        return false;
-    }
+      indices = AddTriangleIfVisible<Mode>(transformed, indices, i - 3, i - 2, i - 1);
     break;
   }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
     for (int i = 2; i < count; i += 3)
-    {
-      if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - 1], transformed[i - 0]))
-        return false;
-    }
+      indices = AddTriangleIfVisible<Mode>(transformed, indices, i - 2, i - 1, i - 0);
     break;
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
   {
     bool wind = false;
     for (int i = 2; i < count; ++i)
     {
-      if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - !wind], transformed[i - wind]))
-        return false;
+      indices = AddTriangleIfVisible<Mode>(transformed, indices, i - 2, i - !wind, i - wind);
       wind = !wind;
     }
     break;
   }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
     for (int i = 2; i < count; ++i)
-    {
-      if (!CullTriangle<Mode>(transformed[0], transformed[i - 1], transformed[i]))
-        return false;
-    }
+      indices = AddTriangleIfVisible<Mode>(transformed, indices, 0, i - 1, i);
     break;
   }
 
-  return true;
+  return indices;
 }
 
 }  // namespace VECTOR_NAMESPACE
@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
 #include "VideoCommon/GeometryShaderGen.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/PixelShaderGen.h"
@@ -90,4 +94,16 @@ struct SerializedGXUberPipelineUid
 };
 #pragma pack(pop)
 
+// Hashes all bytes of a pipeline UID. Like comparing UIDs with memcmp(), this relies on the padding
+// bytes being zeroed out.
+template <typename UidType>
+struct PipelineUidHash
+{
+  size_t operator()(const UidType& uid) const
+  {
+    return static_cast<size_t>(
+        Common::GetXXH3Hash64(reinterpret_cast<const u8*>(&uid), sizeof(uid)));
+  }
+};
+
 }  // namespace VideoCommon
@@ -35,6 +35,17 @@ u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
   return index_ptr;
 }
 
+template <bool pr>
+u16* AddTriangleList(u16* index_ptr, const u16* indices, u32 num_indices, u32 index)
+{
+  for (u32 i = 2; i < num_indices; i += 3)
+  {
+    index_ptr = WriteTriangle<pr>(index_ptr, index + indices[i - 2], index + indices[i - 1],
+                                  index + indices[i]);
+  }
+  return index_ptr;
+}
+
 template <bool pr>
 u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
@@ -264,8 +275,10 @@ void IndexGenerator::Init()
 {
   using OpcodeDecoder::Primitive;
 
+  m_primitive_restart = g_backend_info.bSupportsPrimitiveRestart;
   if (g_backend_info.bSupportsPrimitiveRestart)
   {
+    m_triangle_function = AddTriangleList<true>;
     m_primitive_table[Primitive::GX_DRAW_QUADS] = AddQuads<true>;
     m_primitive_table[Primitive::GX_DRAW_QUADS_2] = AddQuads_nonstandard<true>;
     m_primitive_table[Primitive::GX_DRAW_TRIANGLES] = AddList<true>;
@@ -274,6 +287,7 @@ void IndexGenerator::Init()
   }
   else
   {
+    m_triangle_function = AddTriangleList<false>;
     m_primitive_table[Primitive::GX_DRAW_QUADS] = AddQuads<false>;
     m_primitive_table[Primitive::GX_DRAW_QUADS_2] = AddQuads_nonstandard<false>;
     m_primitive_table[Primitive::GX_DRAW_TRIANGLES] = AddList<false>;
@@ -324,6 +338,18 @@ void IndexGenerator::AddExternalIndices(const u16* indices, u32 num_indices, u32
   m_base_index += num_vertices;
 }
 
+void IndexGenerator::AddTriangles(const u16* indices, u32 num_indices, u32 num_vertices)
+{
+  m_index_buffer_current =
+      m_triangle_function(m_index_buffer_current, indices, num_indices, m_base_index);
+  m_base_index += num_vertices;
+}
+
+u32 IndexGenerator::GetTriangleIndexLen(u32 num_triangles) const
+{
+  return num_triangles * (m_primitive_restart ? 4 : 3);
+}
+
 u32 IndexGenerator::GetRemainingIndices(OpcodeDecoder::Primitive primitive) const
 {
   u32 max_index = UINT16_MAX;
@@ -20,6 +20,11 @@ public:
 
   void AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices);
 
+  // Adds a list of triangles, given by three vertex indices each relative to the first vertex.
+  void AddTriangles(const u16* indices, u32 num_indices, u32 num_vertices);
+  // The number of indices AddTriangles needs for num_triangles triangles
+  u32 GetTriangleIndexLen(u32 num_triangles) const;
+
   // returns numprimitives
   u32 GetNumVerts() const { return m_base_index; }
   u32 GetIndexLen() const { return static_cast<u32>(m_index_buffer_current - m_base_index_ptr); }
@@ -32,4 +37,7 @@ private:
 
   using PrimitiveFunction = u16* (*)(u16*, u32, u32);
   Common::EnumMap<PrimitiveFunction, OpcodeDecoder::Primitive::GX_DRAW_POINTS> m_primitive_table{};
+  using TriangleFunction = u16* (*)(u16*, const u16*, u32, u32);
+  TriangleFunction m_triangle_function = nullptr;
+  bool m_primitive_restart = false;
 };
@@ -259,6 +259,8 @@ public:
 template <bool is_preprocess>
 u8* RunFifo(DataReader src, u32* cycles)
 {
+  ScopedStageTimer timer(is_preprocess ? nullptr : &g_stats.stage_times.fifo_ns);
+
   using CallbackT = RunCallback<is_preprocess>;
   auto callback = CallbackT{};
   u32 size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
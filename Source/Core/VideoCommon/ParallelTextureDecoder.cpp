@@ -0,0 +1,137 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/ParallelTextureDecoder.h"
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include "Common/Thread.h"
+
+namespace
+{
+// Textures with fewer texels than this are decoded right away. This is about the size where
+// handing the work to another thread starts to pay off.
+constexpr int MIN_TEXELS_FOR_WORKERS = 256 * 256;
+// How many texels each job decodes, roughly. Small enough that the work is spread evenly, large
+// enough that taking a job is cheap compared to doing it.
+constexpr int TEXELS_PER_JOB = 32 * 1024;
+}  // namespace
+
+ParallelTextureDecoder::ParallelTextureDecoder() = default;
+
+ParallelTextureDecoder::~ParallelTextureDecoder()
+{
+  StopWorkers();
+}
+
+void ParallelTextureDecoder::SetNumWorkers(u32 num_workers)
+{
+  if (num_workers == m_workers.size())
+    return;
+
+  StopWorkers();
+  StartWorkers(num_workers);
+}
+
+void ParallelTextureDecoder::StartWorkers(u32 num_workers)
+{
+  m_exit = false;
+  for (u32 i = 0; i < num_workers; ++i)
+    m_workers.emplace_back(&ParallelTextureDecoder::WorkerThread, this, i);
+}
+
+void ParallelTextureDecoder::StopWorkers()
+{
+  Wait();
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_exit = true;
+  }
+  m_work_cv.notify_all();
+
+  for (std::thread& worker : m_workers)
+    worker.join();
+  m_workers.clear();
+}
+
+void ParallelTextureDecoder::Decode(u8* dst, const u8* src, int width, int height,
+                                    TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  if (m_workers.empty() || width * height < MIN_TEXELS_FOR_WORKERS ||
+      height % TexDecoder_GetBlockHeightInTexels(texformat) != 0)
+  {
+    TexDecoder_Decode(dst, src, width, height, texformat, tlut, tlutfmt);
+    return;
+  }
+
+  // The jobs are only created once every texture is known, as they point into m_textures.
+  m_textures.push_back({dst, src, width, height, texformat, tlut, tlutfmt});
+}
+
+void ParallelTextureDecoder::Wait()
+{
+  std::unique_lock lk(m_mutex);
+  if (m_textures.empty())
+    return;
+
+  // Split each texture into strips of whole blocks
+  for (const Texture& texture : m_textures)
+  {
+    const int block_height = TexDecoder_GetBlockHeightInTexels(texture.texformat);
+    const int rows_per_job =
+        std::max(TEXELS_PER_JOB / texture.width / block_height, 1) * block_height;
+    for (int row = 0; row < texture.height; row += rows_per_job)
+      m_jobs.push_back({&texture, row, std::min(rows_per_job, texture.height - row)});
+  }
+  m_unfinished_jobs = m_jobs.size();
+  m_work_cv.notify_all();
+
+  while (RunJob(lk))
+  {
+  }
+  m_done_cv.wait(lk, [this] { return m_unfinished_jobs == 0; });
+
+  // The overlay goes over the whole texture, so it is only drawn once every strip is done.
+  for (const Texture& texture : m_textures)
+    TexDecoder_DrawOverlay(texture.dst, texture.width, texture.height, texture.texformat);
+
+  m_textures.clear();
+  m_jobs.clear();
+  m_next_job = 0;
+}
+
+bool ParallelTextureDecoder::RunJob(std::unique_lock<std::mutex>& lock)
+{
+  if (m_next_job == m_jobs.size())
+    return false;
+
+  const Job& job = m_jobs[m_next_job++];
+  const Texture& texture = *job.texture;
+
+  lock.unlock();
+  TexDecoder_DecodeRows(texture.dst, texture.src, texture.width, job.first_row, job.num_rows,
+                        texture.texformat, texture.tlut, texture.tlutfmt);
+  lock.lock();
+
+  if (--m_unfinished_jobs == 0)
+    m_done_cv.notify_one();
+  return true;
+}
+
+void ParallelTextureDecoder::WorkerThread(u32 index)
+{
+  Common::SetCurrentThreadName(fmt::format("Texture Decoder {}", index).c_str());
+
+  std::unique_lock lk(m_mutex);
+  while (true)
+  {
+    m_work_cv.wait(lk, [this] { return m_exit || m_next_job != m_jobs.size(); });
+    if (m_exit)
+      return;
+
+    RunJob(lk);
+  }
+}
@@ -0,0 +1,76 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+// Decodes textures like TexDecoder_Decode, but splits large ones into strips of block rows which
+// are decoded by a pool of worker threads. Small textures are decoded right away, since waking up
+// the workers would take longer. Queueing every level of a texture before waiting also lets the
+// small mip levels be decoded while the workers are busy with the large ones.
+//
+// Only to be used from one thread, which helps the workers while it waits for them.
+class ParallelTextureDecoder
+{
+public:
+  ParallelTextureDecoder();
+  ~ParallelTextureDecoder();
+
+  ParallelTextureDecoder(const ParallelTextureDecoder&) = delete;
+  ParallelTextureDecoder& operator=(const ParallelTextureDecoder&) = delete;
+
+  // With no workers, every texture is decoded right away.
+  void SetNumWorkers(u32 num_workers);
+  u32 GetNumWorkers() const { return static_cast<u32>(m_workers.size()); }
+
+  // Decodes the texture before Wait returns. dst, src and tlut have to stay valid until then.
+  void Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
+              const u8* tlut, TLUTFormat tlutfmt);
+  // Waits for every texture passed to Decode to be decoded.
+  void Wait();
+
+private:
+  struct Texture
+  {
+    u8* dst;
+    const u8* src;
+    int width;
+    int height;
+    TextureFormat texformat;
+    const u8* tlut;
+    TLUTFormat tlutfmt;
+  };
+
+  struct Job
+  {
+    const Texture* texture;
+    int first_row;
+    int num_rows;
+  };
+
+  void StartWorkers(u32 num_workers);
+  void StopWorkers();
+  void WorkerThread(u32 index);
+  // Runs the next job, if there is one. The mutex has to be locked, and is unlocked while the job
+  // is running.
+  bool RunJob(std::unique_lock<std::mutex>& lock);
+
+  std::vector<std::thread> m_workers;
+  std::mutex m_mutex;
+  std::condition_variable m_work_cv;
+  std::condition_variable m_done_cv;
+  bool m_exit = false;
+
+  // Only changed by the thread using the decoder, while no jobs are queued or running
+  std::vector<Texture> m_textures;
+  std::vector<Job> m_jobs;
+  size_t m_next_job = 0;
+  size_t m_unfinished_jobs = 0;
+};
@@ -0,0 +1,79 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/PipelineUIDDatabase.h"
+
+#include <cstring>
+
+#include <fmt/format.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace VideoCommon
+{
+bool PipelineUIDDatabase::UIDEqual::operator()(const SerializedGXPipelineUid& a,
+                                               const SerializedGXPipelineUid& b) const
+{
+  return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+bool PipelineUIDDatabase::Load(const std::string& path)
+{
+  File::IOFile file(path, "rb");
+  if (!file)
+    return false;
+
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      magic != FILE_MAGIC || version != GX_PIPELINE_UID_VERSION)
+  {
+    WARN_LOG_FMT(VIDEO, "Pipeline UID file {} is not of the current version", path);
+    return false;
+  }
+
+  // A file with a partial entry at the end was cut off while being written, so it can't be
+  // trusted to contain valid UIDs.
+  const u64 data_size = file.GetSize() - HEADER_SIZE;
+  if (data_size % sizeof(SerializedGXPipelineUid) != 0)
+  {
+    WARN_LOG_FMT(VIDEO, "Pipeline UID file {} is truncated", path);
+    return false;
+  }
+
+  std::vector<SerializedGXPipelineUid> uids(data_size / sizeof(SerializedGXPipelineUid));
+  if (!file.ReadArray(uids.data(), uids.size()))
+    return false;
+
+  for (const SerializedGXPipelineUid& uid : uids)
+    Add(uid);
+  return true;
+}
+
+bool PipelineUIDDatabase::Save(const std::string& path) const
+{
+  File::IOFile file(path, "wb");
+  return file && file.WriteBytes(&FILE_MAGIC, sizeof(FILE_MAGIC)) &&
+         file.WriteBytes(&GX_PIPELINE_UID_VERSION, sizeof(GX_PIPELINE_UID_VERSION)) &&
+         file.WriteArray(m_uids.data(), m_uids.size());
+}
+
+bool PipelineUIDDatabase::Add(const SerializedGXPipelineUid& uid)
+{
+  if (!m_known_uids.insert(uid).second)
+    return false;
+
+  m_uids.push_back(uid);
+  return true;
+}
+
+std::vector<std::string> PipelineUIDDatabase::GetPathsForGame(std::string_view game_id)
+{
+  const std::string filename = fmt::format("{}{}.uidcache", PIPELINE_UIDS_DIR DIR_SEP, game_id);
+  return {File::GetSysDirectory() + LOAD_DIR DIR_SEP + filename,
+          File::GetUserPath(D_LOAD_IDX) + filename};
+}
+}  // namespace VideoCommon
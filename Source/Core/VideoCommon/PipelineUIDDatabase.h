@@ -0,0 +1,53 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/GXPipelineTypes.h"
+
+namespace VideoCommon
+{
+// A set of pipeline UIDs in the format of the per-game .uidcache files: a magic number and
+// GX_PIPELINE_UID_VERSION, followed by SerializedGXPipelineUid entries. Nothing in the UIDs depends
+// on the host or the video backend, so databases recorded on different machines can be merged, and
+// a database shipped for a game lets its pipelines be compiled before they are first used.
+class PipelineUIDDatabase
+{
+public:
+  static constexpr u32 FILE_MAGIC = 0x44495550;  // PUID
+  static constexpr size_t HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+  // Adds the UIDs of a file which aren't in the database yet. Returns false if the file can't be
+  // read, or has the wrong magic or version, in which case the database is left unchanged.
+  bool Load(const std::string& path);
+  bool Save(const std::string& path) const;
+
+  // Returns false if the UID was already in the database.
+  bool Add(const SerializedGXPipelineUid& uid);
+
+  // In the order they were added.
+  const std::vector<SerializedGXPipelineUid>& GetUIDs() const { return m_uids; }
+  size_t GetSize() const { return m_uids.size(); }
+
+  // The databases which are loaded for a game, from Sys/Load/PipelineUIDs and
+  // User/Load/PipelineUIDs.
+  static std::vector<std::string> GetPathsForGame(std::string_view game_id);
+
+private:
+  struct UIDEqual
+  {
+    bool operator()(const SerializedGXPipelineUid& a, const SerializedGXPipelineUid& b) const;
+  };
+
+  std::vector<SerializedGXPipelineUid> m_uids;
+  std::unordered_set<SerializedGXPipelineUid, PipelineUidHash<SerializedGXPipelineUid>, UIDEqual>
+      m_known_uids;
+};
+}  // namespace VideoCommon
@@ -17,6 +17,7 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/PipelineUIDDatabase.h"
 #include "VideoCommon/PipelineUtils.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Statistics.h"
@@ -128,12 +129,16 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
+  bool from_disk_cache = false;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
-    pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  {
+    pipeline =
+        CreateGXPipeline(uid, *pipeline_config, m_gx_pipeline_disk_cache, &from_disk_cache);
+  }
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
-  return InsertGXPipeline(uid, std::move(pipeline));
+  return InsertGXPipeline(uid, std::move(pipeline), from_disk_cache);
 }
 
 std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
@@ -160,10 +165,14 @@ const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineU
     return it->second.first.get();
 
   std::unique_ptr<AbstractPipeline> pipeline;
+  bool from_disk_cache = false;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
-    pipeline = g_gfx->CreatePipeline(*pipeline_config);
-  return InsertGXUberPipeline(uid, std::move(pipeline));
+  {
+    pipeline =
+        CreateGXPipeline(uid, *pipeline_config, m_gx_uber_pipeline_disk_cache, &from_disk_cache);
+  }
+  return InsertGXUberPipeline(uid, std::move(pipeline), from_disk_cache);
 }
 
 void ShaderCache::WaitForAsyncCompiler()
@@ -281,64 +290,44 @@ void ShaderCache::ClearShaderCache(T& cache)
   cache.shader_map.clear();
 }
 
-template <typename KeyType, typename DiskKeyType, typename T>
-void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyType, u8>& disk_cache,
+template <typename DiskKeyType>
+void ShaderCache::LoadPipelineCache(Common::IndexedDiskCache<DiskKeyType, u8>& disk_cache,
                                     APIType api_type, const char* type, bool include_gameid)
 {
-  class CacheReader : public Common::LinearDiskCacheReader<DiskKeyType, u8>
+  // Only the index is read here. Pipelines are created from the cached data when they are
+  // compiled, which happens on the compiler threads.
+  std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
+  const u32 count = disk_cache.Open(filename);
+  INFO_LOG_FMT(VIDEO, "Indexed {} cached pipelines in {}", count, filename);
+}
+
+template <typename UidType, typename DiskKeyType>
+std::unique_ptr<AbstractPipeline>
+ShaderCache::CreateGXPipeline(const UidType& uid, const AbstractPipelineConfig& config,
+                              Common::IndexedDiskCache<DiskKeyType, u8>& disk_cache,
+                              bool* from_disk_cache)
+{
+  *from_disk_cache = false;
+  if (disk_cache.IsOpen())
   {
-  public:
-    CacheReader(ShaderCache* this_ptr_, T& cache_) : this_ptr(this_ptr_), cache(cache_) {}
-    bool AnyFailed() const { return failed; }
-    void Read(const DiskKeyType& key, const u8* value, u32 value_size) override
+    DiskKeyType disk_uid;
+    SerializePipelineUid(uid, disk_uid);
+    if (const std::optional<std::span<const u8>> cache_data = disk_cache.Lookup(disk_uid))
     {
-      KeyType real_uid;
-      UnserializePipelineUid(key, real_uid);
-
-      // Skip those which are already compiled.
-      if (failed || cache.contains(real_uid))
-        return;
-
-      auto config = this_ptr->GetGXPipelineConfig(real_uid);
-      if (!config)
-        return;
-
-      auto pipeline = g_gfx->CreatePipeline(*config, value, value_size);
-      if (!pipeline)
+      auto pipeline = g_gfx->CreatePipeline(config, cache_data->data(), cache_data->size());
+      if (pipeline)
       {
-        // If any of the pipelines fail to create, consider the cache stale.
-        failed = true;
-        return;
+        *from_disk_cache = true;
+        return pipeline;
       }
 
-      auto& entry = cache[real_uid];
-      entry.first = std::move(pipeline);
-      entry.second = false;
+      // The data is likely from a different driver version or system configuration. The data of
+      // the pipeline compiled below replaces it.
+      WARN_LOG_FMT(VIDEO, "Failed to create pipeline from cached data, compiling it again.");
     }
-
-  private:
-    ShaderCache* this_ptr;
-    T& cache;
-    bool failed = false;
-  };
-
-  std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
-  CacheReader reader(this, cache);
-  const u32 count = disk_cache.OpenAndRead(filename, reader);
-  INFO_LOG_FMT(VIDEO, "Loaded {} cached pipelines from {}", count, filename);
-
-  // If any of the pipelines in the cache failed to create, it's likely because of a change of
-  // driver version, or system configuration. In this case, when the UID cache picks up the pipeline
-  // later on, we'll write a duplicate entry to the pipeline cache. There's also no point in keeping
-  // the old cache data around, so discard and recreate the disk cache.
-  if (reader.AnyFailed())
-  {
-    WARN_LOG_FMT(VIDEO, "Failed to load one or more pipelines from cache '{}'. Discarding.",
-                 filename);
-    disk_cache.Close();
-    File::Delete(filename);
-    disk_cache.OpenAndRead(filename, reader);
   }
+
+  return g_gfx->CreatePipeline(config);
 }
 
 template <typename T, typename Y>
@@ -379,11 +368,8 @@ void ShaderCache::LoadCaches()
 
   if (g_backend_info.bSupportsPipelineCacheData)
   {
-    LoadPipelineCache<GXPipelineUid, SerializedGXPipelineUid>(
-        m_gx_pipeline_cache, m_gx_pipeline_disk_cache, m_api_type, "specialized-pipeline", true);
-    LoadPipelineCache<GXUberPipelineUid, SerializedGXUberPipelineUid>(
-        m_gx_uber_pipeline_cache, m_gx_uber_pipeline_disk_cache, m_api_type, "uber-pipeline",
-        false);
+    LoadPipelineCache(m_gx_pipeline_disk_cache, m_api_type, "specialized-pipeline", true);
+    LoadPipelineCache(m_gx_uber_pipeline_disk_cache, m_api_type, "uber-pipeline", false);
   }
 }
 
@@ -742,7 +728,8 @@ ShaderCache::GetGXPipelineConfig(const GXUberPipelineUid& config_in)
 }
 
 const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& config,
-                                                      std::unique_ptr<AbstractPipeline> pipeline)
+                                                      std::unique_ptr<AbstractPipeline> pipeline,
+                                                      bool from_disk_cache)
 {
   auto& entry = m_gx_pipeline_cache[config];
   entry.second = false;
@@ -750,7 +737,7 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
   {
     entry.first = std::move(pipeline);
 
-    if (g_ActiveConfig.bShaderCache)
+    if (g_ActiveConfig.bShaderCache && !from_disk_cache)
     {
       auto cache_data = entry.first->GetCacheData();
       if (!cache_data.empty())
@@ -768,7 +755,8 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
 
 const AbstractPipeline*
 ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
-                                  std::unique_ptr<AbstractPipeline> pipeline)
+                                  std::unique_ptr<AbstractPipeline> pipeline,
+                                  bool from_disk_cache)
 {
   auto& entry = m_gx_uber_pipeline_cache[config];
   entry.second = false;
@@ -776,7 +764,7 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
   {
     entry.first = std::move(pipeline);
 
-    if (g_ActiveConfig.bShaderCache)
+    if (g_ActiveConfig.bShaderCache && !from_disk_cache)
     {
       auto cache_data = entry.first->GetCacheData();
       if (!cache_data.empty())
@@ -794,10 +782,10 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
 
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
-  std::string filename =
-      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  constexpr u32 CACHE_FILE_MAGIC = PipelineUIDDatabase::FILE_MAGIC;
+  constexpr size_t CACHE_HEADER_SIZE = PipelineUIDDatabase::HEADER_SIZE;
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  std::string filename = File::GetUserPath(D_CACHE_IDX) + game_id + ".uidcache";
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
     // If an existing case exists, validate the version before reading entries.
@@ -863,6 +851,25 @@ void ShaderCache::LoadPipelineUIDCache()
   }
 
   INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
+
+  // Pipeline UID databases for the game, e.g. merged from the UID caches of other machines, also
+  // cover pipelines which haven't been used on this one yet. These are compiled along with the
+  // UIDs of the local cache, but not written to it.
+  PipelineUIDDatabase database;
+  for (const std::string& path : PipelineUIDDatabase::GetPathsForGame(game_id))
+  {
+    if (database.Load(path))
+      INFO_LOG_FMT(VIDEO, "Loaded pipeline UID database {}", path);
+  }
+
+  const size_t local_uid_count = m_gx_pipeline_cache.size();
+  for (const SerializedGXPipelineUid& uid : database.GetUIDs())
+    AddSerializedGXPipelineUID(uid);
+  if (!database.GetUIDs().empty())
+  {
+    INFO_LOG_FMT(VIDEO, "Added {} pipeline UIDs from databases",
+                 m_gx_pipeline_cache.size() - local_uid_count);
+  }
 }
 
 void ShaderCache::ClosePipelineUIDCache()
@@ -1054,7 +1061,10 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     bool Compile() override
     {
       if (config)
-        pipeline = g_gfx->CreatePipeline(*config);
+      {
+        pipeline = shader_cache->CreateGXPipeline(
+            uid, *config, shader_cache->m_gx_pipeline_disk_cache, &from_disk_cache);
+      }
       return true;
     }
 
@@ -1062,7 +1072,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     {
       if (stages_ready)
       {
-        shader_cache->InsertGXPipeline(uid, std::move(pipeline));
+        shader_cache->InsertGXPipeline(uid, std::move(pipeline), from_disk_cache);
       }
       else
       {
@@ -1080,6 +1090,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     u32 priority;
     std::optional<AbstractPipelineConfig> config;
     bool stages_ready;
+    bool from_disk_cache = false;
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(this, uid, priority);
@@ -1129,7 +1140,10 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
     bool Compile() override
     {
       if (config)
-        UberPipeline = g_gfx->CreatePipeline(*config);
+      {
+        UberPipeline = shader_cache->CreateGXPipeline(
+            uid, *config, shader_cache->m_gx_uber_pipeline_disk_cache, &from_disk_cache);
+      }
       return true;
     }
 
@@ -1137,7 +1151,7 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
     {
       if (stages_ready)
       {
-        shader_cache->InsertGXUberPipeline(uid, std::move(UberPipeline));
+        shader_cache->InsertGXUberPipeline(uid, std::move(UberPipeline), from_disk_cache);
       }
       else
       {
@@ -1155,6 +1169,7 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
     u32 priority;
     std::optional<AbstractPipelineConfig> config;
     bool stages_ready;
+    bool from_disk_cache = false;
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<UberPipelineWorkItem>(this, uid, priority);
@@ -15,6 +15,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/IndexedDiskCache.h"
 #include "Common/LinearDiskCache.h"
 
 #include "VideoCommon/AbstractPipeline.h"
@@ -155,10 +156,18 @@ private:
                       const BlendingState& blending_state, AbstractPipelineUsage usage);
   std::optional<AbstractPipelineConfig> GetGXPipelineConfig(const GXPipelineUid& uid);
   std::optional<AbstractPipelineConfig> GetGXPipelineConfig(const GXUberPipelineUid& uid);
+  // Creates a pipeline from the data in the disk cache if possible, otherwise compiles it.
+  // Can be called from the compiler threads.
+  template <typename UidType, typename DiskKeyType>
+  std::unique_ptr<AbstractPipeline>
+  CreateGXPipeline(const UidType& uid, const AbstractPipelineConfig& config,
+                   Common::IndexedDiskCache<DiskKeyType, u8>& disk_cache, bool* from_disk_cache);
   const AbstractPipeline* InsertGXPipeline(const GXPipelineUid& config,
-                                           std::unique_ptr<AbstractPipeline> pipeline);
+                                           std::unique_ptr<AbstractPipeline> pipeline,
+                                           bool from_disk_cache);
   const AbstractPipeline* InsertGXUberPipeline(const GXUberPipelineUid& config,
-                                               std::unique_ptr<AbstractPipeline> pipeline);
+                                               std::unique_ptr<AbstractPipeline> pipeline,
+                                               bool from_disk_cache);
   void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
   void AppendGXPipelineUID(const GXPipelineUid& config);
 
@@ -175,9 +184,9 @@ private:
   void LoadShaderCache(T& cache, APIType api_type, const char* type, bool include_gameid);
   template <typename T>
   void ClearShaderCache(T& cache);
-  template <typename KeyType, typename DiskKeyType, typename T>
-  void LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyType, u8>& disk_cache,
-                         APIType api_type, const char* type, bool include_gameid);
+  template <typename DiskKeyType>
+  void LoadPipelineCache(Common::IndexedDiskCache<DiskKeyType, u8>& disk_cache, APIType api_type,
+                         const char* type, bool include_gameid);
   template <typename T, typename Y>
   void ClearPipelineCache(T& cache, Y& disk_cache);
 
@@ -225,12 +234,16 @@ private:
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
   // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
+  // These are looked up for every draw call, so they are hashed rather than ordered.
+  std::unordered_map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>,
+                     PipelineUidHash<GXPipelineUid>>
+      m_gx_pipeline_cache;
+  std::unordered_map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>,
+                     PipelineUidHash<GXUberPipelineUid>>
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
-  Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
-  Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
+  Common::IndexedDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
+  Common::IndexedDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
   // EFB copy to VRAM/RAM pipelines
   std::map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>>
@@ -91,6 +91,13 @@ void Statistics::Display() const
   draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
   draw_statistic("Primitives", "%d", this_frame.num_prims);
   draw_statistic("Primitives (DL)", "%d", this_frame.num_dl_prims);
+  if (g_ActiveConfig.bCPUCull)
+  {
+    draw_statistic("Triangles CPU culled", "%d", this_frame.num_triangles_cpu_culled);
+    draw_statistic("CPU cull time", "%.2f ms", this_frame.cpu_cull_time_ns / 1000000.0);
+  }
+  if (g_ActiveConfig.bVertexDataCache)
+    draw_statistic("Vertex data cache hits", "%d", this_frame.num_vertex_data_cache_hits);
   draw_statistic("XF loads", "%d", this_frame.num_xf_loads);
   draw_statistic("XF loads (DL)", "%d", this_frame.num_xf_loads_in_dl);
   draw_statistic("CP loads", "%d", this_frame.num_cp_loads);
@@ -4,8 +4,10 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <vector>
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/BPFunctions.h"
 
 struct Statistics
@@ -58,6 +60,11 @@ struct Statistics
 
     int num_dlists_called = 0;
 
+    int num_triangles_cpu_culled = 0;
+    u64 cpu_cull_time_ns = 0;
+
+    int num_vertex_data_cache_hits = 0;
+
     int bytes_vertex_streamed = 0;
     int bytes_index_streamed = 0;
     int bytes_uniform_streamed = 0;
@@ -81,6 +88,22 @@ struct Statistics
     int num_token_int = 0;
   };
   ThisFrame this_frame;
+
+  // Time spent in parts of the video frontend, added up for as long as measure_stage_times is set.
+  // This isn't reset on every frame, so that it can be compared across frames.
+  struct StageTimes
+  {
+    // Everything the GPU thread does for the FIFO data, including the stages below
+    s64 fifo_ns = 0;
+    s64 vertex_loader_ns = 0;
+    s64 index_generator_ns = 0;
+    // Generating shader UIDs and render states for the pipeline of a draw
+    s64 pipeline_uid_ns = 0;
+    s64 texture_decode_ns = 0;
+  };
+  StageTimes stage_times;
+  bool measure_stage_times = false;
+
   void ResetFrame();
   void SwapDL();
   void AddScissorRect();
@@ -94,6 +117,32 @@ struct Statistics
 
 extern Statistics g_stats;
 
+// Adds the time until the end of the scope to time_ns, one of the fields of g_stats.stage_times.
+class ScopedStageTimer
+{
+public:
+  explicit ScopedStageTimer(s64* time_ns)
+      : m_time_ns(g_stats.measure_stage_times ? time_ns : nullptr)
+  {
+    if (m_time_ns)
+      m_start = Clock::now();
+  }
+  ~ScopedStageTimer()
+  {
+    if (m_time_ns)
+      *m_time_ns += std::chrono::nanoseconds(Clock::now() - m_start).count();
+  }
+
+  ScopedStageTimer(const ScopedStageTimer&) = delete;
+  ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  s64* m_time_ns;
+  Clock::time_point m_start;
+};
+
 #define STATISTICS
 
 #ifdef STATISTICS
@@ -88,7 +88,7 @@ void TextureCacheBase::CheckTempSize(size_t required_size)
 
   m_temp_size = required_size;
   Common::FreeAlignedMemory(m_temp);
-  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
+  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, TEMP_ALIGNMENT));
 }
 
 TextureCacheBase::TextureCacheBase()
@@ -96,10 +96,11 @@ TextureCacheBase::TextureCacheBase()
   SetBackupConfig(g_ActiveConfig);
 
   m_temp_size = 2048 * 2048 * 4;
-  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
+  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, TEMP_ALIGNMENT));
 
   TexDecoder_SetTexFmtOverlayOptions(m_backup_config.texfmt_overlay,
                                      m_backup_config.texfmt_overlay_center);
+  m_texture_decoder.SetNumWorkers(g_ActiveConfig.GetTextureDecodingThreads());
 
   TMEM::InvalidateAll();
 }
@@ -141,6 +142,7 @@ void TextureCacheBase::Invalidate()
     bind.reset();
   m_textures_by_hash.clear();
   m_textures_by_address.clear();
+  m_max_texture_size_in_bytes = 0;
 
   m_texture_pool.clear();
 }
@@ -171,11 +173,15 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  if (config.GetTextureDecodingThreads() != m_texture_decoder.GetNumWorkers())
+    m_texture_decoder.SetNumWorkers(config.GetTextureDecodingThreads());
+
   SetBackupConfig(config);
 }
 
 void TextureCacheBase::Cleanup(int _frameCount)
 {
+  u32 max_texture_size_in_bytes = 0;
   TexAddrCache::iterator iter = m_textures_by_address.begin();
   TexAddrCache::iterator tcend = m_textures_by_address.end();
   while (iter != tcend)
@@ -183,6 +189,7 @@ void TextureCacheBase::Cleanup(int _frameCount)
     if (iter->second->frameCount == FRAMECOUNT_INVALID)
     {
       iter->second->frameCount = _frameCount;
+      max_texture_size_in_bytes = std::max(max_texture_size_in_bytes, iter->second->size_in_bytes);
       ++iter;
     }
     else if (_frameCount > TEXTURE_KILL_THRESHOLD + iter->second->frameCount)
@@ -200,6 +207,8 @@ void TextureCacheBase::Cleanup(int _frameCount)
         }
         else
         {
+          max_texture_size_in_bytes =
+              std::max(max_texture_size_in_bytes, iter->second->size_in_bytes);
           ++iter;
         }
       }
@@ -210,9 +219,11 @@ void TextureCacheBase::Cleanup(int _frameCount)
     }
     else
     {
+      max_texture_size_in_bytes = std::max(max_texture_size_in_bytes, iter->second->size_in_bytes);
       ++iter;
     }
   }
+  m_max_texture_size_in_bytes = max_texture_size_in_bytes;
 
   TexPool::iterator iter2 = m_texture_pool.begin();
   TexPool::iterator tcend2 = m_texture_pool.end();
@@ -335,7 +346,7 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
     g_gfx->EndUtilityDrawing();
   }
 
-  m_textures_by_address.emplace(decoded_entry->addr, decoded_entry);
+  AddToAddressCache(decoded_entry);
 
   return decoded_entry;
 }
@@ -381,7 +392,7 @@ RcTcacheEntry TextureCacheBase::ReinterpretEntry(const RcTcacheEntry& existing_e
   g_gfx->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  m_textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  AddToAddressCache(reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -735,7 +746,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      m_textures_by_address.emplace(addr, entry);
+      AddToAddressCache(entry);
   }
 
   // Fill in hash map.
@@ -1673,6 +1684,19 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
 
+    // Levels decoded on the CPU are queued on m_texture_decoder, and only uploaded once all of them
+    // have been decoded, so that the mip levels are decoded alongside the first level.
+    struct DecodedLevel
+    {
+      u32 level;
+      u32 width;
+      u32 height;
+      u32 row_length;
+      const u8* buffer;
+      size_t size;
+    };
+    std::vector<DecodedLevel> decoded_levels;
+
     if (!decode_on_gpu ||
         !DecodeTextureOnGPU(
             entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
@@ -1702,20 +1726,21 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       dst_buffer = m_temp;
       if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        ScopedStageTimer timer(&g_stats.stage_times.texture_decode_ns);
+        m_texture_decoder.Decode(dst_buffer, texture_info.GetData(), expanded_width,
+                                 expanded_height, texture_info.GetTextureFormat(),
+                                 texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
       }
       else
       {
+        ScopedStageTimer timer(&g_stats.stage_times.texture_decode_ns);
         TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
                                        texture_info.GetTmemOddAddress(), expanded_width,
                                        expanded_height);
       }
 
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
-
-      arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
+      decoded_levels.push_back(
+          {0, width, height, expanded_width, dst_buffer, decoded_texture_size});
 
       dst_buffer += decoded_texture_size;
     }
@@ -1743,20 +1768,32 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level.GetExpandedWidth() * sizeof(u32) * mip_level.GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level.GetData(), mip_level.GetExpandedWidth(),
-                          mip_level.GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(mip_level.GetLevel(), mip_level.GetRawWidth(),
-                             mip_level.GetRawHeight(), mip_level.GetExpandedWidth(), dst_buffer,
-                             decoded_mip_size);
-
-        arbitrary_mip_detector.AddLevel(mip_level.GetRawWidth(), mip_level.GetRawHeight(),
-                                        mip_level.GetExpandedWidth(), dst_buffer);
+        {
+          ScopedStageTimer timer(&g_stats.stage_times.texture_decode_ns);
+          m_texture_decoder.Decode(dst_buffer, mip_level.GetData(), mip_level.GetExpandedWidth(),
+                                   mip_level.GetExpandedHeight(), texture_info.GetTextureFormat(),
+                                   texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        }
+        decoded_levels.push_back({mip_level.GetLevel(), mip_level.GetRawWidth(),
+                                  mip_level.GetRawHeight(), mip_level.GetExpandedWidth(),
+                                  dst_buffer, decoded_mip_size});
 
         dst_buffer += decoded_mip_size;
       }
     }
 
+    {
+      ScopedStageTimer timer(&g_stats.stage_times.texture_decode_ns);
+      m_texture_decoder.Wait();
+    }
+
+    for (const DecodedLevel& level : decoded_levels)
+    {
+      entry->texture->Load(level.level, level.width, level.height, level.row_length, level.buffer,
+                           level.size);
+      arbitrary_mip_detector.AddLevel(level.width, level.height, level.row_length, level.buffer);
+    }
+
     entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
@@ -1776,14 +1813,6 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     }
   }
 
-  const auto iter = m_textures_by_address.emplace(texture_info.GetRawAddress(), entry);
-  if (safety_color_sample_size == 0 ||
-      std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
-          (u32)safety_color_sample_size * 8)
-  {
-    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
-  }
-
   const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
                                          texture_info.GetTlutFormat());
   entry->SetGeneralParameters(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
@@ -1794,6 +1823,14 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
 
+  const auto iter = AddToAddressCache(entry);
+  if (safety_color_sample_size == 0 ||
+      std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
+          (u32)safety_color_sample_size * 8)
+  {
+    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
+  }
+
   INCSTAT(g_stats.num_textures_uploaded);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
 
@@ -1876,7 +1913,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  m_textures_by_address.emplace(entry->addr, entry);
+  AddToAddressCache(entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -2509,7 +2546,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    m_textures_by_address.emplace(dstAddr, std::move(entry));
+    AddToAddressCache(std::move(entry));
   }
 }
 
@@ -2736,16 +2773,21 @@ TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCach
   return m_textures_by_address.end();
 }
 
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::AddToAddressCache(RcTcacheEntry entry)
+{
+  m_max_texture_size_in_bytes = std::max(m_max_texture_size_in_bytes, entry->size_in_bytes);
+  const u32 addr = entry->addr;
+  return m_textures_by_address.emplace(addr, std::move(entry));
+}
+
 std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
   // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
-
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
+  // which end after the given addr. But we know the size of the largest texture in the
+  // cache, so we look for all textures which have a start address bigger than addr minus
+  // that size. This yields false-positives which must be checked later on.
+  const u32 max_texture_size = m_max_texture_size_in_bytes;
   u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
   auto begin = m_textures_by_address.lower_bound(lower_addr);
   auto end = m_textures_by_address.upper_bound(addr + size_in_bytes);
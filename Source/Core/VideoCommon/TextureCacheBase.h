@@ -25,6 +25,8 @@
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/HiresTextures.h"
+#include "VideoCommon/ParallelTextureDecoder.h"
+#include "VideoCommon/TextureCacheIndex.h"
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureInfo.h"
@@ -155,7 +157,7 @@ struct TCacheEntry
 
   // Keep an iterator to the entry in m_textures_by_hash, so it does not need to be searched when
   // removing the cache entry
-  std::multimap<u64, std::shared_ptr<TCacheEntry>>::iterator textures_by_hash_iter;
+  VideoCommon::IndexedMultimap<u64, std::shared_ptr<TCacheEntry>>::iterator textures_by_hash_iter;
 
   // This is used to keep track of both:
   //   * efb copies used by this partially updated texture
@@ -336,12 +338,15 @@ protected:
                                    float gamma, bool clamp_top, bool clamp_bottom,
                                    const std::array<u32, 3>& filter_coefficients);
 
+  // Aligned for the 32-byte stores of the AVX2 texture decoders, which are slower when they cross
+  // cache lines
+  static constexpr size_t TEMP_ALIGNMENT = 32;
   alignas(16) u8* m_temp = nullptr;
   size_t m_temp_size = 0;
 
 private:
-  using TexAddrCache = std::multimap<u32, RcTcacheEntry>;
-  using TexHashCache = std::multimap<u64, RcTcacheEntry>;
+  using TexAddrCache = VideoCommon::IndexedMultimap<u32, RcTcacheEntry>;
+  using TexHashCache = VideoCommon::IndexedMultimap<u64, RcTcacheEntry>;
 
   using TexPool = std::unordered_multimap<TextureConfig, TexPoolEntry>;
 
@@ -375,6 +380,9 @@ private:
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
+  // Inserts the entry into m_textures_by_address. Its address and size must already be set.
+  TexAddrCache::iterator AddToAddressCache(RcTcacheEntry entry);
+
   // Return all possible overlapping textures. As addr+size of the textures is not
   // indexed, this may return false positives.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
@@ -414,6 +422,11 @@ private:
   // but it's possible for invalidated TCache entries to live on elsewhere
   TexAddrCache m_textures_by_address;
 
+  // Upper bound of size_in_bytes over m_textures_by_address. Textures are only indexed by their
+  // start address, so this bounds how far back FindOverlappingTextures has to search. It grows
+  // on insertion and is only tightened again by Cleanup, which visits every texture anyway.
+  u32 m_max_texture_size_in_bytes = 0;
+
   // m_textures_by_hash is an alternative view of the texture cache
   // All textures in here will also be in m_textures_by_address
   TexHashCache m_textures_by_hash;
@@ -425,6 +438,8 @@ private:
   TexPool m_texture_pool;
   u64 m_last_entry_id = 0;
 
+  ParallelTextureDecoder m_texture_decoder;
+
   // Backup configuration values
   struct BackupConfig
   {
@@ -0,0 +1,204 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace VideoCommon
+{
+// Open-addressing hash table with linear probing. Keys must be integers.
+template <typename Key, typename Value>
+class FlatHashIndex
+{
+public:
+  Value* Find(Key key)
+  {
+    if (m_size == 0)
+      return nullptr;
+
+    for (std::size_t i = Hash(key) & m_mask;; i = (i + 1) & m_mask)
+    {
+      Slot& slot = m_slots[i];
+      if (!slot.occupied)
+        return nullptr;
+      if (slot.key == key)
+        return &slot.value;
+    }
+  }
+
+  // The key must not be present yet.
+  void Insert(Key key, Value value)
+  {
+    // Keep the load factor at or below one half, so that probe sequences stay short.
+    if ((m_size + 1) * 2 > m_slots.size())
+      Rehash(std::max<std::size_t>(m_slots.size() * 2, MIN_CAPACITY));
+
+    std::size_t i = Hash(key) & m_mask;
+    while (m_slots[i].occupied)
+      i = (i + 1) & m_mask;
+    m_slots[i] = Slot{key, std::move(value), true};
+    ++m_size;
+  }
+
+  void Erase(Key key)
+  {
+    if (m_size == 0)
+      return;
+
+    std::size_t i = Hash(key) & m_mask;
+    while (m_slots[i].key != key)
+    {
+      if (!m_slots[i].occupied)
+        return;
+      i = (i + 1) & m_mask;
+    }
+    if (!m_slots[i].occupied)
+      return;
+
+    // Shift back the following entries of the cluster instead of leaving a tombstone, so that
+    // lookups never have to skip deleted slots.
+    for (std::size_t j = (i + 1) & m_mask; m_slots[j].occupied; j = (j + 1) & m_mask)
+    {
+      const std::size_t home = Hash(m_slots[j].key) & m_mask;
+      if (((j - home) & m_mask) >= ((j - i) & m_mask))
+      {
+        m_slots[i] = std::move(m_slots[j]);
+        i = j;
+      }
+    }
+    m_slots[i] = Slot{};
+    --m_size;
+  }
+
+  void Clear()
+  {
+    m_slots.clear();
+    m_mask = 0;
+    m_size = 0;
+  }
+
+  std::size_t size() const { return m_size; }
+
+private:
+  static constexpr std::size_t MIN_CAPACITY = 64;
+
+  struct Slot
+  {
+    Key key{};
+    Value value{};
+    bool occupied = false;
+  };
+
+  static std::size_t Hash(Key key)
+  {
+    // Texture addresses and hashes are both poorly distributed in their low bits (addresses are
+    // aligned, and many hashes only have their low 32 bits set), so mix everything together.
+    u64 x = static_cast<u64>(key);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return static_cast<std::size_t>(x);
+  }
+
+  void Rehash(std::size_t capacity)
+  {
+    std::vector<Slot> old_slots = std::exchange(m_slots, std::vector<Slot>(capacity));
+    m_mask = capacity - 1;
+    for (Slot& slot : old_slots)
+    {
+      if (!slot.occupied)
+        continue;
+      std::size_t i = Hash(slot.key) & m_mask;
+      while (m_slots[i].occupied)
+        i = (i + 1) & m_mask;
+      m_slots[i] = std::move(slot);
+    }
+  }
+
+  std::vector<Slot> m_slots;
+  std::size_t m_mask = 0;
+  std::size_t m_size = 0;
+};
+
+// A std::multimap with a flat hash index pointing at the first element of every key. Exact
+// lookups, which the texture cache does for every texture it binds, cost a single probe of the
+// index instead of two walks down the tree. The multimap stays the owner of the elements, so its
+// ordering is still available for range queries and iterators remain stable.
+template <typename Key, typename Value>
+class IndexedMultimap
+{
+public:
+  using Map = std::multimap<Key, Value>;
+  using iterator = typename Map::iterator;
+  using const_iterator = typename Map::const_iterator;
+
+  iterator begin() { return m_map.begin(); }
+  iterator end() { return m_map.end(); }
+  const_iterator begin() const { return m_map.begin(); }
+  const_iterator end() const { return m_map.end(); }
+  std::size_t size() const { return m_map.size(); }
+  bool empty() const { return m_map.empty(); }
+
+  void clear()
+  {
+    m_map.clear();
+    m_first_by_key.Clear();
+  }
+
+  template <typename... Args>
+  iterator emplace(const Key& key, Args&&... args)
+  {
+    const iterator it = m_map.emplace(key, std::forward<Args>(args)...);
+    // std::multimap inserts after any elements with an equal key, so the first element of a key
+    // only has to be recorded when the key is new.
+    if (!m_first_by_key.Find(key))
+      m_first_by_key.Insert(key, it);
+    return it;
+  }
+
+  iterator erase(iterator it)
+  {
+    const Key key = it->first;
+    iterator* const first = m_first_by_key.Find(key);
+    const bool was_first = *first == it;
+    const iterator next = m_map.erase(it);
+    if (was_first)
+    {
+      if (next != m_map.end() && next->first == key)
+        *first = next;
+      else
+        m_first_by_key.Erase(key);
+    }
+    return next;
+  }
+
+  std::pair<iterator, iterator> equal_range(const Key& key)
+  {
+    iterator* const first = m_first_by_key.Find(key);
+    if (!first)
+      return {m_map.end(), m_map.end()};
+
+    // Very few elements share a key, so stepping over them is cheaper than another tree walk.
+    iterator last = *first;
+    do
+    {
+      ++last;
+    } while (last != m_map.end() && last->first == key);
+    return {*first, last};
+  }
+
+  iterator lower_bound(const Key& key) { return m_map.lower_bound(key); }
+  iterator upper_bound(const Key& key) { return m_map.upper_bound(key); }
+
+private:
+  Map m_map;
+  FlatHashIndex<Key, iterator> m_first_by_key;
+};
+}  // namespace VideoCommon
@@ -191,6 +191,13 @@ TextureFormat TexDecoder_GetEFBCopyBaseFormat(EFBCopyFormat format);
 
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt);
+// Decodes the rows [first_row, first_row + num_rows) of a texture into the same rows of dst, so
+// that a texture can be decoded in parts. Both have to be multiples of the block height. Unlike
+// TexDecoder_Decode, this doesn't draw the format overlay.
+void TexDecoder_DecodeRows(u8* dst, const u8* src, int width, int first_row, int num_rows,
+                           TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt);
+// Draws the name of the format onto a decoded texture, if the format overlay is enabled.
+void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat);
 void TexDecoder_DecodeRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
                                     int height);
 void TexDecoder_DecodeTexel(u8* dst, std::span<const u8> src, int s, int t, int imageWidth,
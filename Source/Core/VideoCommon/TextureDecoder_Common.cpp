@@ -255,7 +255,7 @@ void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center)
   TexFmt_Overlay_Center = center;
 }
 
-static void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat)
+static void DrawOverlay(u8* dst, int width, int height, TextureFormat texformat)
 {
   int w = std::min(width, 40);
   int h = std::min(height, 10);
@@ -297,13 +297,25 @@ static void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat
   }
 }
 
+void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat)
+{
+  if (TexFmt_Overlay_Enable)
+    DrawOverlay(dst, width, height, texformat);
+}
+
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt)
 {
   _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
+  TexDecoder_DrawOverlay(dst, width, height, texformat);
+}
 
-  if (TexFmt_Overlay_Enable)
-    TexDecoder_DrawOverlay(dst, width, height, texformat);
+void TexDecoder_DecodeRows(u8* dst, const u8* src, int width, int first_row, int num_rows,
+                           TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  const int src_offset = TexDecoder_GetTextureSizeInBytes(width, first_row, texformat);
+  _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(dst) + first_row * width, src + src_offset, width,
+                         num_rows, texformat, tlut, tlutfmt);
 }
 
 static inline u32 DecodePixel_IA8(u16 val)
@@ -299,6 +299,57 @@ static void TexDecoder_DecodeImpl_I4_SSSE3(u32* dst, const u8* src, int width, i
   }
 }
 
+// Stores the two rows of texels which the masks shuffle out of rows to dst and the row below.
+FUNCTION_TARGET_AVX2
+static inline void StoreRowPair_AVX2(u32* dst, int width, __m256i rows, __m256i mask_row0,
+                                     __m256i mask_row1)
+{
+  _mm256_storeu_si256((__m256i*)dst, _mm256_shuffle_epi8(rows, mask_row0));
+  _mm256_storeu_si256((__m256i*)(dst + width), _mm256_shuffle_epi8(rows, mask_row1));
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i kMask_x0f = _mm256_set1_epi8(0x0f);
+  const __m256i kMask_xf0 = _mm256_set1_epi8(static_cast<char>(0xf0));
+  // Given two rows of texels in both lanes, these spread the texels of the first or second row
+  // over the whole register, with every texel repeated in all four bytes.
+  const __m256i mask_row0 = _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,  //
+                                             4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+  const __m256i mask_row1 = _mm256_add_epi8(mask_row0, _mm256_set1_epi8(8));
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      // Load the whole 8x8 block, 4 bytes per row
+      const __m256i block = _mm256_loadu_si256((const __m256i*)(src + 32 * yStep));
+
+      // Replicate each nibble to a whole byte
+      const __m256i hi = _mm256_and_si256(block, kMask_xf0);
+      const __m256i hi8 = _mm256_or_si256(hi, _mm256_srli_epi16(hi, 4));
+      const __m256i lo = _mm256_and_si256(block, kMask_x0f);
+      const __m256i lo8 = _mm256_or_si256(lo, _mm256_slli_epi16(lo, 4));
+
+      // Put the texels in order, which leaves rows 0, 1 | 4, 5 and rows 2, 3 | 6, 7 in the lanes
+      const __m256i rows0145 = _mm256_unpacklo_epi8(hi8, lo8);
+      const __m256i rows2367 = _mm256_unpackhi_epi8(hi8, lo8);
+      const __m256i rows01 = _mm256_permute2x128_si256(rows0145, rows0145, 0x00);
+      const __m256i rows23 = _mm256_permute2x128_si256(rows2367, rows2367, 0x00);
+      const __m256i rows45 = _mm256_permute2x128_si256(rows0145, rows0145, 0x11);
+      const __m256i rows67 = _mm256_permute2x128_si256(rows2367, rows2367, 0x11);
+
+      u32* block_dst = dst + y * width + x;
+      StoreRowPair_AVX2(block_dst + 0 * width, width, rows01, mask_row0, mask_row1);
+      StoreRowPair_AVX2(block_dst + 2 * width, width, rows23, mask_row0, mask_row1);
+      StoreRowPair_AVX2(block_dst + 4 * width, width, rows45, mask_row0, mask_row1);
+      StoreRowPair_AVX2(block_dst + 6 * width, width, rows67, mask_row0, mask_row1);
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_I4(u32* dst, const u8* src, int width, int height,
                                      TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                      int Wsteps4, int Wsteps8)
@@ -421,6 +472,31 @@ static void TexDecoder_DecodeImpl_I8_SSSE3(u32* dst, const u8* src, int width, i
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Same as for I4, spreads the first or second row of 8 texels in a lane over the register
+  const __m256i mask_row0 = _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,  //
+                                             4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+  const __m256i mask_row1 = _mm256_add_epi8(mask_row0, _mm256_set1_epi8(8));
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      // Load the whole 8x4 block, with rows 0, 1 | 2, 3 in the lanes
+      const __m256i block = _mm256_loadu_si256((const __m256i*)(src + 32 * yStep));
+      const __m256i rows01 = _mm256_permute2x128_si256(block, block, 0x00);
+      const __m256i rows23 = _mm256_permute2x128_si256(block, block, 0x11);
+
+      u32* block_dst = dst + y * width + x;
+      StoreRowPair_AVX2(block_dst + 0 * width, width, rows01, mask_row0, mask_row1);
+      StoreRowPair_AVX2(block_dst + 2 * width, width, rows23, mask_row0, mask_row1);
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_I8(u32* dst, const u8* src, int width, int height,
                                      TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                      int Wsteps4, int Wsteps8)
@@ -575,6 +651,50 @@ static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int he
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA4_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m256i kMask_x0f = _mm256_set1_epi8(0x0f);
+  const __m256i kMask_xf0 = _mm256_set1_epi8(static_cast<char>(0xf0));
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      // Load the whole 8x4 block, with rows 0, 1 | 2, 3 in the lanes
+      const __m256i block = _mm256_loadu_si256((const __m256i*)(src + 32 * yStep));
+
+      // Alpha is the high nibble, intensity the low one
+      const __m256i a = _mm256_and_si256(block, kMask_xf0);
+      const __m256i a8 = _mm256_or_si256(a, _mm256_srli_epi16(a, 4));
+      const __m256i i = _mm256_and_si256(block, kMask_x0f);
+      const __m256i i8 = _mm256_or_si256(i, _mm256_slli_epi16(i, 4));
+
+      // Interleave to (I, I, I, A) for every texel. The first unpack leaves rows 0 | 2 in the
+      // lanes, the second one rows 1 | 3.
+      const __m256i ia_row02 = _mm256_unpacklo_epi8(i8, a8);
+      const __m256i ii_row02 = _mm256_unpacklo_epi8(i8, i8);
+      const __m256i ia_row13 = _mm256_unpackhi_epi8(i8, a8);
+      const __m256i ii_row13 = _mm256_unpackhi_epi8(i8, i8);
+      const __m256i left02 = _mm256_unpacklo_epi16(ii_row02, ia_row02);
+      const __m256i right02 = _mm256_unpackhi_epi16(ii_row02, ia_row02);
+      const __m256i left13 = _mm256_unpacklo_epi16(ii_row13, ia_row13);
+      const __m256i right13 = _mm256_unpackhi_epi16(ii_row13, ia_row13);
+
+      u32* block_dst = dst + y * width + x;
+      _mm256_storeu_si256((__m256i*)(block_dst + 0 * width),
+                          _mm256_permute2x128_si256(left02, right02, 0x20));
+      _mm256_storeu_si256((__m256i*)(block_dst + 1 * width),
+                          _mm256_permute2x128_si256(left13, right13, 0x20));
+      _mm256_storeu_si256((__m256i*)(block_dst + 2 * width),
+                          _mm256_permute2x128_si256(left02, right02, 0x31));
+      _mm256_storeu_si256((__m256i*)(block_dst + 3 * width),
+                          _mm256_permute2x128_si256(left13, right13, 0x31));
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_IA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                             TextureFormat texformat, const u8* tlut,
@@ -600,6 +720,34 @@ static void TexDecoder_DecodeImpl_IA8_SSSE3(u32* dst, const u8* src, int width,
   }
 }
 
+// Requires the width to be a multiple of 8, so that the 4x4 blocks can be decoded in pairs.
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Given a row of the left block in the low lane and the same row of the right block in the high
+  // one, these turn the first or second row in each lane from (A, I) to (I, I, I, A).
+  const __m256i mask_row0 = _mm256_setr_epi8(1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6,  //
+                                             1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6);
+  const __m256i mask_row1 = _mm256_add_epi8(mask_row0, _mm256_set1_epi8(8));
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 8, yStep += 2)
+    {
+      // Load two 4x4 blocks, with rows 0, 1 | 2, 3 in the lanes of each
+      const __m256i left = _mm256_loadu_si256((const __m256i*)(src + 32 * yStep));
+      const __m256i right = _mm256_loadu_si256((const __m256i*)(src + 32 * yStep + 32));
+      const __m256i rows01 = _mm256_permute2x128_si256(left, right, 0x20);
+      const __m256i rows23 = _mm256_permute2x128_si256(left, right, 0x31);
+
+      u32* block_dst = dst + y * width + x;
+      StoreRowPair_AVX2(block_dst + 0 * width, width, rows01, mask_row0, mask_row1);
+      StoreRowPair_AVX2(block_dst + 2 * width, width, rows23, mask_row0, mask_row1);
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_IA8(u32* dst, const u8* src, int width, int height,
                                       TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                       int Wsteps4, int Wsteps8)
@@ -877,6 +1025,81 @@ static void TexDecoder_DecodeImpl_RGB5A3_SSSE3(u32* dst, const u8* src, int widt
   }
 }
 
+// Decodes eight RGB5A3 values, one in the low 16 bits of each 32-bit word. Both encodings are
+// decoded for every texel, and the top bit of each value picks one of them.
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodeRGB5A3_AVX2(__m256i val)
+{
+  const __m256i kMask_x1f = _mm256_set1_epi32(0x0000001f);
+  const __m256i kMask_x0f = _mm256_set1_epi32(0x0000000f);
+  const __m256i kMask_x07 = _mm256_set1_epi32(0x00000007);
+
+  // RGB555, with alpha 0xFF. Swizzle bits: 00012345 -> 12345123
+  const __m256i r5 = _mm256_and_si256(_mm256_srli_epi32(val, 10), kMask_x1f);
+  const __m256i g5 = _mm256_and_si256(_mm256_srli_epi32(val, 5), kMask_x1f);
+  const __m256i b5 = _mm256_and_si256(val, kMask_x1f);
+  const __m256i r5_8 = _mm256_or_si256(_mm256_slli_epi32(r5, 3), _mm256_srli_epi32(r5, 2));
+  const __m256i g5_8 = _mm256_or_si256(_mm256_slli_epi32(g5, 3), _mm256_srli_epi32(g5, 2));
+  const __m256i b5_8 = _mm256_or_si256(_mm256_slli_epi32(b5, 3), _mm256_srli_epi32(b5, 2));
+  const __m256i rgb555 =
+      _mm256_or_si256(_mm256_or_si256(r5_8, _mm256_slli_epi32(g5_8, 8)),
+                      _mm256_or_si256(_mm256_slli_epi32(b5_8, 16), _mm256_set1_epi32(0xFF000000)));
+
+  // RGBA4443. Swizzle bits: 00001234 -> 12341234, and 00000123 -> 12312312 for alpha
+  const __m256i r4 = _mm256_and_si256(_mm256_srli_epi32(val, 8), kMask_x0f);
+  const __m256i g4 = _mm256_and_si256(_mm256_srli_epi32(val, 4), kMask_x0f);
+  const __m256i b4 = _mm256_and_si256(val, kMask_x0f);
+  const __m256i a3 = _mm256_and_si256(_mm256_srli_epi32(val, 12), kMask_x07);
+  const __m256i r4_8 = _mm256_or_si256(_mm256_slli_epi32(r4, 4), r4);
+  const __m256i g4_8 = _mm256_or_si256(_mm256_slli_epi32(g4, 4), g4);
+  const __m256i b4_8 = _mm256_or_si256(_mm256_slli_epi32(b4, 4), b4);
+  const __m256i a3_8 =
+      _mm256_or_si256(_mm256_slli_epi32(a3, 5),
+                      _mm256_or_si256(_mm256_slli_epi32(a3, 2), _mm256_srli_epi32(a3, 1)));
+  const __m256i rgba4443 =
+      _mm256_or_si256(_mm256_or_si256(r4_8, _mm256_slli_epi32(g4_8, 8)),
+                      _mm256_or_si256(_mm256_slli_epi32(b4_8, 16), _mm256_slli_epi32(a3_8, 24)));
+
+  const __m256i is_rgb555 = _mm256_srai_epi32(_mm256_slli_epi32(val, 16), 31);
+  return _mm256_blendv_epi8(rgba4443, rgb555, is_rgb555);
+}
+
+// Requires the width to be a multiple of 8, so that the 4x4 blocks can be decoded in pairs.
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Given a row of the left block in the low lane and the same row of the right block in the high
+  // one, these byteswap the values of the first or second row in each lane into 32-bit words.
+  const __m256i mask_row0 =
+      _mm256_setr_epi8(1, 0, -128, -128, 3, 2, -128, -128, 5, 4, -128, -128, 7, 6, -128, -128,  //
+                       1, 0, -128, -128, 3, 2, -128, -128, 5, 4, -128, -128, 7, 6, -128, -128);
+  // The zeroing bytes of the mask keep their top bit when moving it to the second row
+  const __m256i mask_row1 = _mm256_add_epi8(mask_row0, _mm256_set1_epi8(8));
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 8, yStep += 2)
+    {
+      // Load two 4x4 blocks, with rows 0, 1 | 2, 3 in the lanes of each
+      const __m256i left = _mm256_loadu_si256((const __m256i*)(src + 32 * yStep));
+      const __m256i right = _mm256_loadu_si256((const __m256i*)(src + 32 * yStep + 32));
+      const __m256i rows01 = _mm256_permute2x128_si256(left, right, 0x20);
+      const __m256i rows23 = _mm256_permute2x128_si256(left, right, 0x31);
+
+      u32* block_dst = dst + y * width + x;
+      _mm256_storeu_si256((__m256i*)(block_dst + 0 * width),
+                          DecodeRGB5A3_AVX2(_mm256_shuffle_epi8(rows01, mask_row0)));
+      _mm256_storeu_si256((__m256i*)(block_dst + 1 * width),
+                          DecodeRGB5A3_AVX2(_mm256_shuffle_epi8(rows01, mask_row1)));
+      _mm256_storeu_si256((__m256i*)(block_dst + 2 * width),
+                          DecodeRGB5A3_AVX2(_mm256_shuffle_epi8(rows23, mask_row0)));
+      _mm256_storeu_si256((__m256i*)(block_dst + 3 * width),
+                          DecodeRGB5A3_AVX2(_mm256_shuffle_epi8(rows23, mask_row1)));
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_RGB5A3(u32* dst, const u8* src, int width, int height,
                                          TextureFormat texformat, const u8* tlut,
                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
@@ -1409,6 +1632,87 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
   }
 }
 
+// Builds the palettes of two DXT blocks, which have to be in the low 8 bytes of the low and high
+// lane: the four colors of the first block, followed by the four of the second one.
+FUNCTION_TARGET_AVX2
+static inline __m256i BuildDXTPalettes_AVX2(__m256i dxt)
+{
+  // Both endpoints of the lane's block in every 32-bit word, byteswapped to (color1, color2)
+  const __m256i endpoints = _mm256_shuffle_epi8(
+      dxt, _mm256_setr_epi8(1, 0, 3, 2, 1, 0, 3, 2, 1, 0, 3, 2, 1, 0, 3, 2,  //
+                            1, 0, 3, 2, 1, 0, 3, 2, 1, 0, 3, 2, 1, 0, 3, 2));
+
+  // Expand the 565 endpoints to 8 bits per channel, keeping each channel in 16-bit words
+  const __m256i r5 = _mm256_srli_epi16(endpoints, 11);
+  const __m256i g6 = _mm256_and_si256(_mm256_srli_epi16(endpoints, 5), _mm256_set1_epi16(0x3f));
+  const __m256i b5 = _mm256_and_si256(endpoints, _mm256_set1_epi16(0x1f));
+  const __m256i r = _mm256_or_si256(_mm256_slli_epi16(r5, 3), _mm256_srli_epi16(r5, 2));
+  const __m256i g = _mm256_or_si256(_mm256_slli_epi16(g6, 2), _mm256_srli_epi16(g6, 4));
+  const __m256i b = _mm256_or_si256(_mm256_slli_epi16(b5, 3), _mm256_srli_epi16(b5, 2));
+
+  // Every palette color is (color1 * w1 + color2 * w2) / 8. The weights depend on whether
+  // color1 > color2: colors 2 and 3 are then 5/8 and 3/8 of the way from one endpoint to the
+  // other (see DXTBlend), or otherwise both the average, with color 3 being transparent.
+  const __m256i color1_greater = _mm256_cmpgt_epi32(
+      _mm256_and_si256(endpoints, _mm256_set1_epi32(0xffff)), _mm256_srli_epi32(endpoints, 16));
+  const __m256i weights = _mm256_blendv_epi8(
+      _mm256_setr_epi16(8, 0, 0, 8, 4, 4, 4, 4, 8, 0, 0, 8, 4, 4, 4, 4),
+      _mm256_setr_epi16(8, 0, 0, 8, 5, 3, 3, 5, 8, 0, 0, 8, 5, 3, 3, 5), color1_greater);
+  const __m256i transparent = _mm256_andnot_si256(
+      color1_greater, _mm256_setr_epi32(0, 0, 0, -1, 0, 0, 0, -1));
+
+  const __m256i r8 = _mm256_srli_epi32(_mm256_madd_epi16(r, weights), 3);
+  const __m256i g8 = _mm256_srli_epi32(_mm256_madd_epi16(g, weights), 3);
+  const __m256i b8 = _mm256_srli_epi32(_mm256_madd_epi16(b, weights), 3);
+  const __m256i a8 = _mm256_andnot_si256(transparent, _mm256_set1_epi32(0xFF000000));
+  return _mm256_or_si256(_mm256_or_si256(r8, _mm256_slli_epi32(g8, 8)),
+                         _mm256_or_si256(_mm256_slli_epi32(b8, 16), a8));
+}
+
+// Decodes a row of two DXT blocks, which have to be in the low 8 bytes of the low and high lane.
+FUNCTION_TARGET_AVX2
+static inline void DecodeDXTBlockPair_AVX2(u32* dst, int width, __m256i blocks)
+{
+  const __m256i palettes = BuildDXTPalettes_AVX2(blocks);
+  // The palette of the right block comes after the one of the left block
+  const __m256i palette_offsets = _mm256_setr_epi32(0, 0, 0, 0, 4, 4, 4, 4);
+  const __m256i index_shifts = _mm256_setr_epi32(6, 4, 2, 0, 6, 4, 2, 0);
+  const __m256i kMask_x03 = _mm256_set1_epi32(3);
+
+  for (int row = 0; row < 4; row++)
+  {
+    // Copy the index byte of the row to every 32-bit word of the lane, and pick each texel's
+    // 2-bit index out of it
+    const __m256i row_bytes =
+        _mm256_shuffle_epi8(blocks, _mm256_set1_epi32(static_cast<int>(0x80808004 + row)));
+    const __m256i indices = _mm256_add_epi32(
+        _mm256_and_si256(_mm256_srlv_epi32(row_bytes, index_shifts), kMask_x03),
+        palette_offsets);
+    _mm256_storeu_si256((__m256i*)(dst + row * width),
+                        _mm256_permutevar8x32_epi32(palettes, indices));
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_CMPR_AVX2(u32* dst, const u8* src, int width, int height,
+                                            TextureFormat texformat, const u8* tlut,
+                                            TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      // Load all four DXT blocks of the 8x8 block. The first two are its top half, the last two
+      // its bottom half.
+      const __m256i dxt = _mm256_loadu_si256((const __m256i*)(src + 32 * yStep));
+      DecodeDXTBlockPair_AVX2(dst + y * width + x, width,
+                              _mm256_permute4x64_epi64(dxt, _MM_SHUFFLE(1, 1, 0, 0)));
+      DecodeDXTBlockPair_AVX2(dst + (y + 4) * width + x, width,
+                              _mm256_permute4x64_epi64(dxt, _MM_SHUFFLE(3, 3, 2, 2)));
+    }
+  }
+}
+
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
@@ -1422,7 +1726,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I4:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I4_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1430,7 +1737,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1442,11 +1752,19 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::IA4:
-    TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else
+      TexDecoder_DecodeImpl_IA4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                Wsteps8);
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2 && width % 8 == 0)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1465,7 +1783,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2 && width % 8 == 0)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
@@ -1483,7 +1804,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::CMPR:
-    TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_CMPR_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                      Wsteps8);
+    else
+      TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                 Wsteps8);
     break;
 
   case TextureFormat::XFB:
@@ -0,0 +1,223 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/VertexDataCache.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+#include "Common/Swap.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexLoader_Color.h"
+#include "VideoCommon/VertexLoader_Normal.h"
+#include "VideoCommon/VertexLoader_Position.h"
+#include "VideoCommon/VertexLoader_TextCoord.h"
+
+namespace
+{
+// Converted vertex data kept at most, after which the cache starts over
+constexpr size_t MAX_CACHE_SIZE = 64 * 1024 * 1024;
+constexpr size_t MAX_SEEN_ONCE = 0x10000;
+
+struct ArrayRange
+{
+  u32 min_index = UINT32_MAX;
+  u32 max_index = 0;
+};
+
+// Finds the lowest and highest index used by an indexed attribute. An attribute can have up to
+// three indices per vertex (normals, tangents and binormals in Index3 mode).
+ArrayRange GetArrayRange(const u8* src, u32 vertex_size, int count, u32 offset,
+                         VertexComponentFormat format, u32 num_indices, bool is_position)
+{
+  ArrayRange range;
+  const bool index16 = format == VertexComponentFormat::Index16;
+  for (int i = 0; i < count; ++i)
+  {
+    const u8* indices = src + i * vertex_size + offset;
+    for (u32 j = 0; j < num_indices; ++j)
+    {
+      const u32 index = index16 ? Common::swap16(indices + j * 2) : indices[j];
+      // Vertices with a position index of all ones are skipped
+      if (is_position && index == (index16 ? 0xFFFFu : 0xFFu))
+        continue;
+      range.min_index = std::min(range.min_index, index);
+      range.max_index = std::max(range.max_index, index);
+    }
+  }
+  return range;
+}
+}  // namespace
+
+int VertexDataCache::RunVertices(VertexLoaderBase* loader, const TVtxDesc& vtx_desc,
+                                 const VAT& vtx_attr, const u8* src, u8* dst, int count)
+{
+  const Key key{loader, Hash(vtx_desc, vtx_attr, src, loader->m_vertex_size, count), count};
+  const u32 stride = loader->m_native_vtx_decl.stride;
+
+  if (const auto it = m_entries.find(key); it != m_entries.end())
+  {
+    std::memcpy(dst, it->second.data.data(), it->second.data.size());
+    RestoreLoaderCaches(vtx_desc, vtx_attr, count, it->second);
+    loader->m_numLoadedVertices += count;
+    INCSTAT(g_stats.this_frame.num_vertex_data_cache_hits);
+    return count;
+  }
+
+  const int num_loaded = loader->RunVertices(src, dst, count);
+
+  // Which of the loader's caches are written is harder to tell when vertices were skipped.
+  // Leave such draws alone, they are rare.
+  if (num_loaded != count)
+    return num_loaded;
+
+  if (m_seen_once.insert(key).second)
+  {
+    if (m_seen_once.size() > MAX_SEEN_ONCE)
+      m_seen_once.clear();
+    return num_loaded;
+  }
+  m_seen_once.erase(key);
+
+  const size_t size = static_cast<size_t>(count) * stride;
+  if (m_size + size > MAX_CACHE_SIZE)
+    Clear();
+
+  Entry& entry = m_entries[key];
+  entry.data.assign(dst, dst + size);
+  SaveLoaderCaches(&entry);
+  m_size += size;
+  return num_loaded;
+}
+
+void VertexDataCache::Clear()
+{
+  m_entries.clear();
+  m_seen_once.clear();
+  m_size = 0;
+}
+
+u64 VertexDataCache::Hash(const TVtxDesc& vtx_desc, const VAT& vtx_attr, const u8* src,
+                          u32 vertex_size, int count)
+{
+  // The hash of the vertex data, followed by the base, stride and hash of every array it reads
+  std::array<u64, 1 + 3 * 12> hashes;
+  size_t num_hashes = 0;
+  hashes[num_hashes++] = Common::GetXXH3Hash64(src, static_cast<size_t>(vertex_size) * count);
+
+  const auto hash_array = [&](CPArray array, u32 offset, VertexComponentFormat format,
+                              u32 num_indices, u32 element_size, bool is_position) {
+    const ArrayRange range =
+        GetArrayRange(src, vertex_size, count, offset, format, num_indices, is_position);
+    if (range.min_index > range.max_index)
+      return;
+
+    const u8* base = VertexLoaderManager::cached_arraybases[array];
+    const u32 array_stride = g_main_cp_state.array_strides[array];
+    const u8* start = base + static_cast<size_t>(range.min_index) * array_stride;
+    const size_t size =
+        static_cast<size_t>(range.max_index - range.min_index) * array_stride + element_size;
+    hashes[num_hashes++] = reinterpret_cast<uintptr_t>(base);
+    hashes[num_hashes++] = array_stride;
+    hashes[num_hashes++] = Common::GetXXH3Hash64(start, size);
+  };
+
+  // Attributes are in the same order as in VertexLoaderBase::GetVertexSize
+  u32 offset = std::popcount(vtx_desc.low.Hex & 0x1FF);
+
+  const auto pos_format = vtx_attr.g0.PosFormat.Value();
+  const auto pos_elements = vtx_attr.g0.PosElements.Value();
+  if (IsIndexed(vtx_desc.low.Position))
+  {
+    hash_array(CPArray::Position, offset, vtx_desc.low.Position, 1,
+               VertexLoader_Position::GetSize(VertexComponentFormat::Direct, pos_format,
+                                              pos_elements),
+               true);
+  }
+  offset += VertexLoader_Position::GetSize(vtx_desc.low.Position, pos_format, pos_elements);
+
+  const auto normal_format = vtx_attr.g0.NormalFormat.Value();
+  const auto normal_elements = vtx_attr.g0.NormalElements.Value();
+  const bool normal_index3 = vtx_attr.g0.NormalIndex3;
+  if (IsIndexed(vtx_desc.low.Normal))
+  {
+    const bool index3 = normal_index3 && normal_elements == NormalComponentCount::NTB;
+    hash_array(CPArray::Normal, offset, vtx_desc.low.Normal, index3 ? 3 : 1,
+               VertexLoader_Normal::GetSize(VertexComponentFormat::Direct, normal_format,
+                                            normal_elements, false),
+               false);
+  }
+  offset += VertexLoader_Normal::GetSize(vtx_desc.low.Normal, normal_format, normal_elements,
+                                         normal_index3);
+
+  for (u32 i = 0; i < vtx_desc.low.Color.Size(); i++)
+  {
+    const ColorFormat color_format = vtx_attr.GetColorFormat(i);
+    if (IsIndexed(vtx_desc.low.Color[i]))
+    {
+      hash_array(CPArray::Color0 + i, offset, vtx_desc.low.Color[i], 1,
+                 VertexLoader_Color::GetSize(VertexComponentFormat::Direct, color_format), false);
+    }
+    offset += VertexLoader_Color::GetSize(vtx_desc.low.Color[i], color_format);
+  }
+
+  for (u32 i = 0; i < vtx_desc.high.TexCoord.Size(); i++)
+  {
+    const ComponentFormat tex_format = vtx_attr.GetTexFormat(i);
+    const TexComponentCount tex_elements = vtx_attr.GetTexElements(i);
+    if (IsIndexed(vtx_desc.high.TexCoord[i]))
+    {
+      hash_array(CPArray::TexCoord0 + i, offset, vtx_desc.high.TexCoord[i], 1,
+                 VertexLoader_TextCoord::GetSize(VertexComponentFormat::Direct, tex_format,
+                                                 tex_elements),
+                 false);
+    }
+    offset +=
+        VertexLoader_TextCoord::GetSize(vtx_desc.high.TexCoord[i], tex_format, tex_elements);
+  }
+
+  if (num_hashes == 1)
+    return hashes[0];
+  return Common::GetXXH3Hash64(reinterpret_cast<const u8*>(hashes.data()),
+                               num_hashes * sizeof(u64));
+}
+
+// The vertex loaders store the positions (and position matrix indices) of the last three vertices
+// and the normals of the last vertex, for zfreeze and for drawing without normals. Only the ones
+// which are present in the vertex format are written.
+
+void VertexDataCache::SaveLoaderCaches(Entry* entry)
+{
+  entry->position_cache = VertexLoaderManager::position_cache;
+  entry->position_matrix_index_cache = VertexLoaderManager::position_matrix_index_cache;
+  entry->normal_cache = VertexLoaderManager::normal_cache;
+  entry->tangent_cache = VertexLoaderManager::tangent_cache;
+  entry->binormal_cache = VertexLoaderManager::binormal_cache;
+}
+
+void VertexDataCache::RestoreLoaderCaches(const TVtxDesc& vtx_desc, const VAT& vtx_attr,
+                                          int count, const Entry& entry)
+{
+  const int num_positions = std::min(count, 3);
+  std::copy_n(entry.position_cache.begin(), num_positions,
+              VertexLoaderManager::position_cache.begin());
+  if (vtx_desc.low.PosMatIdx)
+  {
+    std::copy_n(entry.position_matrix_index_cache.begin(), num_positions,
+                VertexLoaderManager::position_matrix_index_cache.begin());
+  }
+  if (vtx_desc.low.Normal != VertexComponentFormat::NotPresent)
+  {
+    VertexLoaderManager::normal_cache = entry.normal_cache;
+    if (vtx_attr.g0.NormalElements == NormalComponentCount::NTB)
+    {
+      VertexLoaderManager::tangent_cache = entry.tangent_cache;
+      VertexLoaderManager::binormal_cache = entry.binormal_cache;
+    }
+  }
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+
+class VertexLoaderBase;
+
+// Keeps the output of the vertex loaders for vertex data which is drawn again and again, such as
+// display lists which are called every frame, so that it can be copied instead of converted again.
+//
+// Entries are looked up by a hash of the raw vertex data and of the parts of the vertex arrays
+// which its indices refer to. Changes to either are therefore noticed without having to track
+// writes to memory, the same way the texture cache notices changed textures.
+class VertexDataCache
+{
+public:
+  // Converts count vertices from src to dst like loader->RunVertices, which must have been created
+  // for vtx_desc and vtx_attr. Returns the number of vertices written to dst.
+  int RunVertices(VertexLoaderBase* loader, const TVtxDesc& vtx_desc, const VAT& vtx_attr,
+                  const u8* src, u8* dst, int count);
+
+  void Clear();
+
+private:
+  struct Key
+  {
+    const VertexLoaderBase* loader;
+    u64 hash;
+    int count;
+
+    bool operator==(const Key&) const = default;
+  };
+
+  struct KeyHash
+  {
+    size_t operator()(const Key& key) const noexcept { return static_cast<size_t>(key.hash); }
+  };
+
+  struct Entry
+  {
+    std::vector<u8> data;
+
+    // The values the vertex loader leaves in VertexLoaderManager's caches
+    std::array<std::array<float, 4>, 3> position_cache;
+    std::array<u32, 3> position_matrix_index_cache;
+    std::array<float, 4> normal_cache;
+    std::array<float, 4> tangent_cache;
+    std::array<float, 4> binormal_cache;
+  };
+
+  static u64 Hash(const TVtxDesc& vtx_desc, const VAT& vtx_attr, const u8* src, u32 vertex_size,
+                  int count);
+  static void SaveLoaderCaches(Entry* entry);
+  static void RestoreLoaderCaches(const TVtxDesc& vtx_desc, const VAT& vtx_attr, int count,
+                                  const Entry& entry);
+
+  std::unordered_map<Key, Entry, KeyHash> m_entries;
+  // Vertex data is only added to the cache once it is seen for the second time, so data which is
+  // written to the FIFO for every draw isn't copied for nothing.
+  std::unordered_set<Key, KeyHash> m_seen_once;
+  size_t m_size = 0;
+};
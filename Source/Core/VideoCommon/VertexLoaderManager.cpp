@@ -27,6 +27,7 @@
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexDataCache.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
@@ -50,6 +51,8 @@ u32 g_current_components;
 typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
 static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
+// Main only
+static VertexDataCache s_vertex_data_cache;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
@@ -74,6 +77,7 @@ void Clear()
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
+  s_vertex_data_cache.Clear();
 }
 
 void UpdateVertexArrayPointers()
@@ -431,18 +435,19 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
                                             loader->m_native_vertex_format->GetVertexDeclaration());
     }
 
-    // CPUCull's performance increase comes from encoding fewer GPU commands, not sending less data
-    // Therefore it's only useful to check if culling could remove a flush
-    bool can_cpu_cull = g_ActiveConfig.bCPUCull &&
-                        primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES &&
-                        !g_vertex_manager->HasSendableVertices();
-
     // if cull mode is CULL_ALL, tell VertexManager to skip triangles and quads.
     // They still need to go through vertex loading, because we need to calculate a zfreeze
     // reference slope.
     const bool cullall = (bpmem.genMode.cull_mode == CullMode::All &&
                           primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
 
+    // CPUCull leaves the offscreen and backfacing triangles out of the index buffer. The biggest
+    // win is when all of them are culled and nothing else is waiting to be sent, as that saves
+    // encoding a draw and possibly a flush, so the vertices are loaded to the CPU buffer then.
+    const bool cpu_cull = g_ActiveConfig.bCPUCull && !cullall &&
+                          primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES;
+    bool can_cpu_cull_all = cpu_cull && !g_vertex_manager->HasSendableVertices();
+
     const int stride = loader->m_native_vtx_decl.stride;
     do
     {
@@ -450,24 +455,47 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
       const int run = CanSplit(primitive) && count > max_vertices ? max_vertices : count;
       count -= run;
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
-                                                                  cullall || can_cpu_cull);
+                                                                  cullall || can_cpu_cull_all);
+
+      // When culling all is possible, dst is in CPU memory already. Otherwise it is the buffer
+      // sent to the GPU, which the culling shouldn't read from, so load to a CPU one first.
+      // The SSE vertex loader can write up to 4 bytes past the end.
+      u8* const load_dst = cpu_cull && !can_cpu_cull_all ?
+                               g_vertex_manager->GetCPUCullVertexBuffer(run * stride + 4) :
+                               dst.GetPointer();
 
-      const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      int num_loaded;
+      {
+        ScopedStageTimer timer(&g_stats.stage_times.vertex_loader_ns);
+        num_loaded = g_ActiveConfig.bVertexDataCache ?
+                         s_vertex_data_cache.RunVertices(loader, g_main_cp_state.vtx_desc,
+                                                         g_main_cp_state.vtx_attr[vtx_attr_group],
+                                                         src, load_dst, run) :
+                         loader->RunVertices(src, load_dst, run);
+      }
       src += loader->m_vertex_size * max_vertices;
 
-      if (can_cpu_cull && !cullall)
+      if (cpu_cull)
       {
-        const bool all_culled =
-            g_vertex_manager->AreAllVerticesCulled(loader, primitive, dst.GetPointer(), num_loaded);
-        if (!all_culled)
+        const bool any_visible =
+            g_vertex_manager->CullTriangles(loader, primitive, load_dst, num_loaded);
+        if (any_visible && can_cpu_cull_all)
         {
           DataReader new_dst = g_vertex_manager->DisableCullAll(stride);
-          memmove(new_dst.GetPointer(), dst.GetPointer(), num_loaded * stride);
-          can_cpu_cull = false;
+          memmove(new_dst.GetPointer(), load_dst, num_loaded * stride);
+          can_cpu_cull_all = false;
         }
+        else if (load_dst != dst.GetPointer())
+        {
+          // Copy them even if all were culled, CalculateZSlope reads the last ones from dst.
+          memcpy(dst.GetPointer(), load_dst, num_loaded * stride);
+        }
+        g_vertex_manager->AddUnculledIndices(primitive, num_loaded);
+      }
+      else
+      {
+        g_vertex_manager->AddIndices(primitive, num_loaded);
       }
-
-      g_vertex_manager->AddIndices(primitive, num_loaded);
       g_vertex_manager->FlushData(num_loaded, stride);
 
       ADDSTAT(g_stats.this_frame.num_prims, num_loaded);
@@ -136,14 +136,40 @@ u32 VertexManagerBase::GetRemainingSize() const
 
 void VertexManagerBase::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices)
 {
+  ScopedStageTimer timer(&g_stats.stage_times.index_generator_ns);
   m_index_generator.AddIndices(primitive, num_vertices);
 }
 
-bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
-                                             OpcodeDecoder::Primitive primitive, const u8* src,
-                                             u32 count)
+bool VertexManagerBase::CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                                      const u8* src, u32 count)
 {
-  return m_cpu_cull.AreAllVerticesCulled(loader, primitive, src, count);
+  m_num_cpu_culled_triangles = m_cpu_cull.CullTriangles(loader, primitive, src, count);
+  return !m_cpu_cull.GetVisibleTriangles().empty();
+}
+
+u8* VertexManagerBase::GetCPUCullVertexBuffer(u32 size)
+{
+  if (m_cpu_cull_vertex_buffer.size() < size) [[unlikely]]
+    m_cpu_cull_vertex_buffer.resize(size);
+  return m_cpu_cull_vertex_buffer.data();
+}
+
+void VertexManagerBase::AddUnculledIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices)
+{
+  ScopedStageTimer timer(&g_stats.stage_times.index_generator_ns);
+  const std::span<const u16> visible = m_cpu_cull.GetVisibleTriangles();
+  const u32 index_len = m_index_generator.GetTriangleIndexLen(static_cast<u32>(visible.size() / 3));
+
+  // With primitive restart, a list of triangles takes more indices than strips and fans do, and
+  // may not fit into the space PrepareForAdditionalData made sure there is.
+  if (m_num_cpu_culled_triangles == 0 ||
+      index_len > MAXIBUFFERSIZE - m_index_generator.GetIndexLen())
+  {
+    m_index_generator.AddIndices(primitive, num_vertices);
+    return;
+  }
+
+  m_index_generator.AddTriangles(visible.data(), static_cast<u32>(visible.size()), num_vertices);
 }
 
 DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive primitive,
@@ -797,6 +823,8 @@ void VertexManagerBase::CalculateNormals(NativeVertexFormat* format)
 
 void VertexManagerBase::UpdatePipelineConfig()
 {
+  ScopedStageTimer timer(&g_stats.stage_times.pipeline_uid_ns);
+
   NativeVertexFormat* vertex_format = VertexLoaderManager::GetCurrentVertexFormat();
   if (vertex_format != m_current_pipeline_config.vertex_format)
   {
@@ -108,8 +108,14 @@ public:
 
   PrimitiveType GetCurrentPrimitiveType() const { return m_current_primitive_type; }
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
-  bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                            const u8* src, u32 count);
+  // Culls the triangles of the primitive on the CPU. Returns false if all of them were culled.
+  bool CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive, const u8* src,
+                     u32 count);
+  // Returns CPU memory to load vertices to before culling them. The buffer returned by
+  // PrepareForAdditionalData may be write-combined, which makes reading them back slow.
+  u8* GetCPUCullVertexBuffer(u32 size);
+  // Adds indices for the triangles which were not culled by the last call to CullTriangles
+  void AddUnculledIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
   virtual DataReader PrepareForAdditionalData(OpcodeDecoder::Primitive primitive, u32 count,
                                               u32 stride, bool cullall);
   /// Switch cullall off after a call to PrepareForAdditionalData with cullall true
@@ -203,6 +209,8 @@ protected:
   // Alternative buffers in CPU memory for primitives we are going to discard.
   std::vector<u8> m_cpu_vertex_buffer;
   std::vector<u16> m_cpu_index_buffer;
+  // Vertices to be culled on the CPU, before they are copied to the buffer sent to the GPU.
+  std::vector<u8> m_cpu_cull_vertex_buffer;
 
   Slope m_zslope = {};
 
@@ -218,6 +226,7 @@ protected:
 
   IndexGenerator m_index_generator;
   CPUCull m_cpu_cull;
+  u32 m_num_cpu_culled_triangles = 0;
 
 private:
   // Minimum number of draws per command buffer when attempting to preempt a readback operation.
@@ -0,0 +1,192 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "AudioCommon/Enums.h"
+#include "AudioCommon/Resampler.h"
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+
+using AudioCommon::Resampler;
+using AudioCommon::ResamplingQuality;
+
+namespace
+{
+constexpr ResamplingQuality QUALITIES[] = {ResamplingQuality::Low, ResamplingQuality::Medium,
+                                           ResamplingQuality::High};
+
+class ScopedCPUFeatures
+{
+public:
+  explicit ScopedCPUFeatures(bool avx2) : m_avx2(cpu_info.bAVX2)
+  {
+    cpu_info.bAVX2 = m_avx2 && avx2;
+  }
+  ~ScopedCPUFeatures() { cpu_info.bAVX2 = m_avx2; }
+
+  ScopedCPUFeatures(const ScopedCPUFeatures&) = delete;
+  ScopedCPUFeatures& operator=(const ScopedCPUFeatures&) = delete;
+
+private:
+  bool m_avx2;
+};
+
+// A sine wave with a different phase on each channel, with room for the padding the resampler
+// needs on either side
+std::vector<float> CreateSine(double frequency, u32 sample_rate, u32 num_frames)
+{
+  std::vector<float> input(2 * (num_frames + 2 * Resampler::PADDING));
+  for (u32 i = 0; i < input.size() / 2; ++i)
+  {
+    const double phase = 2 * std::numbers::pi * frequency * (double(i) - Resampler::PADDING) /
+                         sample_rate;
+    input[2 * i] = static_cast<float>(std::sin(phase) * 16384);
+    input[2 * i + 1] = static_cast<float>(std::cos(phase) * 16384);
+  }
+  return input;
+}
+
+// Resamples an input created by CreateSine. Positions only have room for 256 frames, so this is
+// done a few frames at a time, the way the mixer does it.
+std::vector<float> Resample(const Resampler& resampler, const std::vector<float>& input,
+                            u32 in_rate, u32 out_rate)
+{
+  const u64 step = (u64{in_rate} << Resampler::FRAC_BITS) / out_rate;
+  const u64 end = u64{static_cast<u32>(input.size() / 2 - 2 * Resampler::PADDING)}
+                  << Resampler::FRAC_BITS;
+
+  std::vector<float> output;
+  for (u64 position = 0; position < end;)
+  {
+    const u64 frame = position >> Resampler::FRAC_BITS;
+    const std::size_t count = std::min<u64>(64, (end - position + step - 1) / step);
+    const std::size_t offset = output.size();
+    output.resize(offset + 2 * count);
+    resampler.Resample(&input[2 * (frame + Resampler::PADDING)],
+                       static_cast<u32>(position - (frame << Resampler::FRAC_BITS)),
+                       static_cast<u32>(step), count, &output[offset]);
+    position += step * count;
+  }
+  return output;
+}
+
+// How far the resampled sine wave is from the real one, in dB. The ends are left out, as the
+// input has no signal in its padding.
+double SignalToNoiseRatio(ResamplingQuality quality, double frequency)
+{
+  constexpr u32 IN_RATE = 32000;
+  constexpr u32 OUT_RATE = 48000;
+
+  Resampler resampler;
+  resampler.Configure(quality, double(OUT_RATE) / IN_RATE);
+  const std::vector<float> output =
+      Resample(resampler, CreateSine(frequency, IN_RATE, 4096), IN_RATE, OUT_RATE);
+
+  const u64 step = (u64{IN_RATE} << Resampler::FRAC_BITS) / OUT_RATE;
+  double signal = 0;
+  double noise = 0;
+  for (std::size_t i = 64; i < output.size() / 2 - 64; ++i)
+  {
+    const double position = double(i * step) / (1 << Resampler::FRAC_BITS);
+    const double phase = 2 * std::numbers::pi * frequency * position / IN_RATE;
+    const double expected[] = {std::sin(phase) * 16384, std::cos(phase) * 16384};
+    for (int channel = 0; channel < 2; ++channel)
+    {
+      signal += expected[channel] * expected[channel];
+      noise += (output[2 * i + channel] - expected[channel]) *
+               (output[2 * i + channel] - expected[channel]);
+    }
+  }
+  return 10 * std::log10(signal / noise);
+}
+}  // namespace
+
+TEST(Resampler, KeepsConstantSignal)
+{
+  const std::vector<float> input(2 * (256 + 2 * Resampler::PADDING), 1000.0f);
+  for (ResamplingQuality quality : QUALITIES)
+  {
+    Resampler resampler;
+    resampler.Configure(quality, 1.5);
+    std::vector<float> output(2 * 100);
+    resampler.Resample(&input[2 * Resampler::PADDING], 0x12345, 0x1234567, 100, output.data());
+    for (float sample : output)
+      EXPECT_NEAR(sample, 1000.0f, 0.01f) << "Quality " << static_cast<int>(quality);
+  }
+}
+
+TEST(Resampler, VectorizedVersionsMatch)
+{
+  const std::vector<float> input = CreateSine(5000, 32000, 256);
+  for (ResamplingQuality quality : QUALITIES)
+  {
+    for (double ratio : {0.7, 1.5})
+    {
+      Resampler resampler;
+      resampler.Configure(quality, ratio);
+
+      std::vector<float> outputs[2];
+      for (bool avx2 : {false, true})
+      {
+        ScopedCPUFeatures features(avx2);
+        outputs[avx2] = Resample(resampler, input, 32000, static_cast<u32>(32000 * ratio));
+      }
+
+      ASSERT_EQ(outputs[0].size(), outputs[1].size());
+      for (std::size_t i = 0; i < outputs[0].size(); ++i)
+        ASSERT_NEAR(outputs[0][i], outputs[1][i], 0.01f) << "Sample " << i;
+    }
+  }
+}
+
+// The sinc filters have to be better than the Hermite interpolation for everything but the
+// highest frequencies, which they cut off on purpose.
+TEST(Resampler, Quality)
+{
+  EXPECT_GT(SignalToNoiseRatio(ResamplingQuality::Low, 1000), 100.0);
+  EXPECT_GT(SignalToNoiseRatio(ResamplingQuality::Medium, 1000), 80.0);
+  EXPECT_GT(SignalToNoiseRatio(ResamplingQuality::High, 1000), 95.0);
+
+  EXPECT_GT(SignalToNoiseRatio(ResamplingQuality::Medium, 8000),
+            SignalToNoiseRatio(ResamplingQuality::Low, 8000));
+  EXPECT_GT(SignalToNoiseRatio(ResamplingQuality::High, 8000),
+            SignalToNoiseRatio(ResamplingQuality::Medium, 8000));
+  EXPECT_GT(SignalToNoiseRatio(ResamplingQuality::High, 12000), 70.0);
+}
+
+// Prints the quality and the speed of every resampler, for 32 kHz to 48 kHz.
+// Run with --gtest_also_run_disabled_tests.
+TEST(Resampler, DISABLED_Benchmark)
+{
+  using Clock = std::chrono::steady_clock;
+  constexpr u32 ITERATIONS = 200;
+
+  for (ResamplingQuality quality : QUALITIES)
+  {
+    fmt::print("Quality {}: SNR {:.1f} dB at 1 kHz, {:.1f} dB at 8 kHz, {:.1f} dB at 12 kHz\n",
+               static_cast<int>(quality), SignalToNoiseRatio(quality, 1000),
+               SignalToNoiseRatio(quality, 8000), SignalToNoiseRatio(quality, 12000));
+
+    Resampler resampler;
+    resampler.Configure(quality, 1.5);
+    const std::vector<float> input = CreateSine(1000, 32000, 4096);
+    for (bool avx2 : {true, false})
+    {
+      ScopedCPUFeatures features(avx2);
+      std::size_t frames = 0;
+      const Clock::time_point start = Clock::now();
+      for (u32 i = 0; i < ITERATIONS; ++i)
+        frames += Resample(resampler, input, 32000, 48000).size() / 2;
+      const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+      fmt::print("  AVX2 {}: {:.1f} ns per frame\n", avx2, ns / frames);
+    }
+  }
+}
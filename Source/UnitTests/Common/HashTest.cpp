@@ -0,0 +1,138 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <xxhash.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+
+namespace
+{
+std::vector<u8> GenerateData(size_t size)
+{
+  std::mt19937 rng(size);
+  std::uniform_int_distribution<u32> dist(0, 255);
+  std::vector<u8> data(size);
+  for (u8& byte : data)
+    byte = static_cast<u8>(dist(rng));
+  return data;
+}
+
+// Which XXH3 variant is used is picked by what cpu_info says the CPU can do, so this lowers it for
+// as long as it exists.
+class ScopedCPUFeatures
+{
+public:
+  ScopedCPUFeatures(bool avx512, bool avx2) : m_avx512(cpu_info.bAVX512F), m_avx2(cpu_info.bAVX2)
+  {
+    cpu_info.bAVX512F = m_avx512 && avx512;
+    cpu_info.bAVX2 = m_avx2 && avx2;
+  }
+  ~ScopedCPUFeatures()
+  {
+    cpu_info.bAVX512F = m_avx512;
+    cpu_info.bAVX2 = m_avx2;
+  }
+
+  ScopedCPUFeatures(const ScopedCPUFeatures&) = delete;
+  ScopedCPUFeatures& operator=(const ScopedCPUFeatures&) = delete;
+
+private:
+  bool m_avx512;
+  bool m_avx2;
+};
+
+struct HashVariant
+{
+  const char* name;
+  bool avx512;
+  bool avx2;
+};
+
+constexpr HashVariant VARIANTS[] = {
+    {"AVX-512", true, true},
+    {"AVX2", false, true},
+    {"SSE2", false, false},
+};
+
+// ScopedCPUFeatures can only take features away, so the newer variants are left out on CPUs
+// without them.
+bool IsSupported(const HashVariant& variant)
+{
+  return (!variant.avx512 || cpu_info.bAVX512F) && (!variant.avx2 || cpu_info.bAVX2);
+}
+}  // namespace
+
+TEST(Hash, XXH3MatchesReference)
+{
+  const std::vector<u8> data = GenerateData(0x10000 + 64);
+
+  for (const HashVariant& variant : VARIANTS)
+  {
+    if (!IsSupported(variant))
+      continue;
+    ScopedCPUFeatures features(variant.avx512, variant.avx2);
+
+    // Cover the short input paths, every stripe count of the last block and partial blocks, as
+    // well as unaligned starts.
+    for (size_t len = 0; len <= 3000; ++len)
+    {
+      for (size_t offset : {0, 1, 13})
+      {
+        ASSERT_EQ(Common::GetXXH3Hash64(data.data() + offset, len),
+                  XXH3_64bits(data.data() + offset, len))
+            << variant.name << ", length " << len << ", offset " << offset;
+      }
+    }
+    for (size_t len : {0x1000, 0x8000, 0x10000})
+    {
+      EXPECT_EQ(Common::GetXXH3Hash64(data.data(), len), XXH3_64bits(data.data(), len))
+          << variant.name << ", length " << len;
+    }
+  }
+}
+
+// Not a correctness test, but a rough comparison of hashing throughput at common texture sizes.
+TEST(Hash, DISABLED_TextureHashThroughput)
+{
+  using Clock = std::chrono::steady_clock;
+  constexpr std::array<std::pair<const char*, u32>, 4> sizes{{
+      {"64x64 RGBA8", 64 * 64 * 4},
+      {"256x256 CMPR", 256 * 256 / 2},
+      {"512x512 RGBA8", 512 * 512 * 4},
+      {"1024x1024 RGBA8", 1024 * 1024 * 4},
+  }};
+
+  for (const auto& [name, size] : sizes)
+  {
+    const std::vector<u8> data = GenerateData(size);
+    const u32 iterations = std::max(1u, (256u << 20) / size);
+
+    const auto measure = [&](auto&& hash) {
+      u64 result = 0;
+      const Clock::time_point start = Clock::now();
+      for (u32 i = 0; i < iterations; ++i)
+        result += hash();
+      const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+      EXPECT_NE(result, 1u);  // Keep the hashing from being optimized out
+      return static_cast<double>(size) * iterations / seconds / (1 << 30);
+    };
+
+    // Passing one sample per word makes GetHash64 hash everything with the CRC32 based hash,
+    // which is what whole textures were hashed with before.
+    const double legacy = measure([&] { return Common::GetHash64(data.data(), size, size / 8); });
+    const double reference = measure([&] { return XXH3_64bits(data.data(), size); });
+    const double dispatched = measure([&] { return Common::GetXXH3Hash64(data.data(), size); });
+    fmt::print("{}: CRC32 {:.1f} GiB/s, XXH3 {:.1f} GiB/s, XXH3 (host SIMD) {:.1f} GiB/s\n", name,
+               legacy, reference, dispatched);
+  }
+}
@@ -0,0 +1,234 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <chrono>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/IndexedDiskCache.h"
+#include "Common/LinearDiskCache.h"
+
+namespace
+{
+struct Key
+{
+  u32 id;
+  u32 variant;
+};
+
+using Cache = Common::IndexedDiskCache<Key, u8>;
+
+std::vector<u8> MakeValue(u32 id, u32 size)
+{
+  std::vector<u8> value(size);
+  std::iota(value.begin(), value.end(), static_cast<u8>(id));
+  return value;
+}
+
+bool HasValue(Cache& cache, u32 id, u32 size)
+{
+  const std::optional<std::span<const u8>> value = cache.Lookup({id, 0});
+  const std::vector<u8> expected = MakeValue(id, size);
+  return value && std::ranges::equal(*value, expected);
+}
+}  // namespace
+
+class IndexedDiskCacheTest : public testing::Test
+{
+protected:
+  IndexedDiskCacheTest()
+      : m_directory(File::CreateTempDir()), m_path(m_directory + "/cache.cache")
+  {
+  }
+  ~IndexedDiskCacheTest() override { File::DeleteDirRecursively(m_directory); }
+
+  void AppendValues(Cache& cache, u32 first_id, u32 count, u32 size)
+  {
+    for (u32 id = first_id; id < first_id + count; ++id)
+    {
+      const std::vector<u8> value = MakeValue(id, size);
+      cache.Append({id, 0}, value.data(), static_cast<u32>(value.size()));
+    }
+  }
+
+  std::string m_directory;
+  std::string m_path;
+};
+
+TEST_F(IndexedDiskCacheTest, Reopen)
+{
+  {
+    Cache cache;
+    EXPECT_EQ(cache.Open(m_path), 0u);
+    AppendValues(cache, 0, 100, 300);
+    EXPECT_TRUE(HasValue(cache, 42, 300));
+    EXPECT_FALSE(cache.Lookup({100, 0}));
+  }
+
+  Cache cache;
+  ASSERT_EQ(cache.Open(m_path), 100u);
+  for (u32 id = 0; id < 100; ++id)
+    EXPECT_TRUE(HasValue(cache, id, 300)) << id;
+
+  // Appending to an indexed file, and replacing values.
+  AppendValues(cache, 50, 100, 10);
+  const std::vector<u8> empty;
+  cache.Append({7, 0}, empty.data(), 0);
+  cache.Close();
+
+  ASSERT_EQ(cache.Open(m_path), 150u);
+  EXPECT_TRUE(HasValue(cache, 49, 300));
+  EXPECT_TRUE(HasValue(cache, 50, 10));
+  EXPECT_TRUE(HasValue(cache, 149, 10));
+  ASSERT_TRUE(cache.Lookup({7, 0}));
+  EXPECT_TRUE(cache.Lookup({7, 0})->empty());
+}
+
+TEST_F(IndexedDiskCacheTest, RecoversWithoutIndex)
+{
+  {
+    Cache cache;
+    cache.Open(m_path);
+    AppendValues(cache, 0, 10, 100);
+    cache.Close();
+
+    // Simulate a crash after appending more values, with the last one cut off.
+    cache.Open(m_path);
+    AppendValues(cache, 10, 10, 100);
+    cache.Sync();
+    File::Copy(m_path, m_path + ".crashed");
+  }
+
+  File::IOFile file(m_path + ".crashed", "r+b");
+  ASSERT_TRUE(file.Resize(file.GetSize() - 50));
+  file.Close();
+
+  Cache cache;
+  ASSERT_EQ(cache.Open(m_path + ".crashed"), 19u);
+  EXPECT_TRUE(HasValue(cache, 5, 100));
+  EXPECT_TRUE(HasValue(cache, 18, 100));
+  EXPECT_FALSE(cache.Lookup({19, 0}));
+
+  // The cut off record is overwritten by the next one.
+  AppendValues(cache, 19, 1, 100);
+  cache.Close();
+  ASSERT_EQ(cache.Open(m_path + ".crashed"), 20u);
+  EXPECT_TRUE(HasValue(cache, 19, 100));
+}
+
+TEST_F(IndexedDiskCacheTest, RecreatesInvalidFiles)
+{
+  File::WriteStringToFile(m_path, "DCAC is not the right format");
+
+  Cache cache;
+  EXPECT_EQ(cache.Open(m_path), 0u);
+  AppendValues(cache, 0, 1, 16);
+  cache.Close();
+  EXPECT_EQ(cache.Open(m_path), 1u);
+}
+
+TEST_F(IndexedDiskCacheTest, Compact)
+{
+  Cache cache;
+  cache.Open(m_path);
+  for (u32 round = 0; round < 4; ++round)
+    AppendValues(cache, 0, 64, 0x4000);
+  cache.Close();
+  const u64 size_before = File::GetSize(m_path);
+
+  // Three quarters of the file are superseded values, so opening it compacts it.
+  ASSERT_EQ(cache.Open(m_path), 64u);
+  cache.Close();
+  EXPECT_LT(File::GetSize(m_path), size_before / 3);
+
+  ASSERT_EQ(cache.Open(m_path), 64u);
+  for (u32 id = 0; id < 64; ++id)
+    EXPECT_TRUE(HasValue(cache, id, 0x4000)) << id;
+}
+
+TEST_F(IndexedDiskCacheTest, ConcurrentAppend)
+{
+  Cache cache;
+  cache.Open(m_path);
+
+  std::array<std::thread, 4> threads;
+  for (u32 i = 0; i < threads.size(); ++i)
+  {
+    threads[i] = std::thread([this, &cache, i] {
+      AppendValues(cache, i * 1000, 200, 100 + i);
+      for (u32 id = i * 1000; id < i * 1000 + 200; ++id)
+        EXPECT_TRUE(HasValue(cache, id, 100 + i));
+    });
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+  cache.Close();
+
+  ASSERT_EQ(cache.Open(m_path), 800u);
+  EXPECT_TRUE(HasValue(cache, 3199, 103));
+}
+
+// Not a correctness test, but compares how long it takes to open a cache and get one value out of
+// it with LinearDiskCache, which reads every value.
+TEST_F(IndexedDiskCacheTest, DISABLED_StartupTime)
+{
+  using Clock = std::chrono::steady_clock;
+  constexpr u32 NUM_ENTRIES = 4000;
+  constexpr u32 VALUE_SIZE = 16 * 1024;
+
+  class NullReader : public Common::LinearDiskCacheReader<Key, u8>
+  {
+  public:
+    void Read(const Key& key, const u8* value, u32 value_size) override { sum += value[0]; }
+    u32 sum = 0;
+  };
+
+  const std::string linear_path = m_directory + "/linear.cache";
+  {
+    Common::LinearDiskCache<Key, u8> linear_cache;
+    NullReader reader;
+    linear_cache.OpenAndRead(linear_path, reader);
+    Cache cache;
+    cache.Open(m_path);
+    for (u32 id = 0; id < NUM_ENTRIES; ++id)
+    {
+      const std::vector<u8> value = MakeValue(id, VALUE_SIZE);
+      linear_cache.Append({id, 0}, value.data(), VALUE_SIZE);
+      cache.Append({id, 0}, value.data(), VALUE_SIZE);
+    }
+    linear_cache.Close();
+  }
+
+  const Clock::time_point linear_start = Clock::now();
+  {
+    Common::LinearDiskCache<Key, u8> linear_cache;
+    NullReader reader;
+    EXPECT_EQ(linear_cache.OpenAndRead(linear_path, reader), NUM_ENTRIES);
+  }
+  const Clock::duration linear_time = Clock::now() - linear_start;
+
+  const Clock::time_point indexed_start = Clock::now();
+  {
+    Cache cache;
+    EXPECT_EQ(cache.Open(m_path), NUM_ENTRIES);
+    EXPECT_TRUE(HasValue(cache, NUM_ENTRIES / 2, VALUE_SIZE));
+  }
+  const Clock::duration indexed_time = Clock::now() - indexed_start;
+
+  const auto ms = [](Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  };
+  fmt::print("LinearDiskCache: {:.2f} ms to open {} entries\n", ms(linear_time), NUM_ENTRIES);
+  fmt::print("IndexedDiskCache: {:.2f} ms to open {} entries\n", ms(indexed_time), NUM_ENTRIES);
+}
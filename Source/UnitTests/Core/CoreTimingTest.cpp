@@ -3,10 +3,17 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <bitset>
+#include <chrono>
+#include <random>
 #include <string>
+#include <vector>
 
+#include <fmt/format.h>
+
+#include "Common/ChunkFile.h"
 #include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
 #include "Core/Config/MainSettings.h"
@@ -143,6 +150,104 @@ void FifoCallback(Core::System& system, const u64 userdata, const s64 lateness)
 }
 }  // namespace SharedSlotTest
 
+TEST(CoreTiming, RemoveByHandle)
+{
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+
+  CoreTiming::EventType* cb_a = core_timing.RegisterEvent("callbackA", CallbackTemplate<0>);
+  CoreTiming::EventType* cb_b = core_timing.RegisterEvent("callbackB", CallbackTemplate<1>);
+  CoreTiming::EventType* cb_c = core_timing.RegisterEvent("callbackC", CallbackTemplate<2>);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  const CoreTiming::EventHandle a = core_timing.ScheduleEvent(100, cb_a, CB_IDS[0]);
+  const CoreTiming::EventHandle b1 = core_timing.ScheduleEvent(200, cb_b, CB_IDS[1]);
+  const CoreTiming::EventHandle b2 = core_timing.ScheduleEvent(300, cb_b, CB_IDS[1]);
+  core_timing.ScheduleEvent(400, cb_c, CB_IDS[2]);
+  ASSERT_TRUE(a.IsValid());
+
+  // Only the event the handle refers to is removed, not all events of its type.
+  EXPECT_TRUE(core_timing.RemoveEvent(b1));
+  EXPECT_FALSE(core_timing.RemoveEvent(b1));
+
+  AdvanceAndCheck(system, 0, 200);
+  // Handles of events which already ran are stale.
+  EXPECT_FALSE(core_timing.RemoveEvent(a));
+  EXPECT_FALSE(core_timing.RescheduleEvent(a, 50));
+
+  AdvanceAndCheck(system, 1, 100);
+  EXPECT_FALSE(core_timing.RemoveEvent(b2));
+  AdvanceAndCheck(system, 2, MAX_SLICE_LENGTH);
+
+  // A slot reused by a new event must not be reachable through the handle of the old one.
+  const CoreTiming::EventHandle c = core_timing.ScheduleEvent(100, cb_c, CB_IDS[2]);
+  EXPECT_FALSE(core_timing.RemoveEvent(a));
+  EXPECT_FALSE(core_timing.RemoveEvent(b1));
+  EXPECT_TRUE(core_timing.RemoveEvent(c));
+}
+
+TEST(CoreTiming, RescheduleByHandle)
+{
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+
+  CoreTiming::EventType* cb_a = core_timing.RegisterEvent("callbackA", CallbackTemplate<0>);
+  CoreTiming::EventType* cb_b = core_timing.RegisterEvent("callbackB", CallbackTemplate<1>);
+  CoreTiming::EventType* cb_c = core_timing.RegisterEvent("callbackC", CallbackTemplate<2>);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  const CoreTiming::EventHandle a = core_timing.ScheduleEvent(100, cb_a, CB_IDS[0]);
+  core_timing.ScheduleEvent(200, cb_b, CB_IDS[1]);
+  const CoreTiming::EventHandle c = core_timing.ScheduleEvent(300, cb_c, CB_IDS[2]);
+
+  // C -> B -> A
+  EXPECT_TRUE(core_timing.RescheduleEvent(a, 400));
+  EXPECT_TRUE(core_timing.RescheduleEvent(c, 50));
+
+  AdvanceAndCheck(system, 2, 150);
+  AdvanceAndCheck(system, 1, 200);
+  AdvanceAndCheck(system, 0, MAX_SLICE_LENGTH);
+}
+
+TEST(CoreTiming, RemoveByType)
+{
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+
+  CoreTiming::EventType* cb_a = core_timing.RegisterEvent("callbackA", CallbackTemplate<0>);
+  CoreTiming::EventType* cb_b = core_timing.RegisterEvent("callbackB", CallbackTemplate<1>);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  for (int i = 1; i <= 8; ++i)
+  {
+    core_timing.ScheduleEvent(i * 100, cb_a, CB_IDS[0]);
+    core_timing.ScheduleEvent(i * 100 + 50, cb_b, CB_IDS[1]);
+  }
+  core_timing.RemoveEvent(cb_a);
+
+  for (int i = 1; i < 8; ++i)
+    AdvanceAndCheck(system, 1, 100, 0, i == 1 ? -50 : 0);
+  AdvanceAndCheck(system, 1, MAX_SLICE_LENGTH);
+}
+
 TEST(CoreTiming, SharedSlot)
 {
   using namespace SharedSlotTest;
@@ -393,3 +498,212 @@ TEST(CoreTiming, Overclocking)
   Config::SetCurrent(Config::MAIN_OVERCLOCK, 1.0f);
   AdvanceAndCheck(system, 4, MAX_SLICE_LENGTH);
 }
+
+namespace RunAfterEventsTest
+{
+static CoreTiming::EventType* s_cb_field = nullptr;
+static std::array<u8, 4096> s_state;
+static int s_fields = 0;
+
+static void SaveState(Core::System& system)
+{
+  u8* ptr = s_state.data();
+  PointerWrap p(&ptr, s_state.size(), PointerWrap::Mode::Write);
+  system.GetCoreTiming().DoState(p);
+  EXPECT_TRUE(p.IsWriteMode());
+}
+
+// Mimics the VI event, which captures rewind states before rescheduling itself.
+static void FieldCallback(Core::System& system, const u64 userdata, const s64 lateness)
+{
+  ++s_fields;
+  auto& core_timing = system.GetCoreTiming();
+  core_timing.RunAfterEvents([&system] { SaveState(system); });
+  core_timing.ScheduleEvent(1000 - lateness, s_cb_field);
+}
+}  // namespace RunAfterEventsTest
+
+TEST(CoreTiming, RunAfterEvents)
+{
+  using namespace RunAfterEventsTest;
+
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  s_cb_field = core_timing.RegisterEvent("callbackField", FieldCallback);
+  s_fields = 0;
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  core_timing.ScheduleEvent(1000, s_cb_field);
+  ppc_state.downcount = 0;
+  core_timing.Advance();
+  EXPECT_EQ(1, s_fields);
+
+  // Loading the state saved from the field event must keep that event scheduled.
+  core_timing.ClearPendingEvents();
+  u8* ptr = s_state.data();
+  PointerWrap p(&ptr, s_state.size(), PointerWrap::Mode::Read);
+  core_timing.DoState(p);
+  ASSERT_TRUE(p.IsReadMode());
+
+  ppc_state.downcount = 0;
+  core_timing.Advance();
+  EXPECT_EQ(2, s_fields);
+  EXPECT_EQ(1000, ppc_state.downcount);
+}
+
+// Compares the event queue against a heap of events in a std::vector, which CoreTiming used
+// before, and which can only remove events by rebuilding the heap.
+TEST(CoreTimingEventQueue, MatchesReferenceHeap)
+{
+  CoreTiming::EventType type_a{};
+  CoreTiming::EventType type_b{};
+
+  std::mt19937 rng(4321);
+  std::uniform_int_distribution<s64> time_dist(0, 10000);
+  std::uniform_int_distribution<u32> op_dist(0, 9);
+
+  CoreTiming::EventQueue queue;
+  std::vector<CoreTiming::Event> reference;
+  std::vector<std::pair<CoreTiming::EventHandle, u64>> handles;
+  u64 fifo_order = 0;
+
+  const auto remove_from_reference = [&](u64 order) {
+    std::erase_if(reference, [&](const CoreTiming::Event& e) { return e.fifo_order == order; });
+    std::ranges::make_heap(reference, std::ranges::greater{});
+  };
+
+  for (u32 i = 0; i < 20000; ++i)
+  {
+    const u32 op = op_dist(rng);
+    if (op < 5)
+    {
+      CoreTiming::EventType* type = op % 2 ? &type_a : &type_b;
+      const CoreTiming::Event event{time_dist(rng), fifo_order++, 0, type};
+      handles.emplace_back(queue.Push(event), event.fifo_order);
+      reference.push_back(event);
+      std::ranges::push_heap(reference, std::ranges::greater{});
+    }
+    else if (op < 7 && !handles.empty())
+    {
+      const std::size_t index = rng() % handles.size();
+      const auto [handle, order] = handles[index];
+      const bool queued = std::ranges::any_of(
+          reference, [&](const CoreTiming::Event& e) { return e.fifo_order == order; });
+      ASSERT_EQ(queued, queue.Remove(handle));
+      remove_from_reference(order);
+    }
+    else if (op < 8 && !handles.empty())
+    {
+      auto& [handle, order] = handles[rng() % handles.size()];
+      const auto it = std::ranges::find(reference, order, &CoreTiming::Event::fifo_order);
+      const s64 time = time_dist(rng);
+      ASSERT_EQ(it != reference.end(), queue.Reschedule(handle, time, fifo_order));
+      if (it != reference.end())
+      {
+        CoreTiming::Event event = *it;
+        remove_from_reference(order);
+        event.time = time;
+        event.fifo_order = order = fifo_order;
+        reference.push_back(event);
+        std::ranges::push_heap(reference, std::ranges::greater{});
+      }
+      ++fifo_order;
+    }
+    else if (op < 9 && !reference.empty())
+    {
+      const CoreTiming::Event event = queue.Pop();
+      EXPECT_EQ(reference.front().fifo_order, event.fifo_order);
+      EXPECT_EQ(reference.front().time, event.time);
+      std::ranges::pop_heap(reference, std::ranges::greater{});
+      reference.pop_back();
+    }
+    else if (i % 50 == 0)
+    {
+      const std::size_t removed = queue.RemoveAll(&type_a);
+      EXPECT_EQ(std::erase_if(reference, [&](const CoreTiming::Event& e) {
+                  return e.type == &type_a;
+                }),
+                removed);
+      std::ranges::make_heap(reference, std::ranges::greater{});
+    }
+
+    ASSERT_EQ(reference.size(), queue.size());
+    if (!reference.empty())
+      ASSERT_EQ(reference.front().fifo_order, queue.Top().fifo_order);
+  }
+
+  // Savestates store the events and rebuild the queue from them.
+  std::vector<CoreTiming::Event> events = queue.GetEvents();
+  queue.Assign(std::move(events));
+  ASSERT_EQ(reference.size(), queue.size());
+  while (!queue.empty())
+  {
+    EXPECT_EQ(reference.front().fifo_order, queue.Pop().fifo_order);
+    std::ranges::pop_heap(reference, std::ranges::greater{});
+    reference.pop_back();
+  }
+  EXPECT_EQ(type_a.first_queued_slot, CoreTiming::INVALID_EVENT_SLOT);
+  EXPECT_EQ(type_b.first_queued_slot, CoreTiming::INVALID_EVENT_SLOT);
+}
+
+// Not a correctness test, but a rough comparison of the cost of cancelling events against a heap
+// in a std::vector.
+TEST(CoreTimingEventQueue, DISABLED_Throughput)
+{
+  using Clock = std::chrono::steady_clock;
+  constexpr u32 NUM_TYPES = 64;
+  constexpr u32 NUM_OPERATIONS = 200000;
+
+  // Most subsystems keep one or two events in flight, and cancel and reschedule them whenever the
+  // guest reprograms the hardware they emulate.
+  std::vector<CoreTiming::EventType> types(NUM_TYPES);
+  std::mt19937 rng(8765);
+  std::uniform_int_distribution<s64> time_dist(0, 100000);
+
+  std::vector<CoreTiming::Event> heap;
+  u64 fifo_order = 0;
+  for (u32 i = 0; i < NUM_TYPES * 2; ++i)
+    heap.push_back({time_dist(rng), fifo_order++, 0, &types[i % NUM_TYPES]});
+  std::ranges::make_heap(heap, std::ranges::greater{});
+  CoreTiming::EventQueue queue;
+  queue.Assign(heap);
+
+  const Clock::time_point heap_start = Clock::now();
+  for (u32 i = 0; i < NUM_OPERATIONS; ++i)
+  {
+    CoreTiming::EventType* type = &types[i % NUM_TYPES];
+    std::erase_if(heap, [&](const CoreTiming::Event& e) { return e.type == type; });
+    std::ranges::make_heap(heap, std::ranges::greater{});
+    for (u32 j = 0; j < 2; ++j)
+    {
+      heap.push_back({time_dist(rng), fifo_order++, 0, type});
+      std::ranges::push_heap(heap, std::ranges::greater{});
+    }
+  }
+  const Clock::duration heap_time = Clock::now() - heap_start;
+
+  const Clock::time_point queue_start = Clock::now();
+  for (u32 i = 0; i < NUM_OPERATIONS; ++i)
+  {
+    CoreTiming::EventType* type = &types[i % NUM_TYPES];
+    queue.RemoveAll(type);
+    for (u32 j = 0; j < 2; ++j)
+      queue.Push({time_dist(rng), fifo_order++, 0, type});
+  }
+  const Clock::duration queue_time = Clock::now() - queue_start;
+  EXPECT_EQ(heap.size(), queue.size());
+
+  const auto ns_per_op = [](Clock::duration duration) {
+    return std::chrono::duration<double, std::nano>(duration).count() / NUM_OPERATIONS;
+  };
+  fmt::print("Vector heap: {:.1f} ns/cancel+reschedule\n", ns_per_op(heap_time));
+  fmt::print("EventQueue: {:.1f} ns/cancel+reschedule\n", ns_per_op(queue_time));
+}
@@ -0,0 +1,27 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#define AX_GC
+#include "Core/HW/DSPHLE/UCodes/AXVoice.h"
+
+#include "AXVoiceTest.h"
+
+// The hash of what the voices produced when this test was written. If it changes, so does the
+// audio of every game using AX.
+TEST(AXVoice, GameCubeMatchesGoldenOutput)
+{
+  for (bool avx2 : {true, false})
+  {
+    ScopedCPUFeatures features(avx2);
+    EXPECT_EQ(PlayVoices(1, 32), 0x9E2AC0E748F23D02u) << "AVX2: " << avx2;
+  }
+}
+
+// Voices rendered on worker threads have to sound exactly the same.
+TEST(AXVoice, GameCubeWorkersMatchGoldenOutput)
+{
+  for (u32 num_workers : {1, 3})
+    EXPECT_EQ(PlayVoices(1, 32, num_workers), 0x9E2AC0E748F23D02u) << "Workers: " << num_workers;
+}
@@ -0,0 +1,337 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Shared by the GameCube and the Wii version of the AX voice tests. Like AXVoice.h, this has to be
+// included with either AX_GC or AX_WII defined, after AXVoice.h itself.
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSP.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceWorkers.h"
+#include "Core/System.h"
+
+namespace
+{
+using namespace DSP::HLE;
+
+// Sets up the ARAM of the DSP for as long as it exists, filled with copies of <contents> so that
+// reads past its end wrap around. Random bytes are as good as anything else for all three sample
+// formats.
+class ScopedARAM
+{
+public:
+  explicit ScopedARAM(const std::vector<u8>& contents)
+      : m_dsp(Core::System::GetInstance().GetDSP())
+  {
+    m_dsp.Reinit(true);
+    u8* const aram = m_dsp.GetARAMPtr();
+    for (u32 i = 0; i < m_dsp.GetARAMSize(); ++i)
+      aram[i] = contents[i % contents.size()];
+  }
+  ~ScopedARAM() { m_dsp.Shutdown(); }
+
+  ScopedARAM(const ScopedARAM&) = delete;
+  ScopedARAM& operator=(const ScopedARAM&) = delete;
+
+  DSP::DSPManager& GetDSP() const { return m_dsp; }
+
+private:
+  DSP::DSPManager& m_dsp;
+};
+
+// Which of the SIMD kernels are used is picked by what cpu_info says the CPU can do, so this
+// lowers it for as long as it exists.
+class ScopedCPUFeatures
+{
+public:
+  explicit ScopedCPUFeatures(bool avx2) : m_avx2(cpu_info.bAVX2)
+  {
+    cpu_info.bAVX2 = m_avx2 && avx2;
+  }
+  ~ScopedCPUFeatures() { cpu_info.bAVX2 = m_avx2; }
+
+  ScopedCPUFeatures(const ScopedCPUFeatures&) = delete;
+  ScopedCPUFeatures& operator=(const ScopedCPUFeatures&) = delete;
+
+private:
+  bool m_avx2;
+};
+
+// Hashes everything the voices produce, to compare it with what they produced before the voice
+// processing was last changed.
+class Hasher
+{
+public:
+  template <typename T>
+  void Add(const T* data, size_t count)
+  {
+    const u8* bytes = reinterpret_cast<const u8*>(data);
+    for (size_t i = 0; i < count * sizeof(T); ++i)
+      m_hash = (m_hash ^ bytes[i]) * 0x100000001B3;
+  }
+
+  u64 GetHash() const { return m_hash; }
+
+private:
+  u64 m_hash = 0xCBF29CE484222325;
+};
+
+constexpr u32 ARAM_SIZE = 0x10000;
+constexpr u32 NUM_VOICES = 64;
+constexpr u32 NUM_FRAMES = 20;
+
+#ifdef AX_GC
+constexpr u32 NUM_BUFFERS = 9;
+#else
+constexpr u32 NUM_BUFFERS = 12;
+constexpr u32 NUM_WIIMOTE_BUFFERS = 8;
+#endif
+
+// Values are taken straight from the random number generator (and not through a distribution)
+// because those are the same everywhere.
+template <typename T>
+T Random(std::mt19937& rng)
+{
+  return static_cast<T>(rng());
+}
+
+VolumeData RandomVolume(std::mt19937& rng)
+{
+  // Slow ramps as well as ones which wrap around within a frame
+  const u16 delta = rng() % 4 == 0 ? Random<u16>(rng) : Random<u16>(rng) % 0x100 - 0x80;
+  return {Random<u16>(rng), delta};
+}
+
+// All the VolumeData of a mixer
+template <typename Mixer>
+std::span<VolumeData> AsVolumes(Mixer& mixer)
+{
+  return {reinterpret_cast<VolumeData*>(&mixer), sizeof(Mixer) / sizeof(VolumeData)};
+}
+
+PB_TYPE CreateVoice(std::mt19937& rng)
+{
+  // From well below 1 to more than can be read ahead in one go
+  static constexpr u32 RATIOS[] = {0x800, 0x8000, 0xFFFF, 0x10000, 0x15555, 0x3FFFF, 0x40000,
+                                   0x90000};
+  static constexpr u16 SAMPLE_FORMATS[] = {AUDIOFORMAT_ADPCM, AUDIOFORMAT_PCM8, AUDIOFORMAT_PCM16};
+
+  PB_TYPE pb{};
+  pb.running = 1;
+  pb.is_stream = rng() % 2;
+  pb.src_type = rng() % 3;
+  pb.coef_select = rng() % 4;
+
+  for (VolumeData& volume : AsVolumes(pb.mixer))
+    volume = RandomVolume(rng);
+#ifdef AX_GC
+  pb.mixer_control = static_cast<u16>(rng() & 0x3FFFF);
+#else
+  const u32 mixer_control = rng() & 0xFFFFFF;
+  pb.mixer_control_hi = static_cast<u16>(mixer_control >> 16);
+  pb.mixer_control_lo = static_cast<u16>(mixer_control);
+#endif
+
+  const s16 volume_delta = rng() % 4 == 0 ? Random<s16>(rng) : Random<s16>(rng) % 0x100;
+  pb.vol_env = {Random<s16>(rng), volume_delta};
+
+  // Short enough that voices regularly reach the end or loop within a frame
+  const u32 loop_addr = rng() % 0x8000;
+  const u32 end_addr = loop_addr + 0x20 + rng() % 0x400;
+  const u32 cur_addr = loop_addr + rng() % (end_addr - loop_addr);
+  pb.audio_addr = {
+      .looping = static_cast<u16>(rng() % 4 != 0),
+      .sample_format = SAMPLE_FORMATS[rng() % 3],
+      .loop_addr_hi = static_cast<u16>(loop_addr >> 16),
+      .loop_addr_lo = static_cast<u16>(loop_addr),
+      .end_addr_hi = static_cast<u16>(end_addr >> 16),
+      .end_addr_lo = static_cast<u16>(end_addr),
+      .cur_addr_hi = static_cast<u16>(cur_addr >> 16),
+      .cur_addr_lo = static_cast<u16>(cur_addr),
+  };
+
+  for (s16& coef : pb.adpcm.coefs)
+    coef = Random<s16>(rng) / 4;
+  pb.adpcm.gain = rng() % 3 == 0 ? 0x800 : 0;
+  pb.adpcm.pred_scale = Random<u16>(rng) & 0x7F;
+  pb.adpcm.yn1 = Random<s16>(rng);
+  pb.adpcm.yn2 = Random<s16>(rng);
+  pb.adpcm_loop_info = {static_cast<u16>(rng() & 0x7F), Random<u16>(rng), Random<u16>(rng)};
+
+  const u32 ratio = RATIOS[rng() % std::size(RATIOS)];
+  pb.src.ratio_hi = static_cast<u16>(ratio >> 16);
+  pb.src.ratio_lo = static_cast<u16>(ratio);
+  pb.src.cur_addr_frac = Random<u16>(rng);
+  for (s16& sample : pb.src.last_samples)
+    sample = Random<s16>(rng);
+
+  pb.lpf = {static_cast<u16>(rng() % 2), Random<s16>(rng), static_cast<u16>(rng() % 0x8000),
+            static_cast<s16>(rng() % 0x8000)};
+
+#ifdef AX_WII
+  pb.biquad = {.on = static_cast<u16>(rng() % 2),
+               .xn1 = Random<s16>(rng),
+               .xn2 = Random<s16>(rng),
+               .yn1 = Random<s16>(rng),
+               .yn2 = Random<s16>(rng),
+               .b0 = static_cast<s16>(Random<s16>(rng) / 2),
+               .b1 = static_cast<s16>(Random<s16>(rng) / 4),
+               .b2 = static_cast<s16>(Random<s16>(rng) / 4),
+               .a1 = static_cast<s16>(Random<s16>(rng) / 4),
+               .a2 = static_cast<s16>(Random<s16>(rng) / 8)};
+
+  // The Wiimote filters are left off, as they only end up in the same functions as the others.
+  pb.remote = rng() % 2;
+  pb.remote_mixer_control = Random<u16>(rng);
+  for (VolumeData& volume : AsVolumes(pb.remote_mixer))
+    volume = RandomVolume(rng);
+  pb.remote_src.cur_addr_frac = Random<u16>(rng);
+  for (s16& sample : pb.remote_src.last_samples)
+    sample = Random<s16>(rng);
+#endif
+
+  return pb;
+}
+
+// A list of random voices, played with ProcessVoice in frames of <count> samples each. With
+// workers, the voices are played the way the AX ucodes do with HLEVoiceThreads set.
+class VoicePlayer
+{
+public:
+  VoicePlayer(u32 seed, u16 count, u32 num_workers = 0)
+      : m_rng(seed), m_aram(RandomARAM(m_rng)), m_accelerator(m_aram.GetDSP()), m_coeffs(0x800),
+        m_count(count)
+  {
+    for (s16& coef : m_coeffs)
+      coef = Random<s16>(m_rng) / 2;
+    for (u32 i = 0; i < NUM_VOICES; ++i)
+      m_voices.push_back(CreateVoice(m_rng));
+
+    // Large enough for AddThreadBuffers, which always adds a whole frame
+    for (u32 i = 0; i < NUM_BUFFERS; ++i)
+    {
+      m_buffers[i].resize(std::max<u32>(count, THREAD_BUFFER_SIZE));
+#ifdef AX_GC
+      m_buffer_ptrs.ptrs[i] = m_buffers[i].data();
+#else
+      m_buffer_ptrs.regular_ptrs[i] = m_buffers[i].data();
+#endif
+    }
+#ifdef AX_WII
+    for (u32 i = 0; i < NUM_WIIMOTE_BUFFERS; ++i)
+    {
+      m_wiimote_buffers[i].resize(THREAD_WIIMOTE_BUFFER_SIZE);
+      m_buffer_ptrs.wiimote_ptrs[i] = m_wiimote_buffers[i].data();
+    }
+#endif
+
+    m_workers.SetNumWorkers(num_workers);
+    for (u32 i = 0; i < m_workers.GetNumThreads(); ++i)
+      m_thread_accelerators.push_back(std::make_unique<HLEAccelerator>(m_aram.GetDSP()));
+    m_thread_samples.resize(m_workers.GetNumThreads());
+  }
+
+  // Adds the voices after each of them was played, and the mixing buffers at the end, to hasher.
+  void PlayFrame(u32 frame, Hasher& hasher)
+  {
+    // The polyphase filter falls back to linear interpolation without the coefficients from the
+    // DSP ROM.
+    const s16* coeffs = frame % 4 == 3 ? nullptr : m_coeffs.data();
+
+    if (m_workers.GetNumWorkers() == 0)
+    {
+      for (PB_TYPE& pb : m_voices)
+      {
+        PlayVoice(&m_accelerator, pb, m_buffer_ptrs, coeffs, frame);
+        hasher.Add(&pb, 1);
+
+        // Voices which stopped are started again, so that they keep adding to the output.
+        pb.running = 1;
+      }
+    }
+    else
+    {
+      std::vector<AXBuffers> thread_buffers;
+      for (std::vector<int>& samples : m_thread_samples)
+        thread_buffers.push_back(ClearThreadBuffers(samples));
+
+      m_workers.RenderVoices(NUM_VOICES, [&](u32 voice, u32 thread) {
+        PlayVoice(m_thread_accelerators[thread].get(), m_voices[voice], thread_buffers[thread],
+                  coeffs, frame);
+      });
+
+      for (const std::vector<int>& samples : m_thread_samples)
+        AddThreadBuffers(m_buffer_ptrs, samples);
+      for (PB_TYPE& pb : m_voices)
+      {
+        hasher.Add(&pb, 1);
+        pb.running = 1;
+      }
+    }
+
+    for (const std::vector<int>& buffer : m_buffers)
+      hasher.Add(buffer.data(), m_count);
+#ifdef AX_WII
+    for (const std::vector<int>& buffer : m_wiimote_buffers)
+      hasher.Add(buffer.data(), m_count == 96 ? 18 : 6);
+#endif
+  }
+
+private:
+  static ScopedARAM RandomARAM(std::mt19937& rng)
+  {
+    std::vector<u8> contents(ARAM_SIZE);
+    for (u8& byte : contents)
+      byte = Random<u8>(rng);
+    return ScopedARAM(contents);
+  }
+
+  void PlayVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buffers,
+                 const s16* coeffs, u32 frame)
+  {
+#ifdef AX_GC
+    const AXMixControl mixer_control = static_cast<AXMixControl>(pb.mixer_control);
+    ProcessVoice(accelerator, pb, buffers, m_count, mixer_control, coeffs, false);
+#else
+    const AXMixControl mixer_control = static_cast<AXMixControl>(HILO_TO_32(pb.mixer_control));
+    ProcessVoice(accelerator, pb, buffers, m_count, mixer_control, coeffs, frame % 2);
+#endif
+  }
+
+  std::mt19937 m_rng;
+  ScopedARAM m_aram;
+  HLEAccelerator m_accelerator;
+  std::vector<s16> m_coeffs;
+  std::vector<PB_TYPE> m_voices;
+  u16 m_count;
+
+  std::array<std::vector<int>, NUM_BUFFERS> m_buffers;
+#ifdef AX_WII
+  std::array<std::vector<int>, NUM_WIIMOTE_BUFFERS> m_wiimote_buffers;
+#endif
+  AXBuffers m_buffer_ptrs;
+
+  AXVoiceWorkers m_workers;
+  std::vector<std::unique_ptr<HLEAccelerator>> m_thread_accelerators;
+  std::vector<std::vector<int>> m_thread_samples;
+};
+
+// Returns a hash of everything a few frames of a VoicePlayer produce.
+u64 PlayVoices(u32 seed, u16 count, u32 num_workers = 0)
+{
+  VoicePlayer player(seed, count, num_workers);
+  Hasher hasher;
+  for (u32 frame = 0; frame < NUM_FRAMES; ++frame)
+    player.PlayFrame(frame, hasher);
+  return hasher.GetHash();
+}
+}  // namespace
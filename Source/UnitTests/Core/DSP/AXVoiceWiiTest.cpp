@@ -0,0 +1,33 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#define AX_WII
+#include "Core/HW/DSPHLE/UCodes/AXVoice.h"
+
+#include "AXVoiceTest.h"
+
+// The hashes of what the voices produced when this test was written. If they change, so does the
+// audio of every game using AX.
+TEST(AXVoice, WiiMatchesGoldenOutput)
+{
+  for (bool avx2 : {true, false})
+  {
+    ScopedCPUFeatures features(avx2);
+    EXPECT_EQ(PlayVoices(1, 96), 0x15A714157457E97Bu) << "AVX2: " << avx2;
+    // Older versions of AXWii, which process a frame one millisecond at a time
+    EXPECT_EQ(PlayVoices(2, 32), 0x6C4034D02D702AD4u) << "AVX2: " << avx2;
+  }
+}
+
+// Voices rendered on worker threads have to sound exactly the same.
+TEST(AXVoice, WiiWorkersMatchGoldenOutput)
+{
+  for (u32 num_workers : {1, 3})
+  {
+    EXPECT_EQ(PlayVoices(1, 96, num_workers), 0x15A714157457E97Bu) << "Workers: " << num_workers;
+    EXPECT_EQ(PlayVoices(2, 32, num_workers), 0x6C4034D02D702AD4u) << "Workers: " << num_workers;
+  }
+}
+
@@ -0,0 +1,262 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <optional>
+#include <random>
+#include <string>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/GekkoDisassembler.h"
+#include "Core/Debugger/CodeTrace.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/PowerPC.h"
+
+namespace
+{
+constexpr u32 PC = 0x80003100;
+
+constexpr u32 SP = 0x80400000;
+constexpr u32 RTOC = 0x80500000;
+
+constexpr u32 D(u32 opcd, u32 d, u32 a, s32 imm)
+{
+  return opcd << 26 | d << 21 | a << 16 | (imm & 0xffff);
+}
+
+constexpr u32 X(u32 opcd, u32 d, u32 a, u32 b, u32 subop)
+{
+  return opcd << 26 | d << 21 | a << 16 | b << 11 | subop << 1;
+}
+
+constexpr u32 PSQ(u32 opcd, u32 d, u32 a, s32 imm)
+{
+  return opcd << 26 | d << 21 | a << 16 | (imm & 0xfff);
+}
+
+constexpr u32 PSQX(u32 subop6, u32 d, u32 a, u32 b)
+{
+  return 4u << 26 | d << 21 | a << 16 | b << 11 | subop6 << 1;
+}
+
+PowerPC::PowerPCState MakeState()
+{
+  PowerPC::PowerPCState ppc_state;
+  ppc_state.pc = PC;
+  for (u32 i = 0; i < 32; i++)
+    ppc_state.gpr[i] = 0x80001000 + i * 0x100;
+  // rA = 0 reads as zero for most loads and stores, so make sure r0 isn't.
+  ppc_state.gpr[0] = 0x1000;
+  ppc_state.gpr[1] = SP;
+  ppc_state.gpr[2] = RTOC;
+  ppc_state.gpr[4] = 0x20;
+  return ppc_state;
+}
+
+struct MemoryTargetCase
+{
+  u32 hex;
+  std::optional<u32> expected;
+};
+
+// Loads and stores with r0, sp and rtoc bases, in all the forms the address is computed from.
+const auto MEMORY_TARGET_CASES = std::to_array<MemoryTargetCase>({
+    {D(32, 3, 0, 0x10), 0x10},             // lwz r3, 0x10(r0)
+    {D(32, 3, 1, -8), SP - 8},             // lwz r3, -8(sp)
+    {D(36, 3, 2, 0x7ff0), RTOC + 0x7ff0},  // stw r3, 0x7ff0(rtoc)
+    {D(35, 3, 5, 1), 0x80001501},          // lbzu r3, 1(r5)
+    {D(45, 3, 1, -2), SP - 2},             // sthu r3, -2(sp)
+    {D(46, 29, 1, 0x14), SP + 0x14},       // lmw r29, 0x14(sp)
+    {D(47, 29, 0, 0x40), 0x40},            // stmw r29, 0x40(r0)
+    {D(50, 1, 2, -0x100), RTOC - 0x100},   // lfd f1, -0x100(rtoc)
+    {D(55, 1, 1, -16), SP - 16},           // stfdu f1, -16(sp)
+    {X(31, 3, 0, 4, 23), 0x20},            // lwzx r3, r0, r4
+    {X(31, 3, 1, 4, 23), SP + 0x20},       // lwzx r3, sp, r4
+    {X(31, 3, 2, 1, 151), RTOC + SP},      // stwx r3, rtoc, sp
+    {X(31, 3, 5, 4, 55), 0x80001520},      // lwzux r3, r5, r4
+    {X(31, 1, 0, 4, 727), 0x20},           // stfdx f1, r0, r4
+    {X(31, 0, 0, 4, 1014), 0x20},          // dcbz r0, r4
+    {PSQ(56, 1, 3, -4), 0x80001300 - 4},   // psq_l p1, -4(r3), 0, qr0
+    {PSQ(56, 1, 0, 0x7ff), 0x7ff},         // psq_l p1, 0x7ff(r0), 0, qr0
+    {PSQ(60, 1, 2, 8), RTOC + 8},          // psq_st p1, 8(rtoc), 0, qr0
+    {PSQ(61, 1, 1, -0x800), SP - 0x800},   // psq_stu p1, -0x800(sp), 0, qr0
+    {PSQX(6, 1, 3, 4), 0x80001320},        // psq_lx p1, r3, r4, 0, qr0
+    {PSQX(6, 1, 0, 4), 0x20},              // psq_lx p1, r0, r4, 0, qr0
+    {PSQX(39, 1, 1, 4), SP + 0x20},        // psq_stux p1, sp, r4, 0, qr0
+    {X(31, 6, 3, 8, 597), 0x80001300},     // lswi r6, r3, 8
+    {X(31, 6, 0, 8, 597), 0},              // lswi r6, r0, 8
+    {X(31, 6, 1, 4, 725), SP},             // stswi r6, sp, 4
+    {D(14, 3, 1, 8), std::nullopt},        // addi r3, sp, 8
+    {X(31, 4, 3, 4, 444), std::nullopt},   // or r3, r4, r4
+});
+
+std::string RegisterName(u32 index)
+{
+  return fmt::format("{}{}", index < 32 ? 'r' : 'f', index % 32);
+}
+
+// The prefilter may only skip an instruction if TraceLogic would skip it too. TraceInstruction
+// passes TraceLogic the memory target for loads and stores only, so try both.
+void ExpectPrefilterKeeps(const CodeTrace& trace, const PowerPC::PowerPCState& ppc_state,
+                          UGeckoInstruction inst)
+{
+  const std::optional<u32> memory_target = CodeTrace::GetMemoryTarget(ppc_state, inst);
+  if (trace.MayHitTracked(inst, memory_target))
+    return;
+
+  TraceOutput output;
+  output.address = ppc_state.pc;
+  output.instruction = Common::GekkoDisassembler::Disassemble(inst.hex, ppc_state.pc);
+  for (const std::optional<u32> target : {std::optional<u32>(), memory_target})
+  {
+    output.memory_target = target;
+    CodeTrace reference = trace;
+    EXPECT_EQ(reference.TraceLogic(output), HitType::SKIP)
+        << fmt::format("{:08x} {}", inst.hex, output.instruction);
+  }
+}
+
+// An instruction with some of its fields randomized
+struct InstructionForm
+{
+  u32 hex;
+  u32 random_bits;
+};
+
+constexpr u32 D_FIELDS = 0x03ffffff;
+constexpr u32 X_FIELDS = 0x03fff800;
+constexpr u32 A_FIELDS = 0x03ffffc0;
+constexpr u32 PSQX_FIELDS = 0x03ffff80;
+
+constexpr InstructionForm DForm(u32 opcd)
+{
+  return {opcd << 26, D_FIELDS};
+}
+
+constexpr InstructionForm XForm(u32 opcd, u32 subop)
+{
+  return {X(opcd, 0, 0, 0, subop), X_FIELDS};
+}
+
+constexpr InstructionForm AForm(u32 opcd, u32 subop5)
+{
+  return {X(opcd, 0, 0, 0, subop5), A_FIELDS};
+}
+
+const auto INSTRUCTION_FORMS = std::to_array<InstructionForm>({
+    // Loads and stores
+    DForm(32), DForm(33), DForm(34), DForm(35), DForm(36), DForm(37), DForm(38), DForm(39),
+    DForm(40), DForm(41), DForm(42), DForm(43), DForm(44), DForm(45), DForm(46), DForm(47),
+    DForm(48), DForm(49), DForm(50), DForm(51), DForm(52), DForm(53), DForm(54), DForm(55),
+    DForm(56), DForm(57), DForm(60), DForm(61), XForm(31, 23), XForm(31, 55), XForm(31, 87),
+    XForm(31, 119), XForm(31, 151), XForm(31, 183), XForm(31, 215), XForm(31, 247),
+    XForm(31, 279), XForm(31, 311), XForm(31, 343), XForm(31, 375), XForm(31, 407),
+    XForm(31, 439), XForm(31, 534), XForm(31, 662), XForm(31, 790), XForm(31, 918),
+    XForm(31, 535), XForm(31, 567), XForm(31, 599), XForm(31, 631), XForm(31, 663),
+    XForm(31, 695), XForm(31, 727), XForm(31, 759), XForm(31, 983), XForm(31, 533),
+    XForm(31, 661), XForm(31, 597), XForm(31, 725), XForm(31, 20), XForm(31, 310),
+    XForm(31, 438), {X(31, 0, 0, 0, 150) | 1, X_FIELDS}, {PSQX(6, 0, 0, 0), PSQX_FIELDS},
+    {PSQX(7, 0, 0, 0), PSQX_FIELDS}, {PSQX(38, 0, 0, 0), PSQX_FIELDS},
+    {PSQX(39, 0, 0, 0), PSQX_FIELDS},
+    // Cache operations
+    XForm(31, 54), XForm(31, 86), XForm(31, 278), XForm(31, 470), XForm(31, 982),
+    XForm(31, 1014), XForm(4, 1014),
+    // Integer
+    DForm(7), DForm(8), DForm(10), DForm(11), DForm(12), DForm(13), DForm(14), DForm(15),
+    DForm(20), DForm(21), DForm(23), DForm(24), DForm(25), DForm(26), DForm(27), DForm(28),
+    DForm(29), XForm(31, 0), XForm(31, 32), XForm(31, 266), XForm(31, 40), XForm(31, 28),
+    XForm(31, 444), XForm(31, 316), XForm(31, 24), XForm(31, 536), XForm(31, 792),
+    XForm(31, 824), XForm(31, 922), XForm(31, 954), XForm(31, 26), XForm(31, 104),
+    XForm(31, 235), XForm(31, 491),
+    // Special registers
+    XForm(31, 19), XForm(31, 144), XForm(31, 83), XForm(31, 339), XForm(31, 467),
+    XForm(31, 371),
+    // Floating point and paired singles
+    AForm(59, 21), AForm(59, 18), AForm(59, 25), AForm(59, 29), XForm(63, 72), AForm(63, 21),
+    XForm(63, 0), XForm(63, 40), XForm(63, 12), XForm(63, 14), AForm(4, 21), AForm(4, 29),
+    XForm(4, 72), XForm(4, 528),
+    // Branches
+    DForm(16), DForm(18),
+});}  // namespace
+
+TEST(CodeTrace, MemoryTarget)
+{
+  const PowerPC::PowerPCState ppc_state = MakeState();
+  for (const MemoryTargetCase& test : MEMORY_TARGET_CASES)
+  {
+    EXPECT_EQ(CodeTrace::GetMemoryTarget(ppc_state, UGeckoInstruction{test.hex}), test.expected)
+        << Common::GekkoDisassembler::Disassemble(test.hex, PC);
+  }
+}
+
+TEST(CodeTrace, PrefilterKeepsTrackedRegisters)
+{
+  const PowerPC::PowerPCState ppc_state = MakeState();
+  for (const MemoryTargetCase& test : MEMORY_TARGET_CASES)
+  {
+    for (u32 reg = 0; reg < 64; reg++)
+    {
+      CodeTrace trace;
+      trace.SetRegTracked(RegisterName(reg));
+      ExpectPrefilterKeeps(trace, ppc_state, UGeckoInstruction{test.hex});
+    }
+  }
+}
+
+TEST(CodeTrace, PrefilterKeepsTrackedMemory)
+{
+  const PowerPC::PowerPCState ppc_state = MakeState();
+  for (const MemoryTargetCase& test : MEMORY_TARGET_CASES)
+  {
+    if (!test.expected)
+      continue;
+
+    for (s32 offset = -8; offset <= 8; offset++)
+    {
+      CodeTrace trace;
+      trace.SetMemTracked(*test.expected + offset);
+      ExpectPrefilterKeeps(trace, ppc_state, UGeckoInstruction{test.hex});
+    }
+  }
+}
+
+TEST(CodeTrace, PrefilterKeepsRandomInstructions)
+{
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<u32> u32_dist;
+  std::uniform_int_distribution<size_t> form_dist(0, INSTRUCTION_FORMS.size() - 1);
+  std::uniform_int_distribution<u32> register_dist(0, 63);
+  std::uniform_int_distribution<u32> count_dist(0, 3);
+  std::uniform_int_distribution<s32> offset_dist(-8, 8);
+
+  u32 skipped = 0;
+  for (u32 i = 0; i < 20000; i++)
+  {
+    PowerPC::PowerPCState ppc_state = MakeState();
+    for (u32& gpr : ppc_state.gpr)
+      gpr = u32_dist(rng);
+
+    const InstructionForm& form = INSTRUCTION_FORMS[form_dist(rng)];
+    const UGeckoInstruction inst{form.hex | (u32_dist(rng) & form.random_bits)};
+
+    CodeTrace trace;
+    for (u32 j = count_dist(rng); j > 0; j--)
+      trace.SetRegTracked(RegisterName(register_dist(rng)));
+
+    // Track memory close to the address the instruction accesses, so it hits some of the time.
+    const std::optional<u32> memory_target = CodeTrace::GetMemoryTarget(ppc_state, inst);
+    const u32 memory_base = memory_target ? *memory_target : u32_dist(rng);
+    for (u32 j = count_dist(rng) + 1; j > 0; j--)
+      trace.SetMemTracked(memory_base + offset_dist(rng));
+
+    if (!trace.MayHitTracked(inst, memory_target))
+      skipped++;
+    ExpectPrefilterKeeps(trace, ppc_state, inst);
+  }
+
+  // Otherwise the check above would hardly test anything.
+  EXPECT_GT(skipped, 5000u);
+}
@@ -0,0 +1,170 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Core/ConfigManager.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
+#include "UICommon/UICommon.h"
+
+namespace
+{
+constexpr u32 NUM_FRAMES = 10;
+
+class FifoDataFileTest : public testing::TestWithParam<FifoCompression>
+{
+protected:
+  void SetUp() override
+  {
+    m_profile_path = File::CreateTempDir();
+    ASSERT_FALSE(m_profile_path.empty());
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+  }
+
+  void TearDown() override
+  {
+    SConfig::Shutdown();
+    Config::Shutdown();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+
+  std::string m_profile_path;
+};
+
+// Frames of different sizes, some with memory updates and some without
+FifoFrameInfo CreateFrame(u32 number)
+{
+  FifoFrameInfo frame;
+  frame.fifoStart = 0x100000 + number;
+  frame.fifoEnd = 0x200000 + number;
+  for (u32 i = 0; i < 1000 + number * 37; ++i)
+    frame.fifoData.push_back(static_cast<u8>(i * number / 7));
+
+  for (u32 i = 0; i < number % 4; ++i)
+  {
+    MemoryUpdate update;
+    update.fifoPosition = i * 10;
+    update.address = 0x80000000 + i * 0x40;
+    update.type = i % 2 ? MemoryUpdate::Type::TextureMap : MemoryUpdate::Type::VertexStream;
+    for (u32 j = 0; j < 500 * (i + 1); ++j)
+      update.data.push_back(static_cast<u8>(j % 13 + i));
+    frame.memoryUpdates.push_back(std::move(update));
+  }
+
+  return frame;
+}
+
+void ExpectFrame(const std::optional<FifoFrameInfo>& frame_data, u32 number)
+{
+  ASSERT_TRUE(frame_data.has_value());
+  const FifoFrameInfo& frame = *frame_data;
+  const FifoFrameInfo expected = CreateFrame(number);
+  EXPECT_EQ(frame.fifoStart, expected.fifoStart);
+  EXPECT_EQ(frame.fifoEnd, expected.fifoEnd);
+  EXPECT_EQ(frame.fifoData, expected.fifoData);
+  ASSERT_EQ(frame.memoryUpdates.size(), expected.memoryUpdates.size());
+  for (size_t i = 0; i < frame.memoryUpdates.size(); ++i)
+  {
+    EXPECT_EQ(frame.memoryUpdates[i].fifoPosition, expected.memoryUpdates[i].fifoPosition);
+    EXPECT_EQ(frame.memoryUpdates[i].address, expected.memoryUpdates[i].address);
+    EXPECT_EQ(frame.memoryUpdates[i].type, expected.memoryUpdates[i].type);
+    EXPECT_EQ(frame.memoryUpdates[i].data, expected.memoryUpdates[i].data);
+  }
+}
+}  // namespace
+
+TEST_P(FifoDataFileTest, RoundTrip)
+{
+  std::unique_ptr<FifoDataFile> file = FifoDataFile::Create(GetParam());
+  ASSERT_NE(file, nullptr);
+
+  file->SetIsWii(true);
+  file->GetBPMem()[3] = 42;
+  file->GetTexMem()[1000] = 7;
+  for (u32 i = 0; i < NUM_FRAMES; ++i)
+    file->AddFrame(CreateFrame(i));
+
+  // Frames can be read back while recording.
+  for (u32 i = 0; i < NUM_FRAMES; ++i)
+    ExpectFrame(file->GetFrame(i), i);
+
+  const std::string path = m_profile_path + "/test.dff";
+  ASSERT_TRUE(file->Save(path));
+  // Saving to where the recording was moved to does nothing.
+  EXPECT_TRUE(file->Save(path));
+
+  // Saving moves the recording, which can still be read and saved again afterwards.
+  ExpectFrame(file->GetFrame(NUM_FRAMES - 1), NUM_FRAMES - 1);
+  const std::string copy_path = m_profile_path + "/copy.dff";
+  ASSERT_TRUE(file->Save(copy_path));
+  file.reset();
+  EXPECT_TRUE(File::Exists(path));
+  EXPECT_TRUE(File::Exists(copy_path));
+
+  file = FifoDataFile::Load(path, false);
+  ASSERT_NE(file, nullptr);
+  EXPECT_TRUE(file->GetIsWii());
+  EXPECT_EQ(file->GetBPMem()[3], 42u);
+  EXPECT_EQ(file->GetTexMem()[1000], 7);
+  ASSERT_EQ(file->GetFrameCount(), NUM_FRAMES);
+
+  // Frames are loaded on demand, in any order.
+  for (u32 i = NUM_FRAMES; i-- > 0;)
+  {
+    ExpectFrame(file->GetFrame(i), i);
+
+    u32 memory_updates_size = 0;
+    for (const MemoryUpdate& update : CreateFrame(i).memoryUpdates)
+      memory_updates_size += static_cast<u32>(update.data.size());
+    EXPECT_EQ(file->GetFifoDataSize(i), CreateFrame(i).fifoData.size());
+    EXPECT_EQ(file->GetMemoryUpdatesSize(i), memory_updates_size);
+  }
+}
+
+// A corrupt frame index must not make GetFrame allocate whatever size it claims.
+TEST_P(FifoDataFileTest, CorruptFrameSize)
+{
+  if (GetParam() == FifoCompression::None)
+    GTEST_SKIP() << "Only the size of compressed frames is allocated before reading them";
+
+  std::unique_ptr<FifoDataFile> file = FifoDataFile::Create(GetParam());
+  ASSERT_NE(file, nullptr);
+  for (u32 i = 0; i < NUM_FRAMES; ++i)
+    file->AddFrame(CreateFrame(i));
+  const std::string path = m_profile_path + "/test.dff";
+  ASSERT_TRUE(file->Save(path));
+  file.reset();
+
+  // FileHeader::frameListOffset and FileFrameInfo::memoryUpdatesSize of the first frame
+  constexpr u64 FRAME_LIST_OFFSET_POSITION = 60;
+  constexpr u64 MEMORY_UPDATES_SIZE_POSITION = 32;
+  {
+    File::IOFile dff(path, "r+b");
+    u64 frame_list_offset = 0;
+    ASSERT_TRUE(dff.Seek(FRAME_LIST_OFFSET_POSITION, File::SeekOrigin::Begin));
+    ASSERT_TRUE(dff.ReadArray(&frame_list_offset, 1));
+    const u32 memory_updates_size = 0xFFFFFFF0;
+    ASSERT_TRUE(
+        dff.Seek(frame_list_offset + MEMORY_UPDATES_SIZE_POSITION, File::SeekOrigin::Begin));
+    ASSERT_TRUE(dff.WriteArray(&memory_updates_size, 1));
+  }
+
+  file = FifoDataFile::Load(path, false);
+  ASSERT_NE(file, nullptr);
+  EXPECT_FALSE(file->GetFrame(0).has_value());
+  ExpectFrame(file->GetFrame(1), 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(FifoDataFile, FifoDataFileTest,
+                         testing::Values(FifoCompression::None, FifoCompression::LZ4,
+                                         FifoCompression::Zstd));
@@ -0,0 +1,215 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+#include "../StubJit.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class LinkRecordingBlockCache : public JitBaseBlockCache
+{
+public:
+  explicit LinkRecordingBlockCache(JitBase& jit) : JitBaseBlockCache(jit) {}
+
+  // Maps each exit (identified by its source block and exit address) to its current destination.
+  std::map<std::pair<u32, u32>, const JitBlock*> links;
+
+private:
+  void WriteLinkBlock(const JitBlock::LinkData& source, const JitBlock* dest) override
+  {
+    // Only exits which were registered for linking know their source block.
+    if (source.source_block)
+      links[{source.source_block->effectiveAddress, source.exitAddress}] = dest;
+  }
+};
+
+JitBlock* AddBlock(JitBaseBlockCache& cache, u32 address, u32 num_instructions,
+                   const std::vector<u32>& exits = {})
+{
+  JitBlock* block = cache.AllocateBlock(address);
+  block->normalEntry = nullptr;
+  block->near_begin = block->near_end = nullptr;
+  block->far_begin = block->far_end = nullptr;
+  for (const u32 exit : exits)
+  {
+    JitBlock::LinkData link_data{};
+    link_data.exitAddress = exit;
+    link_data.linkStatus = false;
+    link_data.call = false;
+    block->linkData.push_back(link_data);
+  }
+
+  PPCAnalyst::CodeBlock code_block;
+  code_block.m_address = address;
+  code_block.m_num_instructions = num_instructions;
+  code_block.m_physical_addresses.insert(address, address + num_instructions * 4);
+  cache.FinalizeBlock(*block, true, code_block, {});
+  return block;
+}
+
+class JitCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    auto& ppc_state = Core::System::GetInstance().GetPPCState();
+    ppc_state.msr.IR = 0;
+    ppc_state.feature_flags = static_cast<CPUEmuFeatureFlags>(0);
+  }
+
+  StubJit m_jit{Core::System::GetInstance()};
+  LinkRecordingBlockCache m_cache{m_jit};
+};
+}  // namespace
+
+TEST_F(JitCacheTest, Lookup)
+{
+  const JitBlock* a = AddBlock(m_cache, 0x1000, 8);
+  const JitBlock* b = AddBlock(m_cache, 0x1020, 8);
+  const JitBlock* c = AddBlock(m_cache, 0x801000, 8);
+
+  EXPECT_EQ(m_cache.GetBlockCount(), 3u);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x1000, {}), a);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x1020, {}), b);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x801000, {}), c);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x1004, {}), nullptr);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x1000, FEATURE_FLAG_PERFMON), nullptr);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x2000, {}), nullptr);
+}
+
+TEST_F(JitCacheTest, ErasePhysicalRange)
+{
+  AddBlock(m_cache, 0x1000, 8);
+  AddBlock(m_cache, 0x10f8, 4);  // Crosses into the next macro block
+  AddBlock(m_cache, 0x1200, 8);
+  AddBlock(m_cache, 0x1ff8, 4);  // Crosses into the next page
+
+  m_cache.ErasePhysicalRange(0x1100, 0x20);
+  EXPECT_EQ(m_cache.GetBlockCount(), 3u);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x10f8, {}), nullptr);
+  EXPECT_NE(m_cache.GetBlockFromStartAddress(0x1000, {}), nullptr);
+
+  m_cache.ErasePhysicalRange(0x2000, 0x20);
+  EXPECT_EQ(m_cache.GetBlockCount(), 2u);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x1ff8, {}), nullptr);
+
+  m_cache.ErasePhysicalRange(0x1100, 0x100);
+  EXPECT_EQ(m_cache.GetBlockCount(), 2u);
+
+  m_cache.ErasePhysicalRange(0, 0x10000);
+  EXPECT_EQ(m_cache.GetBlockCount(), 0u);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x1000, {}), nullptr);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x1200, {}), nullptr);
+}
+
+TEST_F(JitCacheTest, EraseSingleBlock)
+{
+  const JitBlock* a = AddBlock(m_cache, 0x1000, 8);
+  const JitBlock* b = AddBlock(m_cache, 0x1020, 8);
+
+  m_cache.EraseSingleBlock(*a);
+  EXPECT_EQ(m_cache.GetBlockCount(), 1u);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x1000, {}), nullptr);
+  EXPECT_EQ(m_cache.GetBlockFromStartAddress(0x1020, {}), b);
+
+  // The erased block must no longer be found by range invalidation either.
+  m_cache.ErasePhysicalRange(0x1000, 0x40);
+  EXPECT_EQ(m_cache.GetBlockCount(), 0u);
+}
+
+TEST_F(JitCacheTest, Linking)
+{
+  const JitBlock* a = AddBlock(m_cache, 0x1000, 4, {0x2000, 0x3000});
+  EXPECT_EQ((m_cache.links[{0x1000, 0x2000}]), nullptr);
+
+  const JitBlock* b = AddBlock(m_cache, 0x2000, 4, {0x1000});
+  EXPECT_EQ((m_cache.links[{0x1000, 0x2000}]), b);
+  EXPECT_EQ((m_cache.links[{0x2000, 0x1000}]), a);
+
+  const JitBlock* c = AddBlock(m_cache, 0x3000, 4, {0x2000});
+  EXPECT_EQ((m_cache.links[{0x1000, 0x3000}]), c);
+  EXPECT_EQ((m_cache.links[{0x3000, 0x2000}]), b);
+
+  // Destroying b must unlink the exits of a and c which point to it.
+  m_cache.ErasePhysicalRange(0x2000, 4);
+  EXPECT_EQ((m_cache.links[{0x1000, 0x2000}]), nullptr);
+  EXPECT_EQ((m_cache.links[{0x3000, 0x2000}]), nullptr);
+  EXPECT_EQ((m_cache.links[{0x1000, 0x3000}]), c);
+
+  // Recompiling it must link them again.
+  b = AddBlock(m_cache, 0x2000, 4);
+  EXPECT_EQ((m_cache.links[{0x1000, 0x2000}]), b);
+  EXPECT_EQ((m_cache.links[{0x3000, 0x2000}]), b);
+}
+
+// Not a correctness test, but a rough measurement of how fast lookups and invalidations are with a
+// realistic number of blocks.
+TEST_F(JitCacheTest, DISABLED_Throughput)
+{
+  using Clock = std::chrono::steady_clock;
+  constexpr u32 NUM_BLOCKS = 0x10000;
+  constexpr u32 BLOCK_STRIDE = 0x40;
+  constexpr u32 BASE_ADDRESS = 0x00003000;
+
+  const auto populate = [this] {
+    for (u32 i = 0; i < NUM_BLOCKS; ++i)
+    {
+      const u32 address = BASE_ADDRESS + i * BLOCK_STRIDE;
+      AddBlock(m_cache, address, BLOCK_STRIDE / 4, {address + BLOCK_STRIDE, address + 0x1000});
+    }
+  };
+
+  const Clock::time_point populate_start = Clock::now();
+  populate();
+  const Clock::duration populate_time = Clock::now() - populate_start;
+  ASSERT_EQ(m_cache.GetBlockCount(), NUM_BLOCKS);
+
+  const Clock::time_point lookup_start = Clock::now();
+  u32 found = 0;
+  for (u32 round = 0; round < 16; ++round)
+  {
+    for (u32 i = 0; i < NUM_BLOCKS; ++i)
+      found += m_cache.GetBlockFromStartAddress(BASE_ADDRESS + i * BLOCK_STRIDE, {}) != nullptr;
+  }
+  const Clock::duration lookup_time = Clock::now() - lookup_start;
+  EXPECT_EQ(found, NUM_BLOCKS * 16);
+
+  // Invalidate every cache line one by one, like a game doing dcbi/icbi over its code would.
+  const Clock::time_point invalidate_start = Clock::now();
+  for (u32 address = BASE_ADDRESS; address < BASE_ADDRESS + NUM_BLOCKS * BLOCK_STRIDE;
+       address += 32)
+  {
+    m_cache.ErasePhysicalRange(address, 32);
+  }
+  const Clock::duration invalidate_time = Clock::now() - invalidate_start;
+  EXPECT_EQ(m_cache.GetBlockCount(), 0u);
+
+  // Invalidate everything at once, like a large DMA would.
+  populate();
+  const Clock::time_point bulk_start = Clock::now();
+  m_cache.ErasePhysicalRange(0, 0x01800000);
+  const Clock::duration bulk_time = Clock::now() - bulk_start;
+  EXPECT_EQ(m_cache.GetBlockCount(), 0u);
+
+  const auto ns_per = [](Clock::duration duration, u32 count) {
+    return std::chrono::duration<double, std::nano>(duration).count() / count;
+  };
+  fmt::print("Allocate+finalize: {:.1f} ns/block\n", ns_per(populate_time, NUM_BLOCKS));
+  fmt::print("Lookup: {:.1f} ns/lookup\n", ns_per(lookup_time, NUM_BLOCKS * 16));
+  fmt::print("Cache line invalidation: {:.1f} ns/line\n",
+             ns_per(invalidate_time, NUM_BLOCKS * BLOCK_STRIDE / 32));
+  fmt::print("Bulk invalidation: {:.1f} ns/block\n", ns_per(bulk_time, NUM_BLOCKS));
+}
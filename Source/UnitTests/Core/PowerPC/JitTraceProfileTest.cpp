@@ -0,0 +1,55 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/JitCommon/JitTraceProfile.h"
+
+TEST(JitTraceProfile, EntryCounterIsStable)
+{
+  JitTraceProfile profile;
+  s32* const counter = profile.GetEntryCounter(0x80003100);
+  EXPECT_EQ(*counter, JitTraceProfile::HOT_THRESHOLD);
+
+  *counter -= 10;
+  for (u32 i = 0; i < 1000; i++)
+    profile.GetEntryCounter(0x80004000 + i * 4);
+
+  // Recompiling a block keeps counting where the previous code stopped.
+  EXPECT_EQ(profile.GetEntryCounter(0x80003100), counter);
+  EXPECT_EQ(*counter, JitTraceProfile::HOT_THRESHOLD - 10);
+}
+
+TEST(JitTraceProfile, BranchDirection)
+{
+  JitTraceProfile profile;
+  constexpr u32 BRANCH = 0x80003100;
+  EXPECT_FALSE(profile.IsBranchMostlyTaken(BRANCH));
+
+  // Too few samples to trust.
+  *profile.GetBranchCounter(BRANCH, true) = JitTraceProfile::MIN_BRANCH_SAMPLES - 1;
+  EXPECT_FALSE(profile.IsBranchMostlyTaken(BRANCH));
+
+  *profile.GetBranchCounter(BRANCH, true) = 70;
+  *profile.GetBranchCounter(BRANCH, false) = 10;
+  EXPECT_TRUE(profile.IsBranchMostlyTaken(BRANCH));
+
+  *profile.GetBranchCounter(BRANCH, false) = 11;
+  EXPECT_FALSE(profile.IsBranchMostlyTaken(BRANCH));
+}
+
+TEST(JitTraceProfile, Clear)
+{
+  JitTraceProfile profile;
+  profile.MarkHot(0x80003100);
+  *profile.GetEntryCounter(0x80003100) = 0;
+  *profile.GetBranchCounter(0x80003104, true) = 100;
+  EXPECT_TRUE(profile.IsHot(0x80003100));
+  EXPECT_TRUE(profile.IsBranchMostlyTaken(0x80003104));
+
+  profile.Clear();
+  EXPECT_FALSE(profile.IsHot(0x80003100));
+  EXPECT_FALSE(profile.IsBranchMostlyTaken(0x80003104));
+  EXPECT_EQ(*profile.GetEntryCounter(0x80003100), JitTraceProfile::HOT_THRESHOLD);
+}
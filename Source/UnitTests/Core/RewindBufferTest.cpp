@@ -0,0 +1,120 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Core/RewindBuffer.h"
+
+namespace
+{
+std::vector<u8> MakeState(std::size_t size, u8 seed)
+{
+  std::vector<u8> state(size);
+  for (std::size_t i = 0; i < size; ++i)
+    state[i] = static_cast<u8>((i / 64) ^ (i % 7 == 0 ? seed : 0));
+  return state;
+}
+
+void Push(State::RewindBuffer& buffer, const std::vector<u8>& state, std::size_t slack = 0)
+{
+  Common::UniqueBuffer<u8> copy(state.size() + slack);
+  std::memcpy(copy.data(), state.data(), state.size());
+  std::memset(copy.data() + state.size(), 0xCC, slack);
+  buffer.Push(std::move(copy), state.size());
+}
+
+void ExpectPop(State::RewindBuffer& buffer, const std::vector<u8>& expected)
+{
+  Common::UniqueBuffer<u8> state;
+  const std::size_t size = buffer.Pop(state);
+  ASSERT_EQ(size, expected.size());
+  EXPECT_EQ(std::memcmp(state.data(), expected.data(), size), 0);
+}
+}  // namespace
+
+TEST(RewindBuffer, Empty)
+{
+  State::RewindBuffer buffer(1 << 20);
+  Common::UniqueBuffer<u8> state;
+  EXPECT_EQ(buffer.Pop(state), 0u);
+  EXPECT_EQ(buffer.GetNumStates(), 0u);
+}
+
+TEST(RewindBuffer, PopsInReverseOrder)
+{
+  State::RewindBuffer buffer(64 << 20);
+  std::vector<std::vector<u8>> states;
+  // Vary the sizes to cover states growing and shrinking between captures.
+  for (u8 i = 0; i < 8; ++i)
+  {
+    states.push_back(MakeState(0x10000 + (i % 3) * 0x1234, i));
+    Push(buffer, states.back(), i * 16);
+  }
+  EXPECT_EQ(buffer.GetNumStates(), states.size());
+
+  for (auto it = states.rbegin(); it != states.rend(); ++it)
+    ExpectPop(buffer, *it);
+
+  Common::UniqueBuffer<u8> state;
+  EXPECT_EQ(buffer.Pop(state), 0u);
+}
+
+TEST(RewindBuffer, DeltasAreSmall)
+{
+  State::RewindBuffer buffer(64 << 20);
+  std::vector<u8> state = MakeState(0x100000, 0);
+  Push(buffer, state);
+  state[0x1234] ^= 0xFF;
+  Push(buffer, state);
+
+  // One full state plus a delta which should compress to almost nothing.
+  EXPECT_LT(buffer.GetMemoryUsage(), state.size() + state.size() / 64);
+}
+
+TEST(RewindBuffer, ExtraDeltas)
+{
+  State::RewindBuffer buffer(64 << 20);
+  const std::vector<u8> first = MakeState(0x1000, 1);
+  const std::vector<u8> second = MakeState(0x1000, 2);
+  const std::vector<u8> extra(0x3000, 0x5A);
+
+  Push(buffer, first);
+  Common::UniqueBuffer<u8> copy(second.size());
+  std::memcpy(copy.data(), second.data(), second.size());
+  buffer.Push(std::move(copy), second.size(), extra);
+
+  Common::UniqueBuffer<u8> state;
+  std::vector<u8> popped_extra;
+  ASSERT_EQ(buffer.Pop(state, &popped_extra), second.size());
+  EXPECT_EQ(popped_extra, extra);
+  ASSERT_EQ(buffer.Pop(state, &popped_extra), first.size());
+  EXPECT_TRUE(popped_extra.empty());
+}
+
+TEST(RewindBuffer, MemoryBudgetDropsOldestStates)
+{
+  constexpr std::size_t STATE_SIZE = 0x10000;
+  State::RewindBuffer buffer(STATE_SIZE);
+
+  // The newest state is always kept, even if it alone exceeds the budget.
+  const std::vector<u8> first = MakeState(STATE_SIZE, 1);
+  const std::vector<u8> second = MakeState(STATE_SIZE, 2);
+  Push(buffer, first);
+  Push(buffer, second);
+  EXPECT_EQ(buffer.GetNumStates(), 1u);
+  EXPECT_LE(buffer.GetMemoryUsage(), STATE_SIZE);
+
+  buffer.SetMemoryBudget(STATE_SIZE * 2);
+  const std::vector<u8> third = MakeState(STATE_SIZE, 3);
+  Push(buffer, third);
+  EXPECT_EQ(buffer.GetNumStates(), 2u);
+
+  ExpectPop(buffer, third);
+  ExpectPop(buffer, second);
+  EXPECT_EQ(buffer.GetNumStates(), 0u);
+}
@@ -0,0 +1,180 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/BlockCacheBlob.h"
+
+namespace
+{
+constexpr u64 BLOCK_SIZE = 0x8000;
+
+struct ReadCounts
+{
+  // Reads done by the reader passed to CreateBlockCacheBlobReader
+  std::atomic<u32> original{};
+  // Reads done by copies of it
+  std::atomic<u32> copies{};
+};
+
+// A reader with the properties of a compressed format, which counts how often it is read.
+class FakeCompressedReader final : public DiscIO::BlobReader
+{
+public:
+  FakeCompressedReader(std::shared_ptr<const std::vector<u8>> data,
+                       std::shared_ptr<ReadCounts> counts, bool is_copy = false)
+      : m_data{std::move(data)}, m_counts{std::move(counts)}, m_is_copy{is_copy}
+  {
+  }
+
+  DiscIO::BlobType GetBlobType() const override { return DiscIO::BlobType::RVZ; }
+  std::unique_ptr<BlobReader> CopyReader() const override
+  {
+    return std::make_unique<FakeCompressedReader>(m_data, m_counts, true);
+  }
+
+  u64 GetRawSize() const override { return m_data->size(); }
+  u64 GetDataSize() const override { return m_data->size(); }
+  DiscIO::DataSizeType GetDataSizeType() const override { return DiscIO::DataSizeType::Accurate; }
+
+  u64 GetBlockSize() const override { return BLOCK_SIZE; }
+  bool HasFastRandomAccessInBlock() const override { return false; }
+  std::string GetCompressionMethod() const override { return "Fake"; }
+  std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
+
+  bool Read(u64 offset, u64 size, u8* out_ptr) override
+  {
+    ++(m_is_copy ? m_counts->copies : m_counts->original);
+    if (offset + size > m_data->size())
+      return false;
+    std::copy_n(m_data->begin() + offset, size, out_ptr);
+    return true;
+  }
+
+private:
+  std::shared_ptr<const std::vector<u8>> m_data;
+  std::shared_ptr<ReadCounts> m_counts;
+  bool m_is_copy;
+};
+
+struct TestReader
+{
+  std::shared_ptr<const std::vector<u8>> data;
+  std::shared_ptr<ReadCounts> counts;
+  std::unique_ptr<DiscIO::BlobReader> reader;
+};
+
+// The last block is incomplete.
+TestReader CreateTestReader(u64 memory_budget, u32 read_ahead_threads,
+                            u64 size = 64 * BLOCK_SIZE + 0x123)
+{
+  auto data = std::make_shared<std::vector<u8>>(size);
+  std::mt19937 rng(4321);
+  std::generate(data->begin(), data->end(), [&rng] { return static_cast<u8>(rng()); });
+  auto counts = std::make_shared<ReadCounts>();
+  auto reader = DiscIO::CreateBlockCacheBlobReader(
+      std::make_unique<FakeCompressedReader>(data, counts), memory_budget, read_ahead_threads);
+  return {std::move(data), std::move(counts), std::move(reader)};
+}
+
+bool ReadMatches(TestReader& test, u64 offset, u64 size)
+{
+  std::vector<u8> buffer(size);
+  return test.reader->Read(offset, size, buffer.data()) &&
+         std::equal(buffer.begin(), buffer.end(), test.data->begin() + offset);
+}
+}  // namespace
+
+TEST(BlockCacheBlob, MatchesUnderlyingReader)
+{
+  for (u32 read_ahead_threads : {0, 2})
+  {
+    // Small enough that blocks get evicted all the time.
+    TestReader test = CreateTestReader(6 * BLOCK_SIZE, read_ahead_threads);
+    const u64 data_size = test.data->size();
+    std::mt19937 rng(1234);
+
+    for (u32 i = 0; i < 2000; ++i)
+    {
+      // Mostly sequential runs of reads, crossing blocks now and then.
+      const u64 offset = std::uniform_int_distribution<u64>(0, data_size - 1)(rng);
+      for (u64 run_offset = offset; run_offset < std::min(data_size, offset + 4 * BLOCK_SIZE);)
+      {
+        const u64 size = std::min(data_size - run_offset,
+                                  std::uniform_int_distribution<u64>(1, 3 * BLOCK_SIZE / 2)(rng));
+        ASSERT_TRUE(ReadMatches(test, run_offset, size)) << run_offset << " " << size;
+        run_offset += size;
+      }
+    }
+
+    std::vector<u8> buffer(0x20);
+    EXPECT_FALSE(test.reader->Read(data_size - 0x10, buffer.size(), buffer.data()));
+
+    // Copies share the cache but not their reader.
+    auto copy = test.reader->CopyReader();
+    std::vector<u8> whole_data(data_size);
+    ASSERT_TRUE(copy->Read(0, data_size, whole_data.data()));
+    EXPECT_EQ(whole_data, *test.data);
+  }
+}
+
+TEST(BlockCacheBlob, EvictsLeastRecentlyUsed)
+{
+  TestReader test = CreateTestReader(4 * BLOCK_SIZE, 0);
+
+  for (u64 block = 0; block < 4; ++block)
+    ASSERT_TRUE(ReadMatches(test, block * BLOCK_SIZE, 0x800));
+  EXPECT_EQ(test.counts->original, 4u);
+
+  // Block 0 becomes the most recently used, so reading block 4 evicts block 1.
+  ASSERT_TRUE(ReadMatches(test, 0x1000, 0x800));
+  ASSERT_TRUE(ReadMatches(test, 4 * BLOCK_SIZE, 0x800));
+  EXPECT_EQ(test.counts->original, 5u);
+
+  ASSERT_TRUE(ReadMatches(test, 0x2000, 0x800));
+  ASSERT_TRUE(ReadMatches(test, 2 * BLOCK_SIZE + 0x2000, 0x800));
+  EXPECT_EQ(test.counts->original, 5u);
+
+  ASSERT_TRUE(ReadMatches(test, BLOCK_SIZE, 0x800));
+  EXPECT_EQ(test.counts->original, 6u);
+}
+
+TEST(BlockCacheBlob, ReadsAhead)
+{
+  TestReader test = CreateTestReader(16 * BLOCK_SIZE, 2);
+
+  // The first blocks are read directly. From then on, every block has been read ahead by the time
+  // it is needed, or is being read ahead and gets waited for.
+  for (u64 offset = 0; offset < test.data->size(); offset += 0x1000)
+    ASSERT_TRUE(ReadMatches(test, offset, std::min<u64>(0x1000, test.data->size() - offset)));
+  EXPECT_EQ(test.counts->original, 3u);
+  EXPECT_EQ(test.counts->copies, 62u);
+}
+
+TEST(BlockCacheBlob, NoReadAheadForRandomReads)
+{
+  TestReader test = CreateTestReader(16 * BLOCK_SIZE, 2);
+
+  for (u64 block : {5, 20, 3, 40, 41, 7, 63, 0})
+    ASSERT_TRUE(ReadMatches(test, block * BLOCK_SIZE + 0x100, 0x100));
+  EXPECT_EQ(test.counts->original, 8u);
+  EXPECT_EQ(test.counts->copies, 0u);
+}
+
+TEST(BlockCacheBlob, SkipsSmallBudgets)
+{
+  TestReader test = CreateTestReader(2 * BLOCK_SIZE, 2);
+  ASSERT_TRUE(ReadMatches(test, 0, 0x100));
+  ASSERT_TRUE(ReadMatches(test, 0, 0x100));
+  EXPECT_EQ(test.counts->original, 2u);
+}
@@ -0,0 +1,187 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "VideoBackends/Software/NativeVertexFormat.h"
+#include "VideoBackends/Software/Rasterizer.h"
+#include "VideoBackends/Software/SWEfbInterface.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/XFMemory.h"
+
+namespace
+{
+constexpr u32 EFB_BUFFER_SIZE = EFB_WIDTH * EFB_HEIGHT * 3;
+
+// GX adds 342 to the scissor coordinates and offsets.
+constexpr int SCISSOR_OFFSET = 342;
+
+// A single TEV stage passes the rasterized color through, which is blended with the EFB by its
+// alpha and depth tested, so the result depends on the order the triangles are drawn in.
+void SetUpBPMemory(PixelFormat format)
+{
+  std::memset(&bpmem, 0, sizeof(bpmem));
+  std::memset(&xfmem, 0, sizeof(xfmem));
+
+  bpmem.genMode.numcolchans = 1;
+  bpmem.tevorders[0].colorchan_even = RasColorChan::Color0;
+  bpmem.tevksel.ksel[0].swap_rb = ColorChannel::Red;
+  bpmem.tevksel.ksel[0].swap_ga = ColorChannel::Green;
+  bpmem.tevksel.ksel[1].swap_rb = ColorChannel::Blue;
+  bpmem.tevksel.ksel[1].swap_ga = ColorChannel::Alpha;
+
+  TevStageCombiner::ColorCombiner& cc = bpmem.combiners[0].colorC;
+  cc.a = TevColorArg::Zero;
+  cc.b = TevColorArg::Zero;
+  cc.c = TevColorArg::Zero;
+  cc.d = TevColorArg::RasColor;
+  cc.clamp = true;
+  TevStageCombiner::AlphaCombiner& ac = bpmem.combiners[0].alphaC;
+  ac.a = TevAlphaArg::Zero;
+  ac.b = TevAlphaArg::Zero;
+  ac.c = TevAlphaArg::Zero;
+  ac.d = TevAlphaArg::RasAlpha;
+  ac.clamp = true;
+
+  bpmem.alpha_test.comp0 = CompareMode::Always;
+  bpmem.alpha_test.comp1 = CompareMode::Always;
+
+  bpmem.zmode.test_enable = true;
+  bpmem.zmode.func = CompareMode::LEqual;
+  bpmem.zmode.update_enable = true;
+  bpmem.zcontrol.pixel_format = format;
+
+  bpmem.blendmode.blend_enable = true;
+  bpmem.blendmode.src_factor = SrcBlendFactor::SrcAlpha;
+  bpmem.blendmode.dst_factor = DstBlendFactor::InvSrcAlpha;
+  bpmem.blendmode.color_update = true;
+  bpmem.blendmode.alpha_update = true;
+
+  bpmem.scissorTL.x = SCISSOR_OFFSET;
+  bpmem.scissorTL.y = SCISSOR_OFFSET;
+  bpmem.scissorBR.x = SCISSOR_OFFSET + EFB_WIDTH - 1;
+  bpmem.scissorBR.y = SCISSOR_OFFSET + EFB_HEIGHT - 1;
+  bpmem.scissorOffset.x = SCISSOR_OFFSET >> 1;
+  bpmem.scissorOffset.y = SCISSOR_OFFSET >> 1;
+
+  xfmem.viewport.wd = EFB_WIDTH / 2.0f;
+  xfmem.viewport.ht = -(EFB_HEIGHT / 2.0f);
+  xfmem.viewport.xOrig = SCISSOR_OFFSET + EFB_WIDTH / 2.0f;
+  xfmem.viewport.yOrig = SCISSOR_OFFSET + EFB_HEIGHT / 2.0f;
+}
+
+OutputVertexData RandomVertex(std::mt19937& rng, float center_x, float center_y)
+{
+  std::uniform_real_distribution<float> offset_dist(-48.0f, 48.0f);
+  std::uniform_real_distribution<float> z_dist(0.0f, 16777215.0f);
+  std::uniform_int_distribution<int> color_dist(0, 255);
+
+  OutputVertexData vertex;
+  vertex.screenPosition = {center_x + offset_dist(rng) + SCISSOR_OFFSET,
+                           center_y + offset_dist(rng) + SCISSOR_OFFSET, z_dist(rng)};
+  vertex.projectedPosition.w = 1.0f;
+  for (u8& component : vertex.color[0])
+    component = static_cast<u8>(color_dist(rng));
+  return vertex;
+}
+
+// Draws over a thousand overlapping triangles into a cleared EFB, in batches of different sizes,
+// and returns the contents of the EFB (color followed by depth).
+std::vector<u8> DrawScene(int num_threads)
+{
+  Config::SetCurrent(Config::GFX_SW_RASTERIZER_THREADS, num_threads);
+
+  std::memset(EfbInterface::GetPixelPointer(0, 0, false), 0, EFB_BUFFER_SIZE);
+  std::memset(EfbInterface::GetPixelPointer(0, 0, true), 0xff, EFB_BUFFER_SIZE);
+
+  Rasterizer::Init();
+  Rasterizer::SetTevState();
+  Rasterizer::ScissorChanged();
+
+  // Small triangles all over the EFB, reaching a little past its edges so that the scissor is
+  // tested too. Many of them cross the edges of the tiles.
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> x_dist(0.0f, EFB_WIDTH);
+  std::uniform_real_distribution<float> y_dist(0.0f, EFB_HEIGHT);
+  for (int batch_size : {1, 4, 16, 64, 256, 1024})
+  {
+    for (int i = 0; i < batch_size; i++)
+    {
+      const float center_x = x_dist(rng);
+      const float center_y = y_dist(rng);
+      const OutputVertexData v0 = RandomVertex(rng, center_x, center_y);
+      OutputVertexData v1 = RandomVertex(rng, center_x, center_y);
+      OutputVertexData v2 = RandomVertex(rng, center_x, center_y);
+
+      // Only counter-clockwise triangles are drawn.
+      const float dx10 = v1.screenPosition.x - v0.screenPosition.x;
+      const float dy10 = v1.screenPosition.y - v0.screenPosition.y;
+      const float dx20 = v2.screenPosition.x - v0.screenPosition.x;
+      const float dy20 = v2.screenPosition.y - v0.screenPosition.y;
+      if (dx10 * dy20 - dy10 * dx20 > 0.0f)
+        std::swap(v1, v2);
+
+      Rasterizer::DrawTriangleFrontFace(&v0, &v1, &v2);
+    }
+    Rasterizer::Flush();
+  }
+
+  Rasterizer::Shutdown();
+
+  const u8* efb = EfbInterface::GetPixelPointer(0, 0, false);
+  return std::vector<u8>(efb, efb + 2 * EFB_BUFFER_SIZE);
+}
+}  // namespace
+
+class RasterizerTest : public testing::TestWithParam<PixelFormat>
+{
+protected:
+  void SetUp() override
+  {
+    Config::Init();
+    SetUpBPMemory(GetParam());
+  }
+  void TearDown() override { Config::Shutdown(); }
+};
+
+// Every tile is drawn by one thread, but the pixels along the tile edges share cache lines and
+// neighbouring bytes with other tiles. Drawing with several threads must give the same EFB as
+// drawing with one.
+TEST_P(RasterizerTest, ThreadCountDoesNotChangeResult)
+{
+  const std::vector<u8> expected = DrawScene(1);
+
+  const u8* color = expected.data();
+  const bool drew_something =
+      std::any_of(color, color + EFB_BUFFER_SIZE, [](u8 value) { return value != 0; });
+  ASSERT_TRUE(drew_something);
+
+  for (int num_threads : {2, 5})
+  {
+    // A race only shows up sometimes, so draw a few times.
+    for (int run = 0; run < 3; run++)
+    {
+      const std::vector<u8> result = DrawScene(num_threads);
+      const auto mismatch = std::mismatch(expected.begin(), expected.end(), result.begin());
+      ASSERT_EQ(mismatch.first, expected.end())
+          << fmt::format("{} threads, run {}: first difference at byte {}", num_threads, run,
+                         mismatch.first - expected.begin());
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(PixelFormats, RasterizerTest,
+                         testing::Values(PixelFormat::RGB8_Z24, PixelFormat::RGBA6_Z24),
+                         [](const testing::TestParamInfo<PixelFormat>& info) {
+                           return info.param == PixelFormat::RGB8_Z24 ? "RGB8_Z24" : "RGBA6_Z24";
+                         });
@@ -0,0 +1,146 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/ParallelTextureDecoder.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+// Large enough for every index of a C14X2 texture
+constexpr size_t TLUT_SIZE = 2 << 14;
+
+constexpr TextureFormat FORMATS[] = {
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4, TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR,
+};
+
+struct TestTexture
+{
+  TestTexture(int width_, int height_, TextureFormat format_)
+      : width(width_), height(height_), format(format_),
+        src(TexDecoder_GetTextureSizeInBytes(width, height, format)), tlut(TLUT_SIZE)
+  {
+    std::mt19937 rng(static_cast<u32>(width * 31 + height * 7 + static_cast<int>(format)));
+    std::uniform_int_distribution<int> dist(0, 255);
+    for (u8& byte : src)
+      byte = static_cast<u8>(dist(rng));
+    for (u8& byte : tlut)
+      byte = static_cast<u8>(dist(rng));
+  }
+
+  std::vector<u32> DecodeSerial() const
+  {
+    std::vector<u32> dst(width * height);
+    TexDecoder_Decode(reinterpret_cast<u8*>(dst.data()), src.data(), width, height, format,
+                      tlut.data(), TLUTFormat::RGB5A3);
+    return dst;
+  }
+
+  int width;
+  int height;
+  TextureFormat format;
+  std::vector<u8> src;
+  std::vector<u8> tlut;
+};
+}  // namespace
+
+TEST(ParallelTextureDecoder, MatchesSerialDecoding)
+{
+  ParallelTextureDecoder decoder;
+  decoder.SetNumWorkers(3);
+
+  for (TextureFormat format : FORMATS)
+  {
+    // A mip chain with levels above and below the size decoded by the workers, plus a width
+    // which doesn't split into even strips.
+    std::vector<TestTexture> textures;
+    for (int size = 1024; size >= 8; size /= 2)
+      textures.emplace_back(size, size, format);
+    textures.emplace_back(1000, 520, format);
+
+    std::vector<std::vector<u32>> results;
+    for (const TestTexture& texture : textures)
+    {
+      results.emplace_back(texture.width * texture.height);
+      decoder.Decode(reinterpret_cast<u8*>(results.back().data()), texture.src.data(),
+                     texture.width, texture.height, format, texture.tlut.data(),
+                     TLUTFormat::RGB5A3);
+    }
+    decoder.Wait();
+
+    for (size_t i = 0; i < textures.size(); ++i)
+    {
+      EXPECT_EQ(results[i], textures[i].DecodeSerial())
+          << "format " << static_cast<int>(format) << ", " << textures[i].width << "x"
+          << textures[i].height;
+    }
+  }
+}
+
+TEST(ParallelTextureDecoder, ChangesNumberOfWorkers)
+{
+  ParallelTextureDecoder decoder;
+  const TestTexture texture(512, 512, TextureFormat::RGB5A3);
+  const std::vector<u32> expected = texture.DecodeSerial();
+
+  for (u32 num_workers : {0, 1, 4, 2, 0})
+  {
+    decoder.SetNumWorkers(num_workers);
+    EXPECT_EQ(decoder.GetNumWorkers(), num_workers);
+
+    std::vector<u32> result(texture.width * texture.height);
+    decoder.Decode(reinterpret_cast<u8*>(result.data()), texture.src.data(), texture.width,
+                   texture.height, texture.format, texture.tlut.data(), TLUTFormat::RGB5A3);
+    decoder.Wait();
+    EXPECT_EQ(result, expected) << num_workers << " workers";
+  }
+}
+
+// Prints how long decoding a 1024x1024 texture with its mip chain takes with and without workers.
+// Run with --gtest_also_run_disabled_tests.
+TEST(ParallelTextureDecoder, DISABLED_Benchmark)
+{
+  using Clock = std::chrono::steady_clock;
+  constexpr int ITERATIONS = 20;
+
+  for (TextureFormat format : FORMATS)
+  {
+    std::vector<TestTexture> textures;
+    for (int size = 1024; size >= 8; size /= 2)
+      textures.emplace_back(size, size, format);
+    std::vector<u32> dst(1024 * 1024 * 2);
+
+    const auto measure = [&](u32 num_workers) {
+      ParallelTextureDecoder decoder;
+      decoder.SetNumWorkers(num_workers);
+      const Clock::time_point start = Clock::now();
+      for (int i = 0; i < ITERATIONS; ++i)
+      {
+        u32* level_dst = dst.data();
+        for (const TestTexture& texture : textures)
+        {
+          decoder.Decode(reinterpret_cast<u8*>(level_dst), texture.src.data(), texture.width,
+                         texture.height, format, texture.tlut.data(), TLUTFormat::RGB5A3);
+          level_dst += texture.width * texture.height;
+        }
+        decoder.Wait();
+      }
+      return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / ITERATIONS;
+    };
+
+    const double serial_us = measure(0);
+    const double parallel_us = measure(4);
+    fmt::print("format {:2}: {:8.1f} us serial, {:8.1f} us with 4 workers ({:.2f}x)\n",
+               static_cast<int>(format), serial_us, parallel_us, serial_us / parallel_us);
+  }
+}
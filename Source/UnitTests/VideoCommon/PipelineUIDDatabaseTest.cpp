@@ -0,0 +1,93 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/PipelineUIDDatabase.h"
+
+using VideoCommon::PipelineUIDDatabase;
+using VideoCommon::SerializedGXPipelineUid;
+
+namespace
+{
+SerializedGXPipelineUid MakeUid(u32 id)
+{
+  SerializedGXPipelineUid uid;
+  uid.vertex_decl.stride = id & 0xff;
+  uid.rasterization_state_bits = id;
+  uid.blending_state_bits = ~id;
+  return uid;
+}
+}  // namespace
+
+class PipelineUIDDatabaseTest : public testing::Test
+{
+protected:
+  PipelineUIDDatabaseTest() : m_directory(File::CreateTempDir()) {}
+  ~PipelineUIDDatabaseTest() override { File::DeleteDirRecursively(m_directory); }
+
+  std::string GetPath(const std::string& name) const { return m_directory + "/" + name; }
+
+  std::string m_directory;
+};
+
+TEST_F(PipelineUIDDatabaseTest, AddSkipsDuplicates)
+{
+  PipelineUIDDatabase database;
+  EXPECT_TRUE(database.Add(MakeUid(1)));
+  EXPECT_TRUE(database.Add(MakeUid(2)));
+  EXPECT_FALSE(database.Add(MakeUid(1)));
+  ASSERT_EQ(database.GetSize(), 2u);
+  EXPECT_EQ(database.GetUIDs()[1].rasterization_state_bits, 2u);
+}
+
+TEST_F(PipelineUIDDatabaseTest, MergeFiles)
+{
+  PipelineUIDDatabase first;
+  for (u32 id = 0; id < 100; id++)
+    first.Add(MakeUid(id));
+  ASSERT_TRUE(first.Save(GetPath("first.uidcache")));
+
+  PipelineUIDDatabase second;
+  for (u32 id = 50; id < 200; id++)
+    second.Add(MakeUid(id));
+  ASSERT_TRUE(second.Save(GetPath("second.uidcache")));
+
+  PipelineUIDDatabase merged;
+  ASSERT_TRUE(merged.Load(GetPath("first.uidcache")));
+  ASSERT_TRUE(merged.Load(GetPath("second.uidcache")));
+  ASSERT_EQ(merged.GetSize(), 200u);
+  for (u32 id = 0; id < 200; id++)
+    EXPECT_EQ(merged.GetUIDs()[id].rasterization_state_bits, id);
+}
+
+TEST_F(PipelineUIDDatabaseTest, RejectsInvalidFiles)
+{
+  PipelineUIDDatabase database;
+  EXPECT_FALSE(database.Load(GetPath("missing.uidcache")));
+
+  const u32 old_version = VideoCommon::GX_PIPELINE_UID_VERSION - 1;
+  {
+    File::IOFile file(GetPath("old.uidcache"), "wb");
+    file.WriteBytes(&PipelineUIDDatabase::FILE_MAGIC, sizeof(u32));
+    file.WriteBytes(&old_version, sizeof(old_version));
+  }
+  EXPECT_FALSE(database.Load(GetPath("old.uidcache")));
+
+  database.Add(MakeUid(1));
+  ASSERT_TRUE(database.Save(GetPath("truncated.uidcache")));
+  {
+    File::IOFile file(GetPath("truncated.uidcache"), "rb+");
+    ASSERT_TRUE(file.Resize(file.GetSize() - 1));
+  }
+
+  PipelineUIDDatabase other;
+  EXPECT_FALSE(other.Load(GetPath("truncated.uidcache")));
+  EXPECT_EQ(other.GetSize(), 0u);
+}
@@ -0,0 +1,218 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureCacheIndex.h"
+
+using VideoCommon::FlatHashIndex;
+using VideoCommon::IndexedMultimap;
+
+TEST(FlatHashIndex, InsertFindErase)
+{
+  FlatHashIndex<u32, u32> index;
+  EXPECT_EQ(index.Find(0), nullptr);
+
+  for (u32 i = 0; i < 1000; ++i)
+    index.Insert(i * 32, i);
+  EXPECT_EQ(index.size(), 1000u);
+
+  for (u32 i = 0; i < 1000; ++i)
+  {
+    ASSERT_NE(index.Find(i * 32), nullptr);
+    EXPECT_EQ(*index.Find(i * 32), i);
+  }
+  EXPECT_EQ(index.Find(16), nullptr);
+
+  // Erasing every other key must not lose any of the keys which shared a probe sequence with it.
+  for (u32 i = 0; i < 1000; i += 2)
+    index.Erase(i * 32);
+  EXPECT_EQ(index.size(), 500u);
+  for (u32 i = 0; i < 1000; ++i)
+    EXPECT_EQ(index.Find(i * 32) != nullptr, i % 2 == 1);
+
+  index.Erase(16);
+  EXPECT_EQ(index.size(), 500u);
+
+  index.Clear();
+  EXPECT_EQ(index.size(), 0u);
+  EXPECT_EQ(index.Find(32), nullptr);
+}
+
+// Applies the same random operations to an IndexedMultimap and a std::multimap, and checks that
+// both always return the same elements.
+TEST(IndexedMultimap, MatchesMultimap)
+{
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<u32> key_dist(0, 63);
+  std::uniform_int_distribution<u32> op_dist(0, 9);
+
+  IndexedMultimap<u32, u32> indexed;
+  std::multimap<u32, u32> reference;
+
+  for (u32 value = 0; value < 20000; ++value)
+  {
+    const u32 key = key_dist(rng);
+    const u32 op = op_dist(rng);
+    if (op < 5)
+    {
+      indexed.emplace(key, value);
+      reference.emplace(key, value);
+    }
+    else if (op < 9)
+    {
+      // Erase a random element of the key, which is not necessarily the first one.
+      const auto range = indexed.equal_range(key);
+      const auto count = std::distance(range.first, range.second);
+      if (count == 0)
+        continue;
+      const auto skip = std::uniform_int_distribution<long>(0, count - 1)(rng);
+      indexed.erase(std::next(range.first, skip));
+      reference.erase(std::next(reference.equal_range(key).first, skip));
+    }
+    else
+    {
+      indexed.clear();
+      reference.clear();
+    }
+
+    const auto range = indexed.equal_range(key);
+    const auto reference_range = reference.equal_range(key);
+    ASSERT_TRUE(std::equal(range.first, range.second, reference_range.first,
+                           reference_range.second));
+    ASSERT_EQ(indexed.size(), reference.size());
+  }
+
+  for (u32 key = 0; key <= 63; ++key)
+  {
+    const auto range = indexed.equal_range(key);
+    const auto reference_range = reference.equal_range(key);
+    EXPECT_TRUE(std::equal(range.first, range.second, reference_range.first,
+                           reference_range.second));
+  }
+  EXPECT_TRUE(std::equal(indexed.begin(), indexed.end(), reference.begin(), reference.end()));
+}
+
+namespace
+{
+struct TraceEvent
+{
+  enum class Type
+  {
+    Lookup,
+    EFBCopy,
+  };
+
+  Type type;
+  u32 address;
+  u32 size;
+};
+
+struct Trace
+{
+  std::vector<u32> texture_addresses;
+  std::vector<TraceEvent> events;
+};
+
+// A trace shaped like the texture cache traffic of draw-call-heavy frames: thousands of lookups
+// of a working set of textures, and a handful of EFB copies which invalidate and replace the
+// textures they overlap.
+Trace GenerateTrace(u32 num_textures, u32 num_frames)
+{
+  std::mt19937 rng(5678);
+  std::uniform_int_distribution<u32> address_dist(0, (24 << 20) / 32 - 1);
+  Trace trace;
+  trace.texture_addresses.resize(num_textures);
+  for (u32& address : trace.texture_addresses)
+    address = address_dist(rng) * 32;
+
+  std::geometric_distribution<u32> working_set_dist(0.002);
+  std::uniform_int_distribution<u32> texture_dist(0, num_textures - 1);
+  for (u32 frame = 0; frame < num_frames; ++frame)
+  {
+    for (u32 draw = 0; draw < 4000; ++draw)
+    {
+      const u32 texture = std::min(working_set_dist(rng), num_textures - 1);
+      trace.events.push_back({TraceEvent::Type::Lookup, trace.texture_addresses[texture], 0});
+    }
+    for (u32 copy = 0; copy < 16; ++copy)
+    {
+      const u32 texture = texture_dist(rng);
+      trace.events.push_back(
+          {TraceEvent::Type::EFBCopy, trace.texture_addresses[texture], 160 * 132 * 4});
+    }
+  }
+  return trace;
+}
+
+// Maps texture addresses to texture sizes.
+template <typename Map>
+std::chrono::steady_clock::duration ReplayTrace(const Trace& trace, u32* found)
+{
+  constexpr u32 TEXTURE_SIZE = 0x8000;
+
+  Map map;
+  for (std::size_t i = 0; i < trace.texture_addresses.size(); ++i)
+  {
+    map.emplace(trace.texture_addresses[i], TEXTURE_SIZE);
+    // Some textures are used with several palettes or formats.
+    if (i % 8 == 0)
+      map.emplace(trace.texture_addresses[i], TEXTURE_SIZE);
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  for (const TraceEvent& event : trace.events)
+  {
+    if (event.type == TraceEvent::Type::Lookup)
+    {
+      const auto range = map.equal_range(event.address);
+      *found += static_cast<u32>(std::distance(range.first, range.second));
+    }
+    else
+    {
+      const u32 lower_address = event.address > TEXTURE_SIZE ? event.address - TEXTURE_SIZE : 0;
+      auto it = map.lower_bound(lower_address);
+      const auto end = map.upper_bound(event.address + event.size);
+      while (it != end)
+      {
+        if (it->first + it->second > event.address)
+          it = map.erase(it);
+        else
+          ++it;
+      }
+      map.emplace(event.address, TEXTURE_SIZE);
+    }
+  }
+  return std::chrono::steady_clock::now() - start;
+}
+}  // namespace
+
+// Not a correctness test, but a rough comparison of the per-lookup cost against a plain
+// std::multimap.
+TEST(IndexedMultimap, DISABLED_TraceThroughput)
+{
+  constexpr u32 NUM_TEXTURES = 4096;
+  const Trace trace = GenerateTrace(NUM_TEXTURES, 100);
+
+  u32 found_multimap = 0;
+  u32 found_indexed = 0;
+  const auto multimap_time = ReplayTrace<std::multimap<u32, u32>>(trace, &found_multimap);
+  const auto indexed_time = ReplayTrace<IndexedMultimap<u32, u32>>(trace, &found_indexed);
+  EXPECT_EQ(found_multimap, found_indexed);
+  EXPECT_NE(found_indexed, 0u);
+
+  const auto ns_per_event = [&trace](std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::nano>(duration).count() / trace.events.size();
+  };
+  fmt::print("std::multimap: {:.1f} ns/event\n", ns_per_event(multimap_time));
+  fmt::print("IndexedMultimap: {:.1f} ns/event\n", ns_per_event(indexed_time));
+}
@@ -0,0 +1,184 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+#include "VideoCommon/TextureDecoder.h"
+
+// TextureDecoder_Generic.cpp, built into this test under another name (see CMakeLists.txt)
+void TexDecoder_DecodeImpl_Generic(u32* dst, const u8* src, int width, int height,
+                                   TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt);
+
+namespace
+{
+constexpr TextureFormat FORMATS[] = {
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4, TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR,
+};
+
+constexpr TLUTFormat TLUT_FORMATS[] = {TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3};
+
+// Large enough for every index of a C14X2 texture
+constexpr size_t TLUT_SIZE = 2 << 14;
+
+// Which of the x64 decoders are used. The SIMD ones are picked by what cpu_info says the CPU can
+// do, so this lowers it for as long as it exists.
+class ScopedCPUFeatures
+{
+public:
+  ScopedCPUFeatures(bool avx2, bool ssse3) : m_avx2(cpu_info.bAVX2), m_ssse3(cpu_info.bSSSE3)
+  {
+    cpu_info.bAVX2 = m_avx2 && avx2;
+    cpu_info.bSSSE3 = m_ssse3 && ssse3;
+  }
+  ~ScopedCPUFeatures()
+  {
+    cpu_info.bAVX2 = m_avx2;
+    cpu_info.bSSSE3 = m_ssse3;
+  }
+
+  ScopedCPUFeatures(const ScopedCPUFeatures&) = delete;
+  ScopedCPUFeatures& operator=(const ScopedCPUFeatures&) = delete;
+
+private:
+  bool m_avx2;
+  bool m_ssse3;
+};
+
+struct DecoderVariant
+{
+  const char* name;
+  bool avx2;
+  bool ssse3;
+};
+
+constexpr DecoderVariant VARIANTS[] = {
+    {"AVX2", true, true},
+    {"SSSE3", false, true},
+    {"SSE2", false, false},
+};
+
+// ScopedCPUFeatures can only take features away, so the newer variants are left out on CPUs
+// without them.
+bool IsSupported(const DecoderVariant& variant)
+{
+  return (!variant.avx2 || cpu_info.bAVX2) && (!variant.ssse3 || cpu_info.bSSSE3);
+}
+
+std::vector<u8> RandomBytes(size_t size, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<u8> bytes(size);
+  for (u8& byte : bytes)
+    byte = static_cast<u8>(dist(rng));
+  return bytes;
+}
+}  // namespace
+
+TEST(TextureDecoderX64, MatchesGenericDecoder)
+{
+  const std::vector<u8> tlut = RandomBytes(TLUT_SIZE, 1);
+
+  u32 seed = 2;
+  for (TextureFormat format : FORMATS)
+  {
+    const int block_width = TexDecoder_GetBlockWidthInTexels(format);
+    const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+
+    // Widths of an odd number of blocks as well, which the decoders handling two blocks at once
+    // have to leave to the others.
+    for (int width_blocks : {1, 2, 3, 16})
+    {
+      for (int height_blocks : {1, 5})
+      {
+        const int width = width_blocks * block_width;
+        const int height = height_blocks * block_height;
+        const std::vector<u8> src =
+            RandomBytes(TexDecoder_GetTextureSizeInBytes(width, height, format), seed++);
+
+        for (TLUTFormat tlut_format : TLUT_FORMATS)
+        {
+          std::vector<u32> expected(width * height);
+          TexDecoder_DecodeImpl_Generic(expected.data(), src.data(), width, height, format,
+                                        tlut.data(), tlut_format);
+
+          for (const DecoderVariant& variant : VARIANTS)
+          {
+            if (!IsSupported(variant))
+              continue;
+
+            ScopedCPUFeatures features(variant.avx2, variant.ssse3);
+            std::vector<u32> result(width * height);
+            _TexDecoder_DecodeImpl(result.data(), src.data(), width, height, format, tlut.data(),
+                                   tlut_format);
+            EXPECT_EQ(result, expected)
+                << variant.name << ", format " << static_cast<int>(format) << ", TLUT format "
+                << static_cast<int>(tlut_format) << ", " << width << "x" << height;
+          }
+        }
+      }
+    }
+  }
+}
+
+// Prints how many texels per second each variant of the decoders gets through.
+// Run with --gtest_also_run_disabled_tests.
+TEST(TextureDecoderX64, DISABLED_Benchmark)
+{
+  using Clock = std::chrono::steady_clock;
+  constexpr int SIZE = 1024;
+  constexpr int ITERATIONS = 50;
+
+  const std::vector<u8> tlut = RandomBytes(TLUT_SIZE, 1);
+  // Aligned like the buffer of the texture cache
+  u32* dst = static_cast<u32*>(Common::AllocateAlignedMemory(SIZE * SIZE * sizeof(u32), 32));
+
+  for (TextureFormat format : FORMATS)
+  {
+    const std::vector<u8> src =
+        RandomBytes(TexDecoder_GetTextureSizeInBytes(SIZE, SIZE, format), 2);
+
+    const auto measure = [&](auto decode) {
+      decode();
+      const Clock::time_point start = Clock::now();
+      for (int i = 0; i < ITERATIONS; ++i)
+        decode();
+      const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+      return double(SIZE) * SIZE * ITERATIONS / seconds / 1e6;
+    };
+
+    const double generic = measure([&] {
+      TexDecoder_DecodeImpl_Generic(dst, src.data(), SIZE, SIZE, format, tlut.data(),
+                                    TLUTFormat::RGB5A3);
+    });
+    std::string line =
+        fmt::format("format {:2}: {:8.1f} Mtexels/s generic", static_cast<int>(format), generic);
+    for (const DecoderVariant& variant : VARIANTS)
+    {
+      if (!IsSupported(variant))
+        continue;
+
+      ScopedCPUFeatures features(variant.avx2, variant.ssse3);
+      const double x64 = measure([&] {
+        _TexDecoder_DecodeImpl(dst, src.data(), SIZE, SIZE, format, tlut.data(),
+                               TLUTFormat::RGB5A3);
+      });
+      line += fmt::format(", {:8.1f} {}", x64, variant.name);
+    }
+    fmt::print("{}\n", line);
+  }
+
+  Common::FreeAlignedMemory(dst);
+}
@@ -1,11 +1,13 @@
 // Copyright 2014 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
 #include <bit>
 #include <limits>
 #include <memory>
 #include <tuple>
 #include <unordered_set>
+#include <vector>
 
 #include <gtest/gtest.h>  // NOLINT
 
@@ -13,6 +15,8 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexDataCache.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
 
@@ -259,6 +263,71 @@ TEST_F(VertexLoaderTest, PositionIndex16FloatXY)
   ExpectOut(2);
 }
 
+TEST_F(VertexLoaderTest, VertexDataCache)
+{
+  m_vtx_desc.low.PosMatIdx = 1;
+  m_vtx_desc.low.Position = VertexComponentFormat::Index8;
+  m_vtx_desc.low.Color[0] = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+  CreateAndCheckSizes(2 + sizeof(u32), sizeof(u32) + 3 * sizeof(float) + sizeof(u32));
+  for (u8 i = 0; i < 4; i++)
+  {
+    Input<u8>(i);
+    Input<u8>(3 - i);
+    Input<u32>(0x11223344u * i);
+  }
+
+  // Padded, as the vertex loader may read past the last element
+  std::array<float, 16> positions{};
+  for (size_t i = 0; i < 12; i++)
+    positions[i] = static_cast<float>(i);
+  VertexLoaderManager::cached_arraybases[CPArray::Position] =
+      reinterpret_cast<u8*>(positions.data());
+  g_main_cp_state.array_strides[CPArray::Position] = 3 * sizeof(float);
+
+  const size_t size = 4 * m_loader->m_native_vtx_decl.stride;
+  // The vertex loader can write up to 4 bytes past the end
+  std::vector<u8> expected;
+  auto expected_positions = VertexLoaderManager::position_cache;
+  auto expected_matrix_indices = VertexLoaderManager::position_matrix_index_cache;
+  const auto run_loader = [&] {
+    expected.assign(size + 4, 0);
+    ASSERT_EQ(m_loader->RunVertices(input_memory, expected.data(), 4), 4);
+    expected.resize(size);
+    expected_positions = VertexLoaderManager::position_cache;
+    expected_matrix_indices = VertexLoaderManager::position_matrix_index_cache;
+  };
+  run_loader();
+
+  VertexDataCache cache;
+  g_stats.this_frame.num_vertex_data_cache_hits = 0;
+  const auto run_cache = [&] {
+    VertexLoaderManager::position_cache = {};
+    VertexLoaderManager::position_matrix_index_cache = {};
+    std::vector<u8> output(size + 4);
+    ASSERT_EQ(cache.RunVertices(m_loader.get(), m_vtx_desc, m_vtx_attr, input_memory,
+                                output.data(), 4),
+              4);
+    output.resize(size);
+    EXPECT_EQ(output, expected);
+    EXPECT_EQ(VertexLoaderManager::position_cache, expected_positions);
+    EXPECT_EQ(VertexLoaderManager::position_matrix_index_cache, expected_matrix_indices);
+  };
+
+  // Vertex data is added to the cache when it is seen for the second time
+  for (int i = 0; i < 3; i++)
+    run_cache();
+  EXPECT_EQ(g_stats.this_frame.num_vertex_data_cache_hits, 1);
+
+  // Changes to the array are noticed
+  positions[4] = 100.f;
+  run_loader();
+  run_cache();
+  EXPECT_EQ(g_stats.this_frame.num_vertex_data_cache_hits, 1);
+}
+
 class VertexLoaderSpeedTest : public VertexLoaderTest,
                               public ::testing::WithParamInterface<std::tuple<ComponentFormat, int>>
 {